@@ -11,8 +11,9 @@
 *     12 OCT 2015 jcs  Build 10a:MDW_Internal.h
 *     29 MAR 2022 jcs  Build 13: Binary._bPackFlds
 *      1 NOV 2022 jcs  Build 16: _GetVector() / _SetVector(); _wireMult()
+*     17 OCT 2026 jcs  Build 22: SetPackFlds(); SetTimeRTL()
 *
-*  (c) 1994-2022, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __MDD_BINARY_H
 #define __MDD_BINARY_H
@@ -71,6 +72,7 @@ public:
 	// Access / Operations
 public:
 	double MsgTime( mddBinHdr & );
+	void   SetPackFlds( bool );
 
 	// Wire Protocol - Get
 public:
@@ -88,6 +90,7 @@ public:
 	// Wire Protocol - Set
 
 	int Set( u_char *, mddBinHdr &, bool bLenOnly=false );
+	int SetTimeRTL( u_char *, u_int );
 	int Set( u_char *, mddField );
 	int Set( u_char *, mddBuf );
 	int Set( u_char *, u_char );
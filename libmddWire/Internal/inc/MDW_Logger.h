@@ -38,6 +38,7 @@ public:
 	// Access
 
 	Mutex &mtx();
+	bool   CanLog( int );
 
 	// Operations
 
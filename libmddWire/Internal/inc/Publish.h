@@ -8,8 +8,9 @@
 *     10 JUN 2014 jcs  Build  7: _estFldSz
 *     12 SEP 2015 jcs  Build 10: namespace MDDWIRE_PRIVATE
 *     12 OCT 2015 jcs  Build 10a:MDW_Internal.h
+*     17 OCT 2026 jcs  Build 22: _bin; BuildMsgTemplate() / BuildMsgFromTemplate()
 *
-*  (c) 1994-2015 Gatea Ltd.
+*  (c) 1994-2026 Gatea Ltd.
 ******************************************************************************/
 #ifndef __MDD_PUBLISH_H
 #define __MDD_PUBLISH_H
@@ -28,6 +29,7 @@ protected:
 	PubFields _upds;
 	int       _estFldSz;
 	char     *_xTrans;
+	Binary    _bin;
 
 	// Constructor / Destructor
 public:
@@ -44,6 +46,8 @@ public:
 	mddBuf BuildMsg( mddMsgHdr, mddProtocol, mddBldBuf &, bool bFldNm=false );
 	mddBuf BuildRawMsg( mddMsgHdr, mddBuf, mddBldBuf & );
 	mddBuf SetHdrTag( u_int, mddBuf & );
+	mddMsgTemplate BuildMsgTemplate( mddMsgHdr );
+	mddBuf BuildMsgFromTemplate( mddMsgTemplate &, mddMsgType, u_int, mddBldBuf & );
 	mddBuf ConvertFieldList( mddWireMsg, mddProtocol, mddBldBuf &, bool );
 
 	// API - Data Interface
@@ -66,6 +70,7 @@ protected:
 protected:
 	mddBuf _Binary_Build( mddMsgHdr, mddBuf, mddBldBuf & );
 	mddBuf _Binary_SetHdrTag( u_int, mddBuf & );
+	Binary &_Binary();
 
 	// Helpers
 private:
@@ -8,13 +8,16 @@
 *     12 SEP 2015 jcs  Build 10: namespace MDDWIRE_PRIVATE
 *     12 OCT 2015 jcs  Build 10a:MDW_Internal.h
 *     29 OCT 2022 jcs  Build 16: hash_map; No mo _ddb
+*     17 OCT 2026 jcs  Build 22: Dense _ddb[]; _gfifId for sparse / negative
 *
-*  (c) 1994-2022, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __MDD_SCHEMA_H
 #define __MDD_SCHEMA_H
 #include <MDW_Internal.h>
 
+#define _MAX_DENSE_FID 64*K
+
 namespace MDDWIRE_PRIVATE
 {
 
@@ -35,6 +38,8 @@ private:
 	mddFieldList    _fl;
 	int             _minFid;
 	int             _maxFid;
+	mddFldDef     **_ddb;
+	int             _nDdb;
 	FldDefByIdMap   _gfifId;
 	FldDefByNameMap _gfifStr;
 
@@ -18,8 +18,9 @@
 *     23 AUG 2023 jcs  Build 18: Set( float ) rounding error
 *     11 MAR 2024 jcs  Build 19: Negative unpacked doubles ; Take v._rXX as is
 *     16 MAR 2024 jcs  Build 20: _Set_unpacked() : No mo bNeg
+*     17 OCT 2026 jcs  Build 22: SetPackFlds(); SetTimeRTL()
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <MDW_Internal.h>
 
@@ -158,6 +159,11 @@ double Binary::MsgTime( mddBinHdr &h )
    return mTm;
 }
 
+void Binary::SetPackFlds( bool bPackFlds )
+{
+   _bPackFlds = bPackFlds;
+}
+
 
 ////////////////////////////////////////////
 // Wire Protocol - Get
@@ -396,6 +402,18 @@ int Binary::Set( u_char *bp, mddBinHdr &h, bool bLenOnly )
    return( cp-bp );
 }
 
+int Binary::SetTimeRTL( u_char *bp, u_int RTL )
+{
+   u_char *cp;
+
+   // Tail of mddBinHdr : Everything after wmddBinHdr._reserved
+
+   cp  = bp;
+   cp += _u_pack( cp, _TimeNow() ); // wmddBinHdr._time[4]
+   cp += _u_pack( cp, RTL );        // wmddBinHdr._RTL[4]
+   return( cp-bp );
+}
+
 int Binary::Set( u_char *bp, mddField f )
 {
    mddValue &v = f._val;
@@ -9,8 +9,9 @@
 *     12 OCT 2015 jcs  Build 11: MDW_SLEEP()
 *      1 NOV 2022 jcs  Build 16: mddFld_vector; mddWire_vectorSize
 *     16 MAR 2024 jcs  Build 20: mddWire_RealToDouble() / mddWire_DoubleToReal()
+*     17 OCT 2026 jcs  Build 22: mddPub_BuildMsgTemplate() / FromTemplate()
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <MDW_Internal.h>
 #include <GLedgDTD.h>
@@ -207,6 +208,45 @@ mddBuf mddPub_SetHdrTag( mddWire_Context cxt,
    return pub ? pub->SetHdrTag( iTag, *outBuf ) : _bz;
 }
 
+mddMsgTemplate mddPub_BuildMsgTemplate( mddWire_Context cxt, mddMsgHdr h )
+{
+   mddMsgTemplate t;
+   mddWire       *mdd;
+   Publish       *pub;
+
+   // Auto-create in Subscribe-only channel, if needed
+
+   if ( !(pub=_GetPub( cxt )) ) {
+      if ( (mdd=_GetWire( cxt )) )
+         mdd->_pub = new Publish() ;
+      pub = _GetPub( cxt );
+   }
+   if ( pub )
+      return pub->BuildMsgTemplate( h );
+   ::memset( &t, 0, sizeof( t ) );
+   return t;
+}
+
+mddBuf mddPub_BuildMsgFromTemplate( mddWire_Context cxt,
+                                    mddMsgTemplate *tmpl,
+                                    mddMsgType      mt,
+                                    u_int           RTL,
+                                    mddBldBuf      *outBuf )
+{
+   mddBldBuf &bb = *outBuf;
+   mddBuf     rb;
+   Publish   *pub;
+
+   // Template implies Publish exists
+
+   if ( !(pub=_GetPub( cxt )) )
+      return _bz;
+   bb._payload = bb._data;
+   rb          = pub->BuildMsgFromTemplate( *tmpl, mt, RTL, bb );
+   bb._dLen    = rb._dLen;
+   return rb;
+}
+
 mddBuf mddPub_BuildRawMsg( mddWire_Context cxt, 
                            mddMsgHdr       h, 
                            mddBuf          payload,
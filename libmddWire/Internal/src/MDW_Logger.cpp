@@ -9,8 +9,9 @@
 *     12 NOV 2014 jcs  Build  8: -Wall
 *     12 SEP 2015 jcs  Build 10: namespace MDDWIRE_PRIVATE
 *     12 OCT 2015 jcs  Build 10a:MDW_Internal.h
+*     17 OCT 2026 jcs  Build 22: CanLog(); Check level before locking
 *
-*  (c) 1994-2015 Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <MDW_Internal.h>
 
@@ -53,6 +54,11 @@ Mutex &Logger::mtx()
    return _mtx;
 }
 
+bool Logger::CanLog( int lvl )
+{
+   return( lvl <= _debugLevel );
+}
+
 
 
 ////////////////////////////////////////////
@@ -60,16 +66,17 @@ Mutex &Logger::mtx()
 ////////////////////////////////////////////
 void Logger::log( int lvl, char *fmt, ... )
 {
-   Locker  lck( _mtx );
    char    sText[8*K];
    char   *sp;
    va_list ap;
 
-   // Pre-condition
+   // Pre-condition : Before we lock
 
-   if ( lvl > _debugLevel )
+   if ( !CanLog( lvl ) )
       return;
 
+   Locker lck( _mtx );
+
    // varargs ... Tried and True
 
    va_start( ap,fmt );
@@ -85,17 +92,18 @@ void Logger::log( int lvl, char *fmt, ... )
 
 void Logger::logT( int lvl, char *fmt, ... )
 {
-   Locker  lck( _mtx );
    char    sText[8*K];
    char   *sp;
    va_list ap;
    string  s;
 
-   // Pre-condition
+   // Pre-condition : Before we lock
 
-   if ( lvl > _debugLevel )
+   if ( !CanLog( lvl ) )
       return;
 
+   Locker lck( _mtx );
+
    // varargs ... Tried and True
 
    va_start( ap,fmt );
@@ -111,9 +119,9 @@ void Logger::logT( int lvl, char *fmt, ... )
 
 void Logger::Write( int lvl, const char *data, int dLen )
 {
-   Locker  lck( _mtx );
+   if ( CanLog( lvl ) ) {
+      Locker lck( _mtx );
 
-   if ( lvl <= _debugLevel ) {
       ::fwrite( data, dLen, 1, _log );
       ::fflush( _log );
    }
@@ -121,11 +129,12 @@ void Logger::Write( int lvl, const char *data, int dLen )
 
 void Logger::HexLog( int lvl, const char *data, int dLen )
 {
-   Locker lck( _mtx );
-   char  *obuf;
-   int    nOut;
+   char *obuf;
+   int   nOut;
+
+   if ( CanLog( lvl ) ) {
+      Locker lck( _mtx );
 
-   if ( lvl <= _debugLevel ) {
       obuf = new char[dLen*4];
       nOut = mddWire_hexMsg( (char *)data, dLen, obuf );
       ::fwrite( obuf, nOut, 1, _log );
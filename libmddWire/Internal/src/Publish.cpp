@@ -13,8 +13,9 @@
 *     29 MAR 2022 jcs  Build 13: Binary._bPackFlds
 *     23 MAY 2022 jcs  Build 14: mddFld_unixTime
 *     28 OCT 2022 jcs  Build 16: mddFld_vector
+*     17 OCT 2026 jcs  Build 22: Re-usable _bin; BuildMsgTemplate()
 *
-*  (c) 1994-2022, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <MDW_Internal.h>
 #include <GLedgDTD.h>
@@ -24,6 +25,9 @@ using namespace MDDWIRE_PRIVATE;
 static char *_sigr32 = "%.4f";    //  4 sigFig max - float
 static char *_sigr64 = "%.10f";   // 10 sigFig max - dbl
 static char *_fldLen = "<%-12s "; // Field Names : 12 chars
+static int   _tmplOff = 4;        // wmddBinHdr._len
+static int   _tmplSz  = 8;        // wmddBinHdr._tag thru _reserved
+static int   _tmplMt  = 5;        // wmddBinHdr._mt, relative to _tag
 
 /////////////////////////////////////////////////////////////////////////////
 //
@@ -38,7 +42,8 @@ Publish::Publish() :
    Data( true ),
    _upds(),
    _estFldSz( 0 ),
-   _xTrans( (char *)0 )
+   _xTrans( (char *)0 ),
+   _bin( _bPackFlds )
 {
 }
 
@@ -173,6 +178,71 @@ mddBuf Publish::SetHdrTag( u_int iTag, mddBuf &bld )
    return z;
 }
 
+mddMsgTemplate Publish::BuildMsgTemplate( mddMsgHdr h )
+{
+   mddMsgTemplate t;
+   mddBinHdr      bh;
+   u_char         buf[K];
+
+   // Only Binary supported; _hdrLen = 0 => Not built
+
+   ::memset( &t, 0, sizeof( t ) );
+   t._proto = _proto;
+   t._iTag  = h._iTag;
+   if ( _proto != mddProto_Binary )
+      return t;
+
+   // Encode once; Keep wmddBinHdr._tag thru _reserved
+
+   ::memset( &bh, 0, sizeof( bh ) );
+   bh._dt       = h._dt;
+   bh._mt       = h._mt;
+   bh._protocol = mddProto_Binary;
+   if ( h._bPack )
+      bh._protocol = (mddProtocol)( bh._protocol | PACKED_BINARY );
+   bh._tag      = h._iTag;
+   _Binary().Set( buf, bh );
+   ::memcpy( t._hdr, buf+_tmplOff, _tmplSz );
+   t._hdrLen = _tmplSz;
+   return t;
+}
+
+mddBuf Publish::BuildMsgFromTemplate( mddMsgTemplate &t,
+                                      mddMsgType      mt,
+                                      u_int           RTL,
+                                      mddBldBuf      &bld )
+{
+   Binary &bin = _Binary();
+   mddBuf  r;
+   char   *bp;
+   u_char *cp;
+   int     i, nf;
+
+   // Pre-condition(s) : Caller falls back to BuildMsg()
+
+   if ( !t._hdrLen || ( t._proto != _proto ) || bld._bNoHdr )
+      return _bz;
+
+   // Length placeholder; Template w/ mt; Time / RTL; Fields; Length
+
+   bp  = _InitFieldListBuf( bld );
+   cp  = (u_char *)bp;
+   cp += _tmplOff;
+   ::memcpy( cp, t._hdr, t._hdrLen );
+   cp[_tmplMt]  = (u_char)mt;
+   cp          += t._hdrLen;
+   cp          += bin.SetTimeRTL( cp, RTL );
+   bld._payload = (char *)cp;
+   nf           = nFld();
+   for ( i=0; i<nf; cp += bin.Set( cp, _upds[i++] ) );
+   r._data   = bp;
+   r._dLen   = ( cp - (u_char *)bp );
+   bin.Set( (u_char *)bp, (u_int)r._dLen, true );
+   bld._dLen = r._dLen;
+   _upds.clear();
+   return r;
+}
+
 mddBuf Publish::ConvertFieldList( mddWireMsg  w, 
                                   mddProtocol pro, 
                                   mddBldBuf  &bld,
@@ -527,7 +597,7 @@ mddBuf Publish::_Binary_Build( mddMsgHdr  m,
    mddBinHdr h;
    mddField  f;
    mddBuf   &b = f._val._buf;
-   Binary    bin( _bPackFlds );
+   Binary   &bin = _Binary();
    bool      bHdr;
    char     *bp;
    u_char   *cp;
@@ -602,7 +672,7 @@ mddBuf Publish::_Binary_Build( mddMsgHdr  m,
 
 mddBuf Publish::_Binary_SetHdrTag( u_int iTag, mddBuf &bld )
 {
-   Binary    bin( _bPackFlds );
+   Binary   &bin = _Binary();
    mddBinHdr h;
    u_char   *cp;
 
@@ -613,6 +683,14 @@ mddBuf Publish::_Binary_SetHdrTag( u_int iTag, mddBuf &bld )
    return bld;
 }
 
+Binary &Publish::_Binary()
+{
+   // Re-use across messages; Honor mddIoctl_unpacked
+
+   _bin.SetPackFlds( _bPackFlds );
+   return _bin;
+}
+
 
 ////////////////////////////////////////////
 // Helpers
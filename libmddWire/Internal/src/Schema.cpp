@@ -11,8 +11,9 @@
 *     12 OCT 2015 jcs  Build 10a:MDW_Internal.h
 *     19 MAY 2022 jcs  Build 14: mddFldDef._i32 = _maxLen
 *     29 OCT 2022 jcs  Build 16: hash_map; No mo _ddb
+*     17 OCT 2026 jcs  Build 22: Dense _ddb[]; _gfifId for sparse / negative
 *
-*  (c) 1994-2022, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <MDW_Internal.h>
 
@@ -31,6 +32,8 @@ using namespace MDDWIRE_PRIVATE;
 Schema::Schema( const char *pDef ) :
    _minFid( INFINITEs ),
    _maxFid( 0 ),
+   _ddb( (mddFldDef **)0 ),
+   _nDdb( 0 ),
    _gfifId(),
    _gfifStr()
 {
@@ -79,6 +82,18 @@ Schema::Schema( const char *pDef ) :
       def          = (*it).second;
       _fl._flds[i] = def->_mdd;
    }
+
+   // Dense by FID : 0 <= fid < _MAX_DENSE_FID; Rest from _gfifId
+
+   _nDdb = Size() ? WithinRange( 0, _maxFid+1, _MAX_DENSE_FID ) : 0;
+   _ddb  = _nDdb ? new mddFldDef *[_nDdb] : (mddFldDef **)0;
+   if ( _ddb )
+      ::memset( _ddb, 0, _nDdb * sizeof( mddFldDef * ) );
+   for ( it=vdb.begin(); it!=vdb.end(); it++ ) {
+      fid = (*it).first;
+      if ( InRange( 0, fid, _nDdb-1 ) )
+         _ddb[fid] = (*it).second;
+   }
 }
 
 Schema::~Schema()
@@ -91,6 +106,8 @@ Schema::~Schema()
    _gfifStr.clear();
    if ( _fl._flds )
       delete[] _fl._flds; 
+   if ( _ddb )
+      delete[] _ddb;
 }
 
 
@@ -116,6 +133,8 @@ mddFldDef *Schema::GetDef( int fid )
 
    // Quickest : Array; Next quickest : map
 
+   if ( InRange( 0, fid, _nDdb-1 ) )
+      return _ddb[fid];
    def = (mddFldDef *)0;
    if ( (it=v.find( fid )) != v.end() )
       def = (*it).second;
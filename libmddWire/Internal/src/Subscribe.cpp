@@ -15,8 +15,9 @@
 *     23 MAY 2022 jcs  Build 14: mddFld_unixTime
 *     28 OCT 2022 jcs  Build 16: mddFld_vector
 *     12 SEP 2024 jcs  Build 21: _Binary_ParseHdr() : Gracefully handle bad msg
+*     17 OCT 2026 jcs  Build 22: _MF_Parse() : No string copy unless CanLog()
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <MDW_Internal.h>
 #include <GLedgDTD.h>
@@ -104,12 +105,11 @@ int Subscribe::_MF_Parse( mddMsgBuf b, mddWireMsg &r )
 
    // 2) Log, if required
 
-   if ( _log ) {
+   if ( _log && _log->CanLog( 1 ) ) {
       Locker lck( _log->mtx() );
-      string s( b._data, nb );
 
       _log->logT( 1, "[MF-RX %06d bytes]\n    ", nb );
-      _log->HexLog( 4, s.c_str(), nb );
+      _log->HexLog( 4, b._data, nb );
    }
 
    /*
@@ -1,4 +1,4 @@
 #if !defined(_MDW_LIB_BLD)
-#define _MDW_LIB_BLD "21"
+#define _MDW_LIB_BLD "22"
 #endif // !defined(_MDW_LIB_BLD)
 
@@ -18,8 +18,9 @@
 *     24 OCT 2022 jcs  Build 15: bld.hpp
 *      1 NOV 2022 jcs  Build 16: mddFld_vector; mddWire_vectorSize; 64-bit mddReal
 *     16 MAR 2024 jcs  Build 20: mddWire_RealToDouble() / mddWire_DoubleToReal()
+*     17 OCT 2026 jcs  Build 22: mddMsgTemplate; mddPub_BuildMsgFromTemplate()
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 /** 
  * \mainpage libmddWire API Reference Manual
@@ -390,6 +391,26 @@ typedef struct
    int          _hdrLen;
 } mddMsgHdr;
 
+/**
+ * \struct mddMsgTemplate
+ * \brief Per-stream message header encoded once by 
+ * mddPub_BuildMsgTemplate() and re-used by mddPub_BuildMsgFromTemplate()
+ *
+ * The tag, data type and protocol are encoded once.  The message type, 
+ * time, RTL and length are filled in on each message.  mddProto_Binary only.
+ */
+typedef struct
+{
+   /** \brief Pre-encoded header bytes */
+   char         _hdr[16];
+   /** \brief Number of valid bytes in _hdr; 0 if not built */
+   int          _hdrLen;
+   /** \brief Protocol this template was built for */
+   mddProtocol  _proto;
+   /** \brief Message tag - int */
+   u_int        _iTag;
+} mddMsgTemplate;
+
 
 /**
  * \struct mddWireMsg
@@ -606,6 +627,41 @@ mddBuf mddPub_BuildRawMsg( mddWire_Context cxt,
  */
 mddBuf mddPub_SetHdrTag( mddWire_Context cxt, u_int tag, mddBuf *bld );
 
+/**
+ * \brief Encodes the per-stream portion of a message header once.
+ *
+ * Call once per stream - e.g., when the stream is opened - and pass the 
+ * returned template to mddPub_BuildMsgFromTemplate() for each message.
+ * Rebuild the template if mddWire_SetProtocol() changes the protocol.
+ *
+ * \param cxt - Context from mddPub_Initialize()
+ * \param hdr - Initialized message header with tag and data type set
+ * \return Template; _hdrLen is 0 unless protocol is mddProto_Binary
+ */
+mddMsgTemplate mddPub_BuildMsgTemplate( mddWire_Context cxt, mddMsgHdr hdr );
+
+/**
+ * \brief Builds a message from a template and any field list added 
+ * via mddPub_AddFieldList().
+ *
+ * Only the message type, time, RTL and length are encoded; The rest of 
+ * the header is copied from the template.  Returns an empty buffer, and 
+ * leaves the field list intact, if the template does not match the 
+ * current protocol or outbuf is headerless; Call mddPub_BuildMsg() instead.
+ *
+ * \param cxt - Context from mddPub_Initialize()
+ * \param tmpl - Template from mddPub_BuildMsgTemplate()
+ * \param mt - Message type
+ * \param RTL - Record Transaction Level
+ * \param outbuf - Reusable buffer used to build the message.
+ * \return Buffer containing built message
+ */
+mddBuf mddPub_BuildMsgFromTemplate( mddWire_Context cxt,
+                                    mddMsgTemplate *tmpl,
+                                    mddMsgType      mt,
+                                    u_int           RTL,
+                                    mddBldBuf      *outbuf );
+
 /**
  * \brief Destroy workspace used for building outgoing messages
  *
@@ -6,6 +6,8 @@
 *      5 JAN 2024 jcs  Created (from Socket.h)
 *      7 NOV 2024 jcs  Build 74: SetRawLog()
 *     11 JUN 2026 jcs  Build 79: virtual Grow()
+*     17 OCT 2026 jcs  Build 80: SetNonBlocking(); nSysCall()
+*     17 OCT 2026 jcs  Build 80: GatherBuffer; PushRef(); nCopy()
 *
 *  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
@@ -13,17 +15,23 @@
 #define __EDGLIB_BUFFER_H
 #include <librtEdge.h>
 #include <EDG_GLmmap.h>
+#include <deque>
 
 // EDG_Internal.h
 
 #ifdef WIN32
 #define READ(fd,b,sz)  ::recv( fd, (b), (sz), 0 )
 #define WRITE(fd,b,sz) ::send( fd, (b), (sz), 0 )
+#define _NB_RDFLAGS    0
+#define _NB_WRFLAGS    0
 #include <winsock.h>
 #else
 #define READ(fd,b,sz)  ::read( fd, (b), (sz) )
 #define WRITE(fd,b,sz) ::write( fd, (b), (sz) )
+#define _NB_RDFLAGS    MSG_DONTWAIT
+#define _NB_WRFLAGS    ( MSG_DONTWAIT | MSG_NOSIGNAL )
 #include <sys/socket.h>
+#include <sys/uio.h>
 #endif // WIN32
 
 #define b_gmax( a,b )          ( ((a)>=(b)) ? (a) : (b) )
@@ -31,6 +39,7 @@
 #define b_InRange( a,b,c )     ( ((a)<=(b)) && ((b)<=(c)) )
 #define b_WithinRange( a,b,c ) ( b_gmin( b_gmax((a),(b)), (c)) )
 #define _MAX_BUF_SIZ   10*K*K // 10 MB
+#define _MAX_GATHER    1024   // Max iovec's per writev()
 
 namespace RTEDGE_PRIVATE
 {
@@ -46,7 +55,10 @@ protected:
 	int       _qAlloc;
 	int       _qMax;
 	u_int64_t _Total;
+	u_int64_t _nSysCall;
+	u_int64_t _nCopy;
 	bool      _bConnectionless;
+	bool      _bNonBlk;
 	FPHANDLE  _rawLog;
 	FPHANDLE  _rawLogRoll;
 
@@ -61,6 +73,9 @@ public:
 	int  &nAlloc() { return _qAlloc; }
 	int  &maxSiz() { return _qMax; }
 	void  SetConnectionless() { _bConnectionless = true; }
+	void  SetNonBlocking( bool bNonBlk ) { _bNonBlk = bNonBlk; }
+	u_int64_t nSysCall() { return _nSysCall; }
+	u_int64_t nCopy()    { return _nCopy; }
 	void  Init( int );
 	rtBUF buf();
 	int   nLeft();
@@ -76,6 +91,8 @@ public:
 	virtual int   bufSz();
 	virtual int   WriteOut( int, int, int );
 	virtual bool  Push( char *, int );
+	virtual bool  PushRef( mddBldBuf &, char *, int );
+	virtual rtBUF lastRef();
 	virtual void  Move( int, int );
 
 	// Helpers
@@ -115,6 +132,50 @@ private:
 
 }; // class CircularBuffer
 
+///////////////////
+// Gather Buffer
+///////////////////
+typedef struct {
+   mddBldBuf _bb;
+   char     *_data;
+   int       _dLen;
+} GatherRef;
+
+typedef std::deque<GatherRef> GatherRefs;
+typedef std::deque<mddBldBuf> BldBufs;
+
+class GatherBuffer : public Buffer
+{
+protected:
+	GatherRefs _refs;
+	BldBufs    _free;
+	rtBUF      _last;
+	int        _off;
+	int        _qSz;
+
+	// Constructor / Destructor
+public:
+	GatherBuffer( int maxSiz=_MAX_BUF_SIZ );
+	~GatherBuffer();
+
+	// Instance-Specific Operations
+
+	virtual bool  Grow( int );
+	virtual void  Reset();
+	virtual int   bufSz();
+	virtual int   WriteOut( int, int, int );
+	virtual bool  Push( char *, int );
+	virtual bool  PushRef( mddBldBuf &, char *, int );
+	virtual rtBUF lastRef() { return _last; }
+	virtual void  Move( int, int ) { ; }
+
+	// Helpers
+private:
+	mddBldBuf _GetFree();
+	void      _Release( int );
+
+}; // class GatherBuffer
+
 } // namespace RTEDGE_PRIVATE
 
 #endif // __EDGLIB_BUFFER_H
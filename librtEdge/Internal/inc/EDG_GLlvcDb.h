@@ -21,8 +21,14 @@
 *     17 MAY 2022 jcs  Build 54: GLlvcDbItem._bActive
 *     13 MAR 2023 jcs  Build 62: GetItem_safe()
 *     26 JUN 2024 jcs  Build 72: _svcFltr / _schemaByName
+*     17 OCT 2026 jcs  Build 80: SnapAll() / GetItemAt() / GLlvcSnapJob; Arena; SnapSince()
+*     17 OCT 2026 jcs  Build 80: SetLockFree(); CopyRecord()
+*     17 OCT 2026 jcs  Build 80: LVC_SIG_006 : GLlvcDbHdr4 / GLlvcIdxHdr
+*     17 OCT 2026 jcs  Build 80: mmap_random; bPopulate
+*     17 OCT 2026 jcs  Build 80: NumRecs() / NumSlots() / RecOffAt() : No _recOffs if indexed
+*     17 OCT 2026 jcs  Build 80: _snapJobs : Persistent GLlvcSnapJob workers
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __EDGLIB_LVC_DB_H
 #define __EDGLIB_LVC_DB_H
@@ -34,11 +40,17 @@
 #define LVC_SIG_003 "004 LVC"
 #define LVC_SIG_004 "005 LVC"
 #define LVC_SIG_005 "006 LVC-BINARY"
+#define LVC_SIG_006 "007 LVC-BIN-IDX"
 #define LVC_MAX_FLD 64*K
 #define LVC_SVCLEN   64
 #define LVC_ITEMLEN 256
 #define LVC_MAXSVC  256
 #define LVC_SVCSEP  "|"
+#define LVC_MIN_SLICE   1024        // Min records per SnapAll() worker
+#define LVC_ARENA_ALIGN 8           // GLlvcArena::Alloc() alignment
+#define LVC_ARENA_BLOCK ( 16*K*K )  // GLlvcArena block size
+#define LVC_STK_COPY    ( 8*K )     // Lock-free : Stack copy of record
+#define LVC_MAX_RETRY   100         // Lock-free : Max torn-read retries
 
 namespace RTEDGE_PRIVATE
 {
@@ -46,9 +58,14 @@ namespace RTEDGE_PRIVATE
 // Forwards
 
 class Cockpit;
+class GLlvcArena;
+class GLlvcSnapJob;
 class LVCDef;
+class Thread;
 
-typedef vector<Cockpit *> Cockpits;
+typedef vector<Cockpit *>      Cockpits;
+typedef vector<int>            LVCOffsets;
+typedef vector<GLlvcSnapJob *> GLlvcSnapJobs;
 
 /////////////////////////////////////////
 // File layout
@@ -105,6 +122,38 @@ public:
 //   GLlvcDbItem _items[0];
 };
 
+/*
+ * LVC_SIG_006 : On-disk open-addressing index of GLlvcDbItem offsets
+ *
+ * File Layout :
+ *    GLlvcDbHdr4
+ *    GLlvcFldDef _schema[_nFlds]
+ *    LVCint      _slots[_idx._nSlot]   @ _idx._slotOff
+ *    GLlvcDbItem _items[]
+ *
+ * Slot = GLlvcDb::HashKey( svc, tkr ) & ( _nSlot-1 ); Linear probe.
+ * Empty slot is 0.  Writer stores the slot after the record, then sets
+ * _idx._freeIdx = GLlvcDbHdr._freeIdx once the index covers all records.
+ * Readers fall back to walking the records if they disagree.
+ */
+class GLlvcIdxHdr
+{
+public:
+   LVCint _nSlot;    // Power of 2
+   LVCint _slotOff;  // File offset of _slots[]
+   LVCint _freeIdx;  // GLlvcDbHdr._freeIdx when index last updated
+   LVCint _nRec;     // Records in index
+};
+
+class GLlvcDbHdr4 : public GLlvcDbHdr3
+{
+public:
+   GLlvcIdxHdr _idx;
+//   GLlvcFldDef _schema[_nFlds];
+//   LVCint      _slots[_idx._nSlot];
+//   GLlvcDbItem _items[0];
+};
+
 class GLlvcDbItem
 {
 public:
@@ -153,34 +202,56 @@ protected:
 	Str2IntMap  _schemaByName;
 	SchemaList  _schema;
 	RecMap      _recs;
+	LVCOffsets  _recOffs;
 	string      _name;
 	LVCint      _freeIdx;
+	int         _nIdxRec;
 	Mutex       _mtx;
 	bool        _bFullCopy;
+	bool        _bLockFree;
 	Semaphore  *_lock;
 	bool        _locked;
 	bool        _bBinary;
+	bool        _bIdx;
+	bool        _bIdxOK;
+	int         _schemaOff;
+	int         _recOff;
 	Cockpits    _cockpits;
+	Mutex         _snapMtx;
+	GLlvcSnapJobs _snapJobs;
 
 	// Constructor / Destructor
 public:
-	GLlvcDb( LVCDef &, bool, DWORD waitMillis=INFINITE );
+	GLlvcDb( LVCDef &, bool, DWORD waitMillis=INFINITE, bool bPopulate=false );
 	~GLlvcDb();
 
 	// Access
 
 	GLlvcDbHdr  &db();
 	GLlvcDbHdr3 &db3();
+	GLlvcDbHdr4 &db4();
 	GLlvcFldDef *fdb();
+	LVCint      *slots();
 	RecMap      &recs();
+	LVCOffsets  &recOffs();
+	int          NumRecs();
+	int          NumSlots();
+	int          RecOffAt( int );
+	bool         IsIndexed();
 	bool         IsLocked();
+	bool         IsLockFree();
 	int          FieldLen( int );
 	int          FieldOffset( int );
 	bool         CanAddField( int );
 	bool         CanAddItem( const char *, const char * );
 	LVCData      GetItem( const char *, const char *, Bool );
 	LVCData      GetItem_safe( const char *, const char *, Bool );
+	LVCData      GetItemAt( int, Bool, GLlvcArena *arena=NULL );
+	int          SnapAll( LVCData *, int nThr=1, char **arena=NULL );
+	int          SnapOffsets( LVCOffsets &, LVCData *, int, char ** );
+	double       GetChanged( double, LVCOffsets & );
 	int          SetFilter( const char *, const char **svcs=NULL );
+	void         SetLockFree( bool );
 	Bool         IsBinary();
 	Mutex       &mtx();
 	int          _uSz();
@@ -193,12 +264,85 @@ public:
 	// Helpers
 private:
 	void    Load();
-	rtFIELD GetField( GLlvcFldHdr &, char *, int, Bool, char * );
+	int     FindIdx( const char *, const char * );
+	Bool    CopyRecord( GLlvcDbItem *, char *, int );
+	rtFIELD GetField( GLlvcFldHdr &, char *, int, Bool, char *, GLlvcArena * );
 	string  MapKey( const char *, const char * );
 
+	// Class-wide
+public:
+	static u_int HashKey( const char *, const char * );
+	static int   FindSlot( char *, LVCint *, int, int, const char *, const char * );
+
 }; // class GLlvcDb
 
 
+/////////////////////////////////////////
+// SnapAll() arena : Chain of LVC_ARENA_BLOCK blocks; [ next ][ data ]
+/////////////////////////////////////////
+class GLlvcArena
+{
+private:
+	char *_blk;
+	char *_cp;
+	char *_ep;
+
+	// Constructor / Destructor
+public:
+	GLlvcArena();
+
+	// Operations
+
+	char *Alloc( size_t );
+	char *Detach( char * );
+
+}; // class GLlvcArena
+
+
+/////////////////////////////////////////
+// SnapAll() worker : tkrs[beg, end)
+//
+// Owned by GLlvcDb for its lifetime; Parked on _go between SnapAll()'s.
+// Slice from Set(), then Start() / Join().  No thread : Caller Run()'s.
+/////////////////////////////////////////
+class GLlvcSnapJob
+{
+private:
+	GLlvcDb      &_lvc;
+	LVCOffsets   *_offs;
+	LVCData      *_tkrs;
+	GLlvcArena   *_arena;
+	bool          _bArena;
+	int           _beg;
+	int           _end;
+	Semaphore     _go;
+	Semaphore     _done;
+	volatile bool _bStop;
+	Thread       *_thr;
+
+	// Constructor / Destructor
+public:
+	GLlvcSnapJob( GLlvcDb &, bool bThr );
+	~GLlvcSnapJob();
+
+	// Access
+
+	GLlvcArena *arena();
+
+	// Operations
+
+	void Set( LVCOffsets &, LVCData *, bool, int, int );
+	void Start();
+	void Join();
+	void Run();
+
+	// Class-wide
+
+	static void EDGAPI _Run( void * );
+
+}; // class GLlvcSnapJob
+
+
 /////////////////////
 // LVC Config Def'n
 /////////////////////
@@ -209,10 +353,12 @@ private:
 	GLlvcDb *_lvc;
 public:
 	bool     _bFullCopy;
+	int      _nSnapThr;
+	bool     _bArena;
 
 	// Constructor / Destructor
 public:
-	LVCDef( const char *, bool, DWORD );
+	LVCDef( const char *, bool, DWORD, bool bPopulate=false );
 	~LVCDef();
 
 	// Access / Operations
@@ -221,6 +367,9 @@ public:
 	char    *pFile();
 	int      SetFilter( const char *, const char **svcs=NULL );
 	void     SetCopyType( bool );
+	void     SetSnapThreads( int );
+	void     SetArena( bool );
+	void     SetLockFree( bool );
 
 }; // class LVCDef
 
@@ -14,8 +14,9 @@
 *     12 OCT 2017 jcs  Build 36: u_int64_t siz(); _w32XxSz / _w32FileMapping()
 *      7 NOV 2017 jcs  Build 38: pFile()
 *     12 JAN 2024 jcs  Build 67: TapeHeader.h
+*     17 OCT 2026 jcs  Build 80: advise(); populate(); willNeed(); touch(); PageFaults()
 *
-*  (c) 1994-2024, Gatea Ltd. 
+*  (c) 1994-2026, Gatea Ltd. 
 ******************************************************************************/
 #ifndef __EDGLIB_GLMMAP_H
 #define __EDGLIB_GLMMAP_H
@@ -40,6 +41,7 @@
 #define GLfileno(c)          (c)
 #else
 #include <sys/mman.h>
+#include <sys/resource.h>
 #include <unistd.h>
 #define MMAP_FD               int
 #define FPHANDLE              FILE *
@@ -84,6 +86,16 @@ using namespace std;
 ///////////////////////////////////////////
 namespace RTEDGE_PRIVATE
 {
+
+/////////////////////////////////////////
+// Access pattern : madvise() on every map()
+/////////////////////////////////////////
+typedef enum {
+   mmap_normal     = 0,
+   mmap_sequential = 1,
+   mmap_random     = 2
+} GLmmapAdvice;
+
 class GLmmap
 {
 protected:
@@ -102,6 +114,8 @@ protected:
 	int       _errno;
 	DWORD     _w32LoSz;
 	DWORD     _w32HiSz;
+	GLmmapAdvice _advice;
+	Bool         _bPopulate;
 
 	// Constructor / Destructor
 public:
@@ -133,13 +147,19 @@ public:
 	u_int64_t   siz();
 	u_int64_t   offset();
 	int         error();
+	GLmmapAdvice advice();
 
 	// Operations
 
-	char *map( u_int64_t off=0, u_int64_t len=0, char *addr=0 );
-	void  unmap();
+	char     *map( u_int64_t off=0, u_int64_t len=0, char *addr=0 );
+	void      unmap();
+	void      advise( GLmmapAdvice );
+	void      populate( Bool );
+	void      willNeed( u_int64_t, u_int64_t );
+	u_int64_t touch( u_int64_t, u_int64_t );
 private:
 	Bool  _w32FileMapping( u_int64_t );
+	void  _madvise();
 
 	// Platform-Independent File Operations
 public:
@@ -154,6 +174,8 @@ public:
 	static u_int64_t Stat( FPHANDLE );
 	static void      Flush( FPHANDLE );
 	static int       GetPageSize();
+	static int       SysPageSize();
+	static void      PageFaults( u_int64_t &, u_int64_t & );
 };
 
 /////////////////////////////////////////
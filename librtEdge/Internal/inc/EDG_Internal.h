@@ -30,8 +30,9 @@
 *     24 OCT 2022 jcs  Build 58: No extern "C" wrapping librtEdge.h : Cockpit.hpp
 *     12 JAN 2024 jcs  Build 67: Buffer.h; TapeHeader.h
 *     26 JUN 2024 jcs  Build 72: FIDs / FIDSet
+*     17 OCT 2026 jcs  Build 80: ATOMIC_BARRIER()
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __EDGLIB_INTERNAL_H
 #define __EDGLIB_INTERNAL_H
@@ -187,6 +188,7 @@ extern "C"
               InterlockedExchange( (LONG *)pDest, newVal )
 #define ATOMIC_CMP_EXCH( pDest, oldVal, newVal )  \
               InterlockedCompareExchange( (LONG *)pDest, newVal, oldVal )
+#define ATOMIC_BARRIER()              MemoryBarrier()
 #else
 #define ATOMIC_INC( pDest )           __sync_add_and_fetch( pDest, 1 )
 #define ATOMIC_DEC( pDest )           __sync_sub_and_fetch( pDest, 1 )
@@ -196,6 +198,7 @@ extern "C"
               __sync_lock_test_and_set( pDest, newVal )
 #define ATOMIC_CMP_EXCH( pDest, oldVal, newVal )  \
               __sync_val_compare_and_swap( pDest, oldVal, newVal )
+#define ATOMIC_BARRIER()              __sync_synchronize()
 #endif // WIN32
 } // extern "C"
 
@@ -25,15 +25,23 @@
 *     26 JUN 2024 jcs  Build 72: FIDSet in EDG_Internal.h
 *     22 DEC 2024 jcs  Build 74: ConnCbk()
 *      4 FEB 2025 jcs  Build 75: _OnRead()
+*     17 OCT 2026 jcs  Build 80: DispatchBatch(); protected _OnRead(); FidDef
+*     17 OCT 2026 jcs  Build 80: _nTapeThr; _bTapeOrdered
+*     17 OCT 2026 jcs  Build 80: ioctl_udpSubscribe : _OnUDP(); _udpSeq
+*     17 OCT 2026 jcs  Build 80: _OnUDP( const char *, int )
+*     17 OCT 2026 jcs  Build 80: TapeExport()
+*     17 OCT 2026 jcs  Build 80: _tapePrefetch
+*     17 OCT 2026 jcs  Build 80: _dsp : DispatchBatch() from EventPump.GetBatch()
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __EDGLIB_CHANNEL_H
 #define __EDGLIB_CHANNEL_H
 #include <EDG_Internal.h>
 #include <EDG_GLrecDb.h>
 
-#define MAX_FLD 128*K
+#define MAX_FLD        128*K
+#define _MAX_DENSE_FID  64*K
 
 namespace RTEDGE_PRIVATE
 {
@@ -56,6 +64,18 @@ typedef hash_map<string, EdgSvc *>    SvcMap;
 typedef hash_map<string, EdgRec *>    RecByNameMap;
 typedef hash_map<int, EdgRec *>       RecByIdMap;
 typedef hash_map<int, rtFIELD>        FieldMap;
+typedef hash_map<int, string>         UdpTkrMap;
+
+/////////////////////////////////////////
+// Schema compiled once : Dense by FID
+/////////////////////////////////////////
+typedef struct {
+	const char *_name;
+	rtFldType   _type;
+	int         _off;  // Offset in GetSchema()._flds
+} FidDef;
+
+typedef hash_map<int, FidDef>         FidDefMap;
 
 
 /////////////////////////////////////////
@@ -72,6 +92,9 @@ protected:
 	SvcMap         _svcs;
 	RecByIdMap     _recs;
 	rtEdgeData    *_schema;
+	FidDef        *_fidTbl;
+	int            _nFidTbl;
+	FidDefMap      _fidOvfl;
 	rtEdgeData     _zzz;
 	int            _subscrID;
 	int            _pumpID;
@@ -83,10 +106,20 @@ protected:
 	bool           _bRawData;
 	bool           _bSvcTkr;
 	bool           _bUsrStreamID;
+	double         _udpRefresh; // Min secs between <GetCache/>; 0 = Off
+	char           _udpSession[10];
+	u_int64_t      _udpSeq;     // Next expected; 0 = None yet
+	double         _tUdpRefresh;
+	UdpTkrMap      _udpTkrs;    // Publisher StreamID -> Ticker
+	RecByIdMap     _udpRecs;    // Publisher StreamID -> EdgRec
 public:
 	bool           _bTapeDir;
+	int            _nTapeThr;
+	bool           _bTapeOrdered;
+	u_int64_t      _tapePrefetch; // Bytes ahead of reader; 0 = Off
 protected:
 	EventPump      _Q;
+	Updates        _dsp;
 	TapeChannel   *_tape;
 
 	// Constructor / Destructor
@@ -113,6 +146,8 @@ public:
 	rtEdgeData GetSchema();
 	mddField  *GetDef( int );
 	mddField  *GetDef( const char * );
+	FidDef    *GetFidDef( int );
+	const char*FidName( int );
 	rtFIELD   *GetField( const char * );
 	rtFIELD   *GetField( int );
 	bool       HasField( const char * );
@@ -133,11 +168,13 @@ public:
 	void Close( EdgRec & );
 	int  StartPumpFullTape( u_int64_t, int );
 	int  StopPumpFullTape( int );
+	u_int64_t TapeExport( const char *, const char *, const char *, const char *, const char * );
 
 	// Operations - Conflation
 
 	void Conflate( bool );
 	int  Dispatch( int, double );
+	int  DispatchBatch( rtEdgeData *, int, double );
 	int  Read( double, rtEdgeRead & );
 
 	// Socket Interface
@@ -150,8 +187,8 @@ protected:
 	virtual void OnConnect( const char * );
 	virtual void OnDisconnect( const char * );
 	virtual void OnRead();
-private:
 	void         _OnRead();
+	void         _OnUDP( const char *, int );
 
 	// TimerEvent Notifications
 protected:
@@ -172,8 +209,14 @@ protected:
 
 	// Helpers
 protected:
-	void _ClearUpd();
-	void _ClearSchema();
+	void    _ClearUpd();
+	void    _ClearSchema();
+	void    _BuildFidTbl();
+	bool    _SetConflated( rtEdgeData &, Update &, rtFIELD *, int );
+	void    _OnUdpMsg( const char *, int );
+	void    _OnUdpStreamID( mddMsgBuf );
+	void    _OnUdpGap( u_int64_t );
+	EdgRec *_GetUdpRec( int );
 
 	// Idle Loop Processing ...
 public:
@@ -10,6 +10,7 @@
 *     12 OCT 2015 jcs  Build 32: EDG_Internal.h
 *     25 JAN 2022 jcs  Build 51: pthread_t as 64-bit on WINxx
 *      8 JUN 2026 jcs  Build 79: Mutex.Lock() like GFC2; ::int64_t _cnt
+*     17 OCT 2026 jcs  Build 80: Locker( Mutex &, bool )
 *
 *  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
@@ -126,6 +127,7 @@ protected:
 	// Constructor / Destructor
 public:
 	Locker( Mutex & );
+	Locker( Mutex &, bool );
 	~Locker();
 };
 
@@ -20,8 +20,10 @@
 *     12 SEP 2017 jcs  Build 35: No mo GLHashMap
 *     12 FEB 2020 jcs  Build 42: Socket._tHbeat
 *     22 DEC 2024 jcs  Build 74: ConnCbk()
+*     17 OCT 2026 jcs  Build 80: PublishBatch()
+*     17 OCT 2026 jcs  Build 80: PubRec._tmpl
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __EDGLIB_PUB_CHANNEL_H
 #define __EDGLIB_PUB_CHANNEL_H
@@ -74,7 +76,8 @@ public:
 	// Operations
 
 	void  InitSchema( rtEdgeDataFcn );
-	int   Publish( rtEdgeData & );
+	int   Publish( rtEdgeData &, bool bFlush=true );
+	int   PublishBatch( rtEdgeData *, int );
 	int   PubError( rtEdgeData &, const char * );
 	rtBUF PubGetData();
 private:
@@ -137,6 +140,7 @@ public:
 	int         _nOpn;
 	int         _nImg;
 	int         _nUpd;
+	mddMsgTemplate _tmpl;
 
 	// Constructor / Destructor
 public:
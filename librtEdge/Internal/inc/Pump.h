@@ -10,8 +10,12 @@
 *     12 OCT 2015 jcs  Build 32: EDG_Internal.h
 *     11 SEP 2023 jcs  Build 32: _className
 *      5 OCT 2023 jcs  Build 65: poll() only
+*     17 OCT 2026 jcs  Build 80: EPollMap; PollMap grows
+*     17 OCT 2026 jcs  Build 80: SetSpin()
+*     17 OCT 2026 jcs  Build 80: RemoveIdle( fcn, arg )
+*     17 OCT 2026 jcs  Build 80: SetWritable( Socket *, bool ) per fd; No EPollWr
 *
-*  (c) 1994-2023, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef _EDGLIB_PUMP_H
 #define _EDGLIB_PUMP_H
@@ -19,8 +23,15 @@
 #if !defined(_WIN32) && !defined(_WIN64)
 #include <sys/poll.h>
 #endif // !defined(_WIN32) && !defined(_WIN64)
+#if defined(linux)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#endif // defined(linux)
 
-#define _MAX_POLLFD   64  // < 64 channels / thread
+#define _MAX_POLLFD   64  // Initial PollMap size; Grows as needed
+#define _MAX_EPOLLEVT 256 // Events per epoll_wait()
+#define _MIN_EPOLLFD  8   // epoll() once Pump carries this many Sockets
 
 #if defined(WIN32)
 typedef struct pollfd {
@@ -59,6 +70,7 @@ namespace RTEDGE_PRIVATE
 ////////////////////////
 // Forward declarations
 ////////////////////////
+class EPollMap;
 class PollMap;
 class Socket;
 class Thread;
@@ -77,6 +89,8 @@ typedef vector<TimerEvent *>    TimerTable;
 /////////////////////////////////////////
 class Pump
 {
+public:
+	static bool _bEPoll;
 protected:
 	Sockets    _sox;
 	TimerTable _tmrs;
@@ -84,6 +98,7 @@ protected:
 	IdleFcns   _idle;
 	Mutex      _mtx;
 	PollMap   *_pollMap;
+	EPollMap  *_ePoll;
 	int        _maxFd;
 #ifdef WIN32
 public:
@@ -92,6 +107,7 @@ public:
 #endif // WIN32
 protected:
 	bool      _bRun;
+	bool      _bSpin;
 	double    _t0;
 
 	// Constructor / Destructor
@@ -103,6 +119,8 @@ public:
 
 	Mutex &mtx() { return _mtx; }
 	bool   IsRunning() { return _bRun; }
+	bool   IsEPoll() { return( _ePoll != (EPollMap *)0 ); }
+	bool   IsSpin() { return _bSpin; }
 
 	// Socket Operations
 
@@ -122,12 +140,18 @@ public:
 	void Run( double dPoll );
 	void Stop();
 	void AddIdle( EdgIdleFcn, void * ); 
-	void RemoveIdle( EdgIdleFcn );
+	void RemoveIdle( EdgIdleFcn, void * );
+	void Wake();
+	void SetSpin( bool );
+	void SetWritable( Socket *, bool );
 
 	// Helpers
 private:
 	void _Create();
 	void _Destroy();
+	bool _UseEPoll();
+	void _RunEPoll( double );
+	void _RunSpin( double );
 	int  buildFDs();
 
 	// WIN32 Handlers
@@ -169,6 +193,49 @@ public:
 	void Reset();
 };
 
+#if defined(linux)
+/////////////////////////////////////////
+// epoll()-based map : Linux only
+/////////////////////////////////////////
+/*
+ * Sockets added / removed incrementally.  Reads are edge-triggered except
+ * on connectionless sockets, which read 1 datagram per OnRead().  EPOLLOUT
+ * is armed / disarmed per fd by Socket.Write() / OnWrite() when its out 
+ * queue goes non-empty / empty.  _tmrFd drives _OnTimer(); _wakeFd wakes 
+ * epoll_wait() from another thread.
+ */
+class EPollMap
+{
+protected:
+	int                 _epFd;
+	int                 _tmrFd;
+	int                 _wakeFd;
+	struct epoll_event *_evts;
+
+	// Constructor / Destructor
+public:
+	EPollMap();
+	~EPollMap();
+
+	// Access
+
+	bool                IsValid();
+	struct epoll_event *evts();
+	int                 tmrFd();
+	int                 wakeFd();
+
+	// Operations
+
+	void Add( Socket * );
+	void Remove( int );
+	void SetWritable( Socket *, bool );
+	void SetTimer( double );
+	bool Wake();
+	bool Drain( int );
+	int  Wait();
+};
+#endif // defined(linux)
+
 
 } // namespace RTEDGE_PRIVATE
 
@@ -9,8 +9,11 @@
 *     12 NOV 2014 jcs  Build 28: Record._fl
 *     12 OCT 2015 jcs  Build 32: EDG_Internal.h
 *     24 AUG 2017 jcs  Build 35: hash_map
+*     17 OCT 2026 jcs  Build 80: EventPump ring; GetUpds() batch drain; HasUpds()
+*     17 OCT 2026 jcs  Build 80: EventPump.mtx(); GetBatch(); Unget()
+*     17 OCT 2026 jcs  Build 80: Record._fdb : Dense by FID
 *
-*  (c) 1994-2017 Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __EDGLIB_CACHE_H
 #define __EDGLIB_CACHE_H
@@ -26,6 +29,15 @@
 #define EVT_STS    0x0010
 #define EVT_SCHEMA 0x0020
 
+// EventPump ring / batch drain
+
+#define _EVT_RING_SZ   1024
+#define _EVT_MAX_BATCH 4096
+
+// Record : Dense Field * by FID in [ 0, _REC_DENSE_FID ); Rest in _flds
+
+#define _REC_DENSE_FID K
+
 namespace RTEDGE_PRIVATE
 {
 
@@ -96,6 +108,7 @@ protected:
    int          _StreamID;
    Mutex        _mtx;
    FldMap       _flds;
+   FldList      _fdb;
    FldUpds      _upds;
 public:
    mddFieldList _fl;
@@ -113,7 +126,8 @@ public:
    const char  *pTkr();
    int          StreamID();
    Field       *GetField( int );
-   int          GetUpds( rtFIELD * );
+   int          GetUpds( rtFIELD *, int maxFld=INFINITEs );
+   bool         HasUpds();
    mddFieldList GetCache();
 
    // Real-Time Data
@@ -123,12 +137,24 @@ public:
 
 /////////////////////////////////////////
 // Event Pump
+//
+// Conflated updates are queued in a power-of-2 ring : O(1) enqueue and 
+// dequeue.  GetOneUpd() drains up to _EVT_MAX_BATCH updates into _batch
+// with one ring walk; _batch cursor is guarded by _updMtx, as Close() may 
+// invalidate undispatched entries from another thread.  GetBatch() hands
+// out many at once : Caller holds mtx() until done with them, and Unget()'s
+// the rest back to _batch.
 /////////////////////////////////////////
 class EventPump
 {
 protected:
    Mutex   _updMtx;
-   Updates _upds;
+   Update *_ring;
+   int     _nAlloc;
+   int     _beg;
+   int     _nQ;
+   Updates _batch;
+   size_t  _iBatch;
    Event   _evt;
 
    // Constructor / Destructor
@@ -136,17 +162,30 @@ public:
    EventPump();
    ~EventPump();
 
+   // Access
+
+   Mutex &mtx();
+   int    QueueSize();
+   bool   HasUpds();
+
    // Operations
 
    void Add( Update & );
    void AddAndNotify( Update & );
    bool GetOneUpd( Update & );
+   int  GetUpds( Updates &, int );
+   int  GetBatch( Updates &, int );
+   void Unget( Updates &, size_t );
    void Close( Record * );
 
    // Threading Synchronization
 
    void Notify();
    void Wait( double );
+
+   // Helpers
+private:
+   void _Grow();
 };
 
 } // namespace RTEDGE_PRIVATE
@@ -25,6 +25,16 @@
 *     22 DEC 2024 jcs  Build 74: ConnCbk()
 *      4 FEB 2025 jcs  Build 75: ReadOnce(); _bLowLatency
 *      5 JUN 2025 jcs  Build 79: OneOff
+*     17 OCT 2026 jcs  Build 80: IsConnectionless(); _IsEOF(); _bNonBlkIO
+*     17 OCT 2026 jcs  Build 80: _busyPollUs
+*     17 OCT 2026 jcs  Build 80: _udpQ; _PushUDP() / _FlushUDP()
+*     17 OCT 2026 jcs  Build 80: _src
+*     17 OCT 2026 jcs  Build 80: _rxQ; _RecvUDP()
+*     17 OCT 2026 jcs  Build 80: _SetGatherIO()
+*     17 OCT 2026 jcs  Build 80: Write( ..., bFlush )
+*     17 OCT 2026 jcs  Build 80: _bSharedPump; StopThread()
+*     17 OCT 2026 jcs  Build 80: CMsgBuf _rxCtl
+*     17 OCT 2026 jcs  Build 80: _bWrArm; _ArmWrite()
 *
 *  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
@@ -47,6 +57,12 @@ class Thread;
 
 typedef vector<string *>   Hosts;
 typedef vector<int>        Ports;
+typedef vector<Mold64Pkt>  Mold64Pkts;
+#if defined(linux)
+typedef vector<mmsghdr>    MMsgHdrs;
+typedef vector<iovec>      IOVecs;
+typedef vector<char>       CMsgBuf;
+#endif // defined(linux)
 
 /////////////////////////////////////////
 // Synchronized Access Check
@@ -88,8 +104,10 @@ class Socket : public TimerEvent
 friend class Pump; 
 public:
 	static Logger     *_log;
+	static bool        _bSharedPump;
 protected:
 	Thread            *_thr;
+	bool               _bShThr;
 	bool               _bConnectionless;
 	mddWire_Context    _mdd;
 	mddProtocol        _proto;
@@ -103,6 +121,7 @@ protected:
 	Ports              _ports;
 	int                _udpPort; // Local
 	struct sockaddr_in _dst;
+	struct sockaddr_in _src; // Connectionless : Last sender
 	string             _dstConn;
 	volatile int       _fd;
 	bool               _bStart;
@@ -118,12 +137,32 @@ protected:
 	bool               _bRandomize;
 	bool               _bIdleCbk;
 	bool               _bLowLatency;
+	bool               _bNonBlkIO;
+	bool               _bWrArm;
 	Mutex              _ovrFloMtx;
 	string             _overflow;
 	int                _tHbeat;
 	int                _SO_RCVBUF;
 	int                _bufIO;
+	int                _busyPollUs;
 	Mold64Pkt          _udp;
+	Mold64Pkts         _udpQ;
+	Ports              _udpLen;
+	int                _nUdpQ;
+	int                _udpBatch;
+	double             _udpFlush;
+	double             _tUdpQ;
+	Mold64Pkts         _rxQ;
+	Ports              _rxLen;
+	int                _rxBatch;
+	u_int              _rxOvfl;
+#if defined(linux)
+	MMsgHdrs           _udpMsgs;
+	IOVecs             _udpIOV;
+	MMsgHdrs           _rxMsgs;
+	IOVecs             _rxIOV;
+	CMsgBuf            _rxCtl;
+#endif // defined(linux)
 	::int64_t          sync_out;
 	::int64_t          sync_wr;
 
@@ -136,11 +175,13 @@ public:
 
 	Thread     &thr();
 	Pump       &pump();
+	void        StopThread();
 	Mutex      &mtx();
 	Buffer     &oBuf();
 	const char *dstConn();
 	int         fd();
 	bool        IsCache();
+	bool        IsConnectionless();
 	bool        IsWritable();
 	int         SetRcvBuf( int );
 	int         GetRcvBuf();
@@ -154,7 +195,7 @@ public:
 
 	const char *Connect();
 	bool        Disconnect( const char * );
-	bool        Write( const char *, int );
+	bool        Write( const char *, int, bool bFlush=true );
 
 	// Socket Interface
 
@@ -190,7 +231,20 @@ protected:
 	int  ReadOnce();
 	void setBlocking();
 	int  _GetError();
+	bool _IsEOF( int );
+	void _SetNonBlockingIO( bool );
+	bool _SetGatherIO( bool );
+	void _SetBusyPoll();
+	void _SetUdpBatch( int );
+	bool _SendUDP( const char *, int );
+	bool _PushUDP( const char *, int );
+	int  _FlushUDP( bool bForce=true );
+	void _SetUdpRecv( int );
+	void _SetRxOvfl();
+	int  _RecvUDP();
 	bool NagleOff();
+	void _DetachPump( bool );
+	void _ArmWrite( bool );
 
 }; // class Socket
 
@@ -9,8 +9,15 @@
 *     14 OCT 2022 jcs  PumpOneMsg( ..., bool &bContinue )
 *     12 JAN 2024 jcs  TapeHeader.h
 *     26 JUN 2024 jcs  Build 72: FIDSet in EDG_Internal.h
+*     17 OCT 2026 jcs  Build 80: GLrpyTkrIdxVw
+*     17 OCT 2026 jcs  Build 80: TapePumpJob; TapeMsgBlk
+*     17 OCT 2026 jcs  Build 80: TapeBar; TapeSlice._bBar
+*     17 OCT 2026 jcs  Build 80: Export(); TapeColExport
+*     17 OCT 2026 jcs  Build 80: _SeekIdx(); _PumpTickerWindow(); GLrpyDailyIdxVw.Find()
+*     17 OCT 2026 jcs  Build 80: TapePrefetch; _PageFaults()
+*     17 OCT 2026 jcs  Build 80: TapeMerge; _tapeFile; _kids
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __TAPE_CHANNEL_H
 #define __TAPE_CHANNEL_H
@@ -18,6 +25,7 @@
 #include <TapeHeader.h>
 
 #define MAX_FLD 128*K
+#define TKR_IDX_SIG "001 TKR-IDX"
 
 namespace RTEDGE_PRIVATE
 {
@@ -26,7 +34,13 @@ namespace RTEDGE_PRIVATE
 // Forward declarations
 ////////////////////////
 class GLrpyDailyIdxVw;
+class GLrpyTkrIdxVw;
 class Schema;
+class TapeColExport;
+class TapeMerge;
+class TapeMsgBlk;
+class TapePrefetch;
+class TapePumpJob;
 
 
 /////////////////////////////////////////
@@ -40,19 +54,32 @@ typedef vector<TapeRecHdr *>      TapeRecDb;
 typedef hash_map<int, int>        TapeWatchList;
 typedef hash_map<int, string *>   DeadTickers;
 typedef vector<u_int64_t>         Offsets;
+typedef vector<TapePumpJob *>     TapePumpJobs;
+typedef vector<TapeMsgBlk *>      TapeMsgBlks;
+typedef hash_map<int, int>        TapeBarIdx;
+typedef vector<string>            TapeFiles;
+typedef vector<TapeChannel *>     TapeChannels;
+typedef vector<int>               TapeStreamIDs;
 
 class TapeChannel
 {
 friend class TapeRun;
+friend class TapeColExport;
+friend class TapeMerge;
+friend class TapePumpJob;
+friend class TapeSlice;
 private:
 	EdgChannel      &_chan;
 	rtEdgeAttr       _attr;
+	string           _tapeFile;
 	string           _idxFile;
+	string           _tkrIdxFile;
 	FieldMap         _schema;
 	FieldMapByName   _schemaByName;
 	GLmmap          *_vwHdr;
 	TapeHeader      *_hdr;
 	GLrpyDailyIdxVw *_idx;
+	GLrpyTkrIdxVw   *_tkrIdx;
 	TapeRecords      _rdb;
 	TapeRecDb        _tdb;
 	TapeWatchList    _wl;
@@ -64,12 +91,23 @@ private:
 	int              _nSub;
 	Mutex            _sliceMtx;
 	TapeSlice       *_slice;
+	TapePrefetch    *_pf;
+	u_int64_t        _flt0Min;
+	u_int64_t        _flt0Maj;
+	/*
+	 * Merged : _kids = 2nd ... Nth tape; _mrgIDs = Kid dbIdx -> StreamID
+	 */
+	TapeChannels     _kids;
+	TapeStreamIDs    _mrgIDs;
+	TapeRecords      _mrgRdb;
+	TapeRecDb        _mrgRecs;
+	int              _mrgNext;
 	volatile bool    _bRun;
 	volatile bool    _bInUse;
 
 	// Constructor / Destructor
 public:
-	TapeChannel( EdgChannel & );
+	TapeChannel( EdgChannel &, const char *pFile=(const char *)0 );
 	~TapeChannel();
 
 	// Access
@@ -78,7 +116,10 @@ public:
 	TapeHeader     &hdr();
 	mddWire_Context mdd();
 	const char     *pTape();
+	const char     *pFile();
+	bool            IsMerged();
 	const char     *pIdxFile();
+	const char     *pTkrIdxFile();
 	const char     *err();
 	bool            HasTicker( const char *, const char *, int & );
 	int             GetFieldID( const char * );
@@ -90,6 +131,10 @@ public:
 	int StartPumpFullTape( u_int64_t, int );
 	int StopPumpFullTape( int );
 
+	// Columnar Export
+public:
+	u_int64_t Export( const char *, const char *, const char *, const char *, const char * );
+
 	// Operations
 public:
 	int  Subscribe( const char *, const char * );
@@ -98,29 +143,52 @@ public:
 	int  Pump();
 	void Stop();
 	int  PumpTicker( int );
+	bool BuildTickerIndex();
 	void Unload();
 
 	// Helpers
 private:
 	bool        _LoadHdr();
+	bool        _LoadTkrIdx();
+	bool        _LoadMerged();
 	TapeRecHdr *_GetRecHdr( int );
+	TapeRecHdr *_StreamRec( int );
 	bool        _InTimeRange( GLrecTapeMsg & );
 	bool        _IsWatched( GLrecTapeMsg & );
 	int         _LoadSchema();
 	bool        _ParseFieldList( mddBuf );
+	bool        _ParseFieldList( mddWire_Context, mddFieldList &, mddBuf );
 	int         _PumpDead();
 	void        _PumpStatus( GLrecTapeMsg *, const char *, rtEdgeType ty=edg_recovering, u_int64_t off=0 );
 	int         _PumpSlice( u_int64_t, int );
+	int         _PumpTickerIdx( int, u_int64_t );
+	int         _PumpTickerWindow( int );
+	bool        _WindowCheaper( u_int64_t );
+	void        _PrefetchStart( u_int64_t );
+	void        _PrefetchStop();
+	void        _PageFaults();
 	int         _PumpOneMsg( GLrecTapeMsg &, mddBuf, bool, bool & );
+	bool        _ParseOneMsg( GLrecTapeMsg &, mddBuf, bool, bool &, mddWire_Context, mddFieldList &, rtEdgeData & );
+	int         _DispatchOne( rtEdgeData & );
+	int         _PumpParallel( Offsets & );
+	int         _TapeRanges( u_int64_t, u_int64_t, int, Offsets & );
 	void        _PumpComplete( GLrecTapeMsg *, u_int64_t );
+	int         _PumpBars();
 	string      _Key( const char *, const char * );
 	int         _get32( u_char * );
 	u_int64_t   _get64( u_char * );
 	u_int64_t   _tapeOffset( struct timeval );
-	int         _SecIdx( struct timeval, GLrecTapeRec * );
+	u_int64_t   _SeekIdx( u_int64_t *, u_int64_t, struct timeval );
+	bool        _IsBefore( GLrecTapeMsg &, struct timeval );
+	struct timeval _SliceEnd();
 	void        _BuildFieldMap();
 	void        _ClearFieldMap();
 
+	// Class-wide
+public:
+	static time_t _DayStart( time_t );
+	static int    _TapeFiles( const char *, TapeFiles & );
+
 };  // class TapeChannel
 
 class TapeRun
@@ -137,6 +205,7 @@ public:
 	{
 	   _tape._bRun   = true;
 	   _tape._bInUse = true;
+	   GLmmap::PageFaults( _tape._flt0Min, _tape._flt0Maj );
 	}
 
 	~TapeRun()
@@ -148,6 +217,171 @@ public:
 }; // TapeRun
 
 
+/////////////////////////////////////////
+// Parallel Replay : One contiguous range
+/////////////////////////////////////////
+/*
+ * Parsed messages from one TapePumpJob, delivered in tape order by
+ * the channel thread.  _fOff[i] = -1 : Re-parse _msgs[i]._rawData.
+ */
+class TapeMsgBlk
+{
+public:
+	vector<rtEdgeData> _msgs;
+	vector<int>        _fOff;
+	vector<rtFIELD>    _flds;
+
+}; // class TapeMsgBlk
+
+class TapePumpJob
+{
+private:
+	TapeChannel    &_tape;
+	mddWire_Context _mdd;
+	mddFieldList    _fl;
+	u_int64_t       _beg;
+	u_int64_t       _end;
+	bool            _bOrdered;
+	Thread         *_thr;
+	Mutex           _mtx;
+	TapeMsgBlks     _blks;
+	volatile bool   _bDone;
+public:
+	int             _nMsg;
+	GLrecTapeMsg   *_last;
+
+	// Constructor / Destructor
+public:
+	TapePumpJob( TapeChannel &, u_int64_t, u_int64_t, bool );
+	~TapePumpJob();
+
+	// Access
+
+	bool        IsDone();
+	TapeMsgBlk *Pop();
+
+	// Operations
+
+	void Start();
+	void Join();
+	void Run();
+private:
+	void _Push( TapeMsgBlk * );
+
+	// Class-wide
+public:
+	static void EDGAPI _Run( void * );
+
+}; // class TapePumpJob
+
+
+/////////////////////////////////////////
+// Tape Prefetch : Touch pages ahead of reader
+/////////////////////////////////////////
+class TapePrefetch
+{
+private:
+	GLmmap             &_vw;
+	u_int64_t           _end;
+	u_int64_t           _ahead;
+	u_int64_t           _done;
+	Thread             *_thr;
+	volatile u_int64_t  _rdOff;
+	volatile bool       _bRun;
+public:
+	u_int64_t           _nPage;
+
+	// Constructor / Destructor
+public:
+	TapePrefetch( GLmmap &, u_int64_t, u_int64_t, u_int64_t );
+	~TapePrefetch();
+
+	// Operations
+
+	void Reader( u_int64_t );
+	void Start();
+	void Stop();
+	void Run();
+
+	// Class-wide
+public:
+	static void EDGAPI _Run( void * );
+
+}; // class TapePrefetch
+
+
+/////////////////////////////////////////
+// Merged Tapes : k-way merge by msg time
+/////////////////////////////////////////
+class TapeMergeSrc
+{
+public:
+	TapeChannel  *_tape;
+	GLrecTapeMsg *_msg;
+	u_int64_t     _off;
+	u_int64_t     _end;
+	int           _src;
+
+}; // class TapeMergeSrc
+
+typedef vector<TapeMergeSrc> TapeMergeSrcs;
+
+class TapeMerge
+{
+private:
+	TapeChannel  &_tape;
+	TapeMergeSrcs _heap;
+
+	// Constructor / Destructor
+public:
+	TapeMerge( TapeChannel & );
+	~TapeMerge();
+
+	// Operations
+
+	int Run();
+
+	// Helpers
+private:
+	void _Add( TapeChannel &, int );
+	bool _Load( TapeMergeSrc & );
+	bool _Less( TapeMergeSrc &, TapeMergeSrc & );
+	void _SiftDown( size_t );
+
+}; // class TapeMerge
+
+
+/////////////////////////////////////////
+// Tape Slice : Bar accumulators
+/////////////////////////////////////////
+class TapeBar
+{
+public:
+	double _open;
+	double _high;
+	double _low;
+	double _close;
+	double _tOpen;
+	double _tClose;
+	double _vol;
+	double _pxWgt;
+	double _wgt;
+	int    _cnt;
+};
+
+class TapeBarTkr
+{
+public:
+	time_t _tBar;
+	int    _nUpd;
+};
+
+typedef vector<TapeBar>    TapeBars;
+typedef vector<TapeBarTkr> TapeBarTkrs;
+typedef vector<rtFIELD>    TapeBarFlds;
+typedef vector<string>     TapeBarNames;
+
+
 /////////////////////////////////////////
 // Tape Slice
 /////////////////////////////////////////
@@ -178,6 +412,18 @@ public:
 	 */
 	FieldMap       _LVC;
 	rtFIELD        _flds[MAX_FLD];
+	/*
+	 * _bBar : _bars[ ( StreamID * _fids.size() ) + _barIdx[ fid ] ]
+	 */
+	bool           _bBar;
+	int            _volFid;
+	TapeBarIdx     _barIdx;
+	TapeBars       _bars;
+	TapeBarTkrs    _barTkrs;
+	TapeBarFlds    _barFlds;
+	TapeBarNames   _barNames;
+	double         _barTmsg;
+	size_t         _barFlush;
 
 	// Constructor / Destructor
 public:
@@ -188,16 +434,110 @@ public:
 	// Access
 public:
 	bool IsSampled();
+	bool IsBar();
 	bool InTimeRange( GLrecTapeMsg & );
 	bool CanPump( int, rtEdgeData & );
+	bool FlushBar( rtEdgeData & );
 
 	// Helpers
 private:
 	struct timeval _str2tv( char * );
 	void           _Cache( rtEdgeData & );
+	void           _BarInit( char * );
+	bool           _CanPumpBar( int, rtEdgeData & );
+	TapeBarTkr    &_BarTkr( int );
+	void           _BarAdd( rtEdgeData & );
+	void           _BarOut( int, rtEdgeData & );
 
 };  // class TapeSlice
 
+
+/////////////////////////////////////////
+// Columnar Export
+/////////////////////////////////////////
+typedef vector<u_int64_t>           TapeCells;
+typedef vector<u_char>              TapeColBits;
+typedef hash_map<string, u_int64_t> TapeColStrs;
+typedef vector<int>                 TapeColRows;
+typedef vector<rtColTicker>         TapeColTkrs;
+
+class TapeColumn
+{
+public:
+	rtColumn    _def;
+	bool        _bTyped;
+	/*
+	 * Flat, realloc()'ed : Add() is once per row per column
+	 */
+	u_int64_t  *_cells;
+	u_char     *_set;
+	u_int64_t   _nRow;
+	u_int64_t   _nAlloc;
+	string      _heap;
+	TapeColStrs _strs;
+
+	// Constructor / Destructor
+public:
+	TapeColumn( const char *, int, rtColType, bool );
+	~TapeColumn();
+
+	// Operations
+public:
+	void      Add( u_int64_t, bool );
+	u_int64_t Cell( rtFIELD & );
+
+	// Helpers
+private:
+	void _Grow();
+
+};  // class TapeColumn
+
+typedef vector<TapeColumn *> TapeColumns;
+
+class TapeColExport
+{
+private:
+	TapeChannel    &_tape;
+	string          _file;
+	TapeSlice      *_slice;
+	mddWire_Context _mdd;
+	mddFieldList    _fl;
+	TapeColumns     _cols;
+	TapeColRows     _fidCol;
+	TapeColRows     _tkrRow;
+	TapeColTkrs     _tkrs;
+	TapeColBits     _upd;
+	/*
+	 * _fidCol[ FID ] : Column index; 0 if not exported
+	 * _lvc[ ( tkrRow * _cols.size() ) + colIdx ]
+	 */
+	TapeCells       _lvc;
+	u_int64_t       _nRow;
+	double          _t0;
+	double          _t1;
+
+	// Constructor / Destructor
+public:
+	TapeColExport( TapeChannel &, 
+	               const char *, 
+	               const char *, 
+	               const char *, 
+	               const char *, 
+	               const char * );
+	~TapeColExport();
+
+	// Operations
+public:
+	u_int64_t Run();
+
+	// Helpers
+private:
+	void _SelectTickers( const char * );
+	void _AddRow( GLrecTapeMsg &, double, mddFieldList & );
+	bool _Write();
+
+};  // class TapeColExport
+
 /////////////////////////////////////////
 // View on Daily Index
 /////////////////////////////////////////
@@ -221,11 +561,58 @@ public:
 	Sentinel  &sentinel();
 	u_int64_t *tapeIdxDb();
 	Bool       forth();
+	u_int64_t *Find( time_t );
 private:
 	Bool       _Set();
 
 }; // class GLrpyDailyIdxVw
 
+
+/////////////////////////////////////////
+// Per-Ticker Index : <tape>.tkr
+/////////////////////////////////////////
+/*
+ * Tape offsets per GLrecTapeRec, oldest first, as of _curLoc.
+ * Ticker ix owns _offs[ _beg[ix] ] thru _offs[ _beg[ix+1]-1 ].
+ */
+class GLrpyTkrIdxHdr
+{
+public:
+	char      _signature[16];
+	time_t    _tCreate;  // Tape _tCreate
+	u_int64_t _hdrSiz;   // Tape _hdrSiz
+	u_int64_t _curLoc;   // Tape _curLoc when built
+	u_int64_t _numMsg;
+	int       _numRec;
+	int       _pad;
+//	u_int64_t _beg[_numRec+1];
+//	u_int64_t _offs[_numMsg];
+};
+
+class GLrpyTkrIdxVw : public GLmmap
+{
+private:
+	GLrpyTkrIdxHdr *_ih;
+	u_int64_t      *_beg;
+	u_int64_t      *_offs;
+
+	// Constructor
+public:
+	GLrpyTkrIdxVw( char * );
+	~GLrpyTkrIdxVw();
+
+	// Access / Operations
+public:
+	u_int64_t  curLoc();
+	Bool       IsValid( TapeHeader & );
+	u_int64_t *offsets( int, u_int64_t & );
+
+	// Class-wide
+public:
+	static Bool Build( TapeHeader &, char *, u_int64_t, const char * );
+
+}; // class GLrpyTkrIdxVw
+
 } // namespace RTEDGE_PRIVATE
 
 #endif // __TAPE_CHANNEL_H
@@ -13,8 +13,9 @@
 *      7 SEP 2020 jcs  Build 44: SetName()
 *      8 JAN 2022 jcs  Build 51: bool _ready
 *     27 FEB 2024 jcs  Build 68: _affinity
+*     17 OCT 2026 jcs  Build 80: _bOnce
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __EDGLIB_THREAD_H
 #define __EDGLIB_THREAD_H
@@ -36,6 +37,7 @@ class Thread : public string
 protected:
 	rtEdgeThreadFcn _fcn;
 	void           *_arg;
+	bool            _bOnce;
 	bool            _bRun;
 	pthread_t       _tid;
 	HANDLE          _hThr;
@@ -46,7 +48,7 @@ protected:
 	// Constructor / Destructor
 public:
 	Thread();
-	Thread( rtEdgeThreadFcn, void * );
+	Thread( rtEdgeThreadFcn, void *, bool bOnce=false );
 	~Thread();
 
 	// Access / Operations
@@ -5,8 +5,9 @@
 *
 *  REVISION HISTORY:
 *     25 MAY 2017 jcs  Created (from RecordUDP).
+*     17 OCT 2026 jcs  Build 80: _UDP_MAXPKT
 *
-*  (c) 1994-2017, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __WIRE64_H
 #define __WIRE64_H
@@ -16,6 +17,8 @@
 #define _FID_STREAMID  1
 #define _FID_TICKER    3
 #define _MTU           2*K  // 1500 bytes will do ...
+#define _UDP_MAXPKT    1472 // 1500 MTU - IP / UDP headers
+#define _UDP_MAXBATCH  1024 // Max Mold64Pkt's per sendmmsg()
 
 /////////////////////
 // WireMold64 - Wire
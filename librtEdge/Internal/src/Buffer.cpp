@@ -7,6 +7,8 @@
 *      7 NOV 2024 jcs  Build 74: SetRawLog()
 *     25 JAN 2025 jcs  Build 75: De-lint
 *     10 JUN 2026 jcs  Build 79: Socket._log
+*     17 OCT 2026 jcs  Build 80: recv() / send() w/ _NB_xxFLAGS if _bNonBlk
+*     17 OCT 2026 jcs  Build 80: GatherBuffer : writev() from build buffer refs; _nCopy
 *
 *  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
@@ -31,7 +33,10 @@ Buffer::Buffer( int maxSz ) :
    _qAlloc( 0 ),
    _qMax( maxSz ),
    _Total( 0 ),
+   _nSysCall( 0 ),
+   _nCopy( 0 ),
    _bConnectionless( false ),
+   _bNonBlk( false ),
    _rawLog( (FPHANDLE)0 ),
    _rawLogRoll( (FPHANDLE)0 )
 { ; }
@@ -79,10 +84,16 @@ int Buffer::ReadIn( int fd, int nL )
 {
    int nb;
 
-   if ( _bConnectionless )
+   /*
+    * _bNonBlk : fd is O_NONBLOCK for life; MSG_DONTWAIT regardless
+    */
+   if ( _bNonBlk )
+      nb = ::recv( fd, _cp, nL, _NB_RDFLAGS );
+   else if ( _bConnectionless )
       nb = ::recv( fd, _cp, nL, 0 );
    else
       nb = READ( fd, _cp, nL );
+   _nSysCall += 1;
    _cp += b_gmax( nb, 0 );
 // assert( bufSz() <= _qAlloc );
    return nb;
@@ -134,7 +145,8 @@ bool Buffer::Grow( int nReqGrow )
    if ( lwc ) {
       if ( bSz ) {
          ::memcpy( _bp, lwc, bSz );
-         _cp += bSz;
+         _cp    += bSz;
+         _nCopy += bSz;
       }
       delete[] lwc;
    }
@@ -172,10 +184,25 @@ bool Buffer::Push( char *cp, int len )
    // OK to copy
 
    ::memcpy( _cp, cp, len );
-   _cp += len;
+   _cp    += len;
+   _nCopy += len;
    return true;
 }
 
+bool Buffer::PushRef( mddBldBuf &notUsed, char *cp, int len )
+{
+   return Push( cp, len );
+}
+
+rtBUF Buffer::lastRef()
+{
+   rtBUF b;
+
+   b._data = (char *)0;
+   b._dLen = 0;
+   return b;
+}
+
 void Buffer::Move( int off, int len )
 {
    char *cp;
@@ -183,8 +210,9 @@ void Buffer::Move( int off, int len )
    cp  = _bp;
    cp += off;
    ::memmove( _bp, cp, len );
-   _cp  = _bp;
-   _cp += len;
+   _cp     = _bp;
+   _cp    += len;
+   _nCopy += len;
 }
 
 ////////////////////////////////////////////
@@ -194,9 +222,13 @@ int Buffer::_Write2Wire( int fd, char *rp, int wSz )
 {
    int nb;
 
-   nb      = WRITE( fd, rp, wSz );
-   nb      = b_gmax( nb, 0 );
-   _Total += nb;
+   if ( _bNonBlk )
+      nb = ::send( fd, rp, wSz, _NB_WRFLAGS );
+   else
+      nb = WRITE( fd, rp, wSz );
+   nb         = b_gmax( nb, 0 );
+   _Total    += nb;
+   _nSysCall += 1;
    _RawLog( rp, nb );
    return nb;
 }
@@ -337,7 +369,8 @@ int CircularBuffer::_memcpy( char *rp, int dLen )
 
    wp = _bp + _end;
    ::memcpy( wp, rp, dLen );
-   _end += dLen;
+   _end   += dLen;
+   _nCopy += dLen;
    if ( _end == _qAlloc )
       _end = 0;
    return dLen;
@@ -358,3 +391,218 @@ void CircularBuffer::_RawLog_Roll( int frag, bool bSOM )
       GLmmap::Flush( _rawLogRoll );
    }
 }
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+//             c l a s s      G a t h e r B u f f e r
+//
+/////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////
+// Constructor / Destructor
+////////////////////////////////////////////
+GatherBuffer::GatherBuffer( int maxSz ) :
+   Buffer( maxSz ),
+   _refs(),
+   _free(),
+   _off( 0 ),
+   _qSz( 0 )
+{
+   _last._data = (char *)0;
+   _last._dLen = 0;
+}
+
+GatherBuffer::~GatherBuffer()
+{
+   Reset();
+   for ( ; _free.size(); _free.pop_front() ) {
+      if ( _free.front()._data )
+         ::mddBldBuf_Free( _free.front() );
+   }
+}
+
+
+////////////////////////////////////////////
+// Instance-Specific Operations
+////////////////////////////////////////////
+bool GatherBuffer::Grow( int nReqGrow )
+{
+   int nGrow;
+
+   /*
+    * Nothing to allocate; Queue holds references to build buffers
+    */
+   nGrow    = b_gmin( nReqGrow, ( _qMax-_qAlloc ) );
+   nGrow    = b_WithinRange( 0, nGrow, _qMax );
+   _qAlloc += nGrow;
+   return( nGrow > 0 );
+}
+
+void GatherBuffer::Reset()
+{
+   Buffer::Reset();
+   for ( ; _refs.size(); _refs.pop_front() )
+      _free.push_back( _refs.front()._bb );
+   _off = 0;
+   _qSz = 0;
+}
+
+int GatherBuffer::bufSz()
+{
+   return _qSz;
+}
+
+int GatherBuffer::WriteOut( int fd, int notUsed, int wSz )
+{
+   GatherRefs::iterator it;
+   int                  i, n, nb, nL, off;
+
+   // Pre-condition
+
+   wSz = b_gmin( wSz, bufSz() );
+   if ( !wSz || !_refs.size() )
+      return 0;
+
+#if !defined(WIN32)
+   struct iovec  iov[_MAX_GATHER];
+   struct msghdr mh;
+
+   /*
+    * 1) Up to _MAX_GATHER references; 1st from _off
+    * 2) writev(), or sendmsg() to pass _NB_WRFLAGS
+    */
+   it = _refs.begin();
+   for ( i=0,nL=wSz; nL && ( i<_MAX_GATHER ) && ( it!=_refs.end() ); i++,it++ ) {
+      off             = i ? 0 : _off;
+      n               = b_gmin( nL, (*it)._dLen - off );
+      iov[i].iov_base = (*it)._data + off;
+      iov[i].iov_len  = n;
+      nL             -= n;
+   }
+   if ( _bNonBlk ) {
+      ::memset( &mh, 0, sizeof( mh ) );
+      mh.msg_iov    = iov;
+      mh.msg_iovlen = i;
+      nb            = ::sendmsg( fd, &mh, _NB_WRFLAGS );
+   }
+   else
+      nb = ::writev( fd, iov, i );
+   nb         = b_gmax( nb, 0 );
+   _Total    += nb;
+   _nSysCall += 1;
+   for ( n=0,nL=nb; nL && ( n<i ); n++ ) {
+      off = b_gmin( nL, (int)iov[n].iov_len );
+      _RawLog( (char *)iov[n].iov_base, off );
+      nL -= off;
+   }
+#else
+   GatherRef &r = _refs.front();
+
+   // 1 reference per call
+
+   it  = _refs.begin();
+   off = _off;
+   n   = b_gmin( wSz, r._dLen - off );
+   nb  = _Write2Wire( fd, r._data + off, n );
+   nL  = i = 0;
+#endif // !defined(WIN32)
+   _Release( nb );
+   return nb;
+}
+
+bool GatherBuffer::Push( char *cp, int len )
+{
+   GatherRef r;
+
+   // Not from build buffer : Copy into pooled one
+
+   if ( ( nLeft() < len ) && !Grow( _qAlloc ) )
+      return false;
+   r._bb = _GetFree();
+   if ( (int)r._bb._nAlloc <= len ) {
+      if ( r._bb._data )
+         ::mddBldBuf_Free( r._bb );
+      r._bb = ::mddBldBuf_Alloc( len+1 );
+   }
+   ::memcpy( r._bb._data, cp, len );
+   r._data = r._bb._data;
+   r._dLen = len;
+   _refs.push_back( r );
+   _qSz   += len;
+   _nCopy += len;
+   return true;
+}
+
+bool GatherBuffer::PushRef( mddBldBuf &bb, char *cp, int len )
+{
+   GatherRef r;
+   char     *bp, *ep;
+
+   // Pre-condition : cp from bb
+
+   bp = bb._data;
+   ep = bp + bb._nAlloc;
+   if ( !bp || !b_InRange( bp, cp, ep ) )
+      return Push( cp, len );
+   if ( ( nLeft() < len ) && !Grow( _qAlloc ) )
+      return false;
+
+   /*
+    * Queue takes bb; Caller builds next message into pooled one
+    */
+   r._bb       = bb;
+   r._data     = cp;
+   r._dLen     = len;
+   _refs.push_back( r );
+   _qSz       += len;
+   _last._data = cp;
+   _last._dLen = len;
+   bb          = _GetFree();
+   return true;
+}
+
+
+////////////////////////////////////////////
+// Helpers
+////////////////////////////////////////////
+mddBldBuf GatherBuffer::_GetFree()
+{
+   mddBldBuf bb;
+
+   if ( _free.size() ) {
+      bb = _free.back();
+      _free.pop_back();
+   }
+   else
+      ::memset( &bb, 0, sizeof( bb ) );
+   return bb;
+}
+
+void GatherBuffer::_Release( int nb )
+{
+   int n;
+
+   /*
+    * Advance _off; Fully-sent references back to pool
+    */
+   for ( ; nb && _refs.size(); ) {
+      GatherRef &r = _refs.front();
+
+      n     = b_gmin( nb, r._dLen - _off );
+      _off += n;
+      _qSz -= n;
+      nb   -= n;
+      if ( _off < r._dLen )
+         break; // for-nb
+      _free.push_back( r._bb );
+      _refs.pop_front();
+      _off = 0;
+      if ( (int)_free.size() > _MAX_GATHER ) {
+         ::mddBldBuf_Free( _free.front() );
+         _free.pop_front();
+      }
+   }
+}
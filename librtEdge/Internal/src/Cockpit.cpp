@@ -7,8 +7,9 @@
 *     22 AUG 2017 jcs  Created.
 *     21 JAN 2018 jcs  Build 39: _LVC
 *      5 JAN 2024 jcs  Build 67: Buffer.h
+*     17 OCT 2026 jcs  Build 80: ~Cockpit() : RemoveIdle()
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <EDG_Internal.h>
 
@@ -57,6 +58,7 @@ Cockpit::Cockpit( CockpitAttr     attr,
 
 Cockpit::~Cockpit()
 {
+   pump().RemoveIdle( Cockpit::_OnIdle, this );
    DetachLVC();
    if ( _log )
       _log->logT( 3, "~Cockpit( %s )\n", dstConn() );
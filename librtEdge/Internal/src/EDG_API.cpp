@@ -31,8 +31,18 @@
 *     14 JAN 2024 jcs  Build 67: No mo OFF_T
 *     26 JUN 2024 jcs  Build 72: LVC_SetFilter( flds, svcs )
 *     19 FEB 2025 jcs  Build 75: Cockpit_Destroy : Kill thread first; rtEdge_ClockNs()
+*     17 OCT 2026 jcs  Build 80: rtEdge_DispatchBatch()
+*     17 OCT 2026 jcs  Build 80: LVC_SnapAll() : GLlvcDb::SnapAll(); LVC_SetSnapThreads(); Arena; LVC_SnapSince()
+*     17 OCT 2026 jcs  Build 80: LVC_SetLockFree()
+*     17 OCT 2026 jcs  Build 80: LVC_SnapAll() : recOffs()
+*     17 OCT 2026 jcs  Build 80: LVC_SnapAll() : NumRecs()
+*     17 OCT 2026 jcs  Build 80: rtEdge_PublishBatch()
+*     17 OCT 2026 jcs  Build 80: rtEdge_TapeExport()
+*     17 OCT 2026 jcs  Build 80: LVC_SetPopulate()
+*     17 OCT 2026 jcs  Build 80: rtEdge_SetSharedPump(); StopThread()
+*     17 OCT 2026 jcs  Build 80: LVC_SnapAll() : _tWatermark = Newest _tUpd / _tDead
 *
-*  (c) 1994-2025, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <EDG_Internal.h>
 #include <OS_cpu.h>
@@ -40,6 +50,7 @@
 
 static DWORD _LVCwaitMillis = INFINITE;
 static bool  _LVClock       = false;
+static bool  _LVCpopulate   = false;
 
 using namespace RTEDGE_PRIVATE;
 
@@ -290,6 +301,11 @@ const char *rtEdge_Start( rtEdge_Context cxt )
    return (const char *)0;
 }
 
+void rtEdge_SetSharedPump( char bShared )
+{
+   Socket::_bSharedPump = bShared ? true : false;
+}
+
 void rtEdge_Destroy( rtEdge_Context cxt )
 {
    EdgChanMap::iterator it;
@@ -302,7 +318,7 @@ void rtEdge_Destroy( rtEdge_Context cxt )
    if ( (it=_subs.find( cxt )) != _subs.end() ) {
       edg = (*it).second;
       st  = &edg->stats();
-      edg->thr().Stop();
+      edg->StopThread();
       _subs.erase( it );
       delete edg;
    }
@@ -588,6 +604,26 @@ int rtEdge_Dispatch( rtEdge_Context cxt, int maxUpd, double dWait )
    return 0;
 }
 
+int rtEdge_DispatchBatch( rtEdge_Context cxt, 
+                          rtEdgeData    *ddb, 
+                          int            maxUpd, 
+                          double         dWait )
+{
+   EdgChannel *edg;
+   Logger     *lf;
+
+   // Logging; Find EdgChannel
+
+   if ( (lf=Socket::_log) )
+      lf->logT( 3, "rtEdge_DispatchBatch( %d,%.3f )\n", maxUpd, dWait );
+
+   // Operation
+
+   if ( ddb && ( maxUpd > 0 ) && (edg=_GetSub( (int)cxt )) )
+      return edg->DispatchBatch( ddb, maxUpd, dWait );
+   return 0;
+}
+
 int rtEdge_Read( rtEdge_Context cxt, double dWait, rtEdgeRead *rd )
 {
    EdgChannel *edg;
@@ -664,6 +700,28 @@ int rtEdge_StopPumpFullTape( rtEdge_Context cxt, int pumpID )
    return 0;
 }
 
+u_int64_t rtEdge_TapeExport( rtEdge_Context cxt,
+                             const char    *pFile,
+                             const char    *tStart,
+                             const char    *tEnd,
+                             const char    *pTkrs,
+                             const char    *pFlds )
+{
+   EdgChannel *edg;
+   Logger     *lf;
+
+   // Logging; Find EdgChannel
+
+   if ( (lf=Socket::_log) )
+      lf->logT( 3, "rtEdge_TapeExport( %s )\n", pFile ? pFile : "" );
+
+   // Operation
+
+   if ( (edg=_GetSub( (int)cxt )) )
+      return edg->TapeExport( pFile, tStart, tEnd, pTkrs, pFlds );
+   return 0;
+}
+
 
 //////////////////////////////
 // Publication
@@ -737,7 +795,7 @@ void rtEdge_PubDestroy( rtEdge_Context cxt )
 
    if ( (pub=_GetPub( cxt )) ) {
       st  = &pub->stats();
-      pub->thr().Stop();
+      pub->StopThread();
       delete pub; 
       _pubs[cxt] = (PubChannel *)0; 
    }
@@ -768,6 +826,26 @@ int rtEdge_Publish( rtEdge_Context cxt,
    return rtn;
 }
 
+int rtEdge_PublishBatch( rtEdge_Context cxt,
+                         rtEdgeData    *ddb,
+                         int            nd )
+{
+   PubChannel *pub;
+   Logger     *lf;
+   int         rtn;
+
+   // Logging; Find EdgChannel
+
+   if ( (lf=Socket::_log) )
+      lf->logT( 3, "rtEdge_PublishBatch( %d )\n", nd );
+
+   // Publish, if found
+
+   pub = _GetPub( (int)cxt );
+   rtn = ( pub && ddb ) ?  pub->PublishBatch( ddb, nd ) : 0;
+   return rtn;
+}
+
 int rtEdge_PubError( rtEdge_Context cxt, rtEdgeData d )
 {
    PubChannel *pub;
@@ -821,6 +899,11 @@ void LVC_SetLock( char bLock, long dwWaitMillis )
    _LVCwaitMillis = dwWaitMillis;
 }
 
+void LVC_SetPopulate( char bPopulate )
+{
+   _LVCpopulate = bPopulate ? true : false;
+}
+
 LVC_Context LVC_Initialize( const char *pFile )
 {
    Locker  lck( _lvcMtx );
@@ -837,7 +920,7 @@ LVC_Context LVC_Initialize( const char *pFile )
    // 1) GLlvcDb object
 
    rtn       = ATOMIC_INC( &_nCxt );
-   lvc       = new LVCDef( pFile, _LVClock, _LVCwaitMillis );
+   lvc       = new LVCDef( pFile, _LVClock, _LVCwaitMillis, _LVCpopulate );
    _lvc[rtn] = lvc;
    return rtn;
 }
@@ -915,6 +998,54 @@ void LVC_SetCopyType( LVC_Context cxt, char bFull )
       lvc->SetCopyType( bFull ? true : false );
 }
 
+void LVC_SetSnapThreads( LVC_Context cxt, int nThr )
+{
+   LVCDef *lvc;
+   Logger *lf;
+
+   // Logging; Find GLlvcDb
+
+   if ( (lf=Socket::_log) )
+      lf->logT( 3, "LVC_SetSnapThreads( %d )\n", nThr );
+
+   // GLlvcDb object
+
+   if ( (lvc=_GetLVC( cxt )) )
+      lvc->SetSnapThreads( nThr );
+}
+
+void LVC_SetArena( LVC_Context cxt, char bArena )
+{
+   LVCDef *lvc;
+   Logger *lf;
+
+   // Logging; Find GLlvcDb
+
+   if ( (lf=Socket::_log) )
+      lf->logT( 3, "LVC_SetArena( %d )\n", bArena );
+
+   // GLlvcDb object
+
+   if ( (lvc=_GetLVC( cxt )) )
+      lvc->SetArena( bArena ? true : false );
+}
+
+void LVC_SetLockFree( LVC_Context cxt, char bLockFree )
+{
+   LVCDef *lvc;
+   Logger *lf;
+
+   // Logging; Find GLlvcDb
+
+   if ( (lf=Socket::_log) )
+      lf->logT( 3, "LVC_SetLockFree( %d )\n", bLockFree );
+
+   // GLlvcDb object
+
+   if ( (lvc=_GetLVC( cxt )) )
+      lvc->SetLockFree( bLockFree ? true : false );
+}
+
 LVCData LVC_Snapshot( LVC_Context cxt,
                       const char *pSvc,
                       const char *pTkr )
@@ -937,7 +1068,7 @@ LVCData LVC_Snapshot( LVC_Context cxt,
    rtn._pTkr = pTkr;
    if ( (ld=_GetLVC( (int)cxt )) ) {
       GLlvcDb &lvc = ld->lvc();
-      Locker   lck( lvc.mtx() );
+      Locker   lck( lvc.mtx(), !lvc.IsLockFree() );
 
       if ( lvc.isValid() && lvc.IsLocked() ) 
          rtn = lvc.GetItem( pSvc, pTkr, False );
@@ -962,6 +1093,10 @@ void LVC_Free( LVCData *d )
    bool     bFldCopy;
    int      i, nf;
 
+   if ( d && d->_bArena ) {
+      ::memset( d, 0, sizeof( *d ) );
+      return;
+   }
    if ( d ) {
       nf = d->_nFld;
       if ( d->_flds ) {
@@ -991,8 +1126,10 @@ LVCDataAll LVC_SnapAll( LVC_Context cxt )
    LVCDef    *ld;
    Logger    *lf;
    LVCDataAll rtn;
-   LVCData    d;
-   double     d0, d1, d2, d3;
+   LVCData   *tkrs;
+   char      *arena, **pa;
+   double     d0, d1, tu, tWm;
+   int        i, sz;
 
    // Logging; Find LVCDef
 
@@ -1006,38 +1143,31 @@ LVCDataAll LVC_SnapAll( LVC_Context cxt )
    // Walk all records, if locked
 
    GLlvcDb &lvc = ld->lvc();
-   Locker   lck( lvc.mtx() );
+   Locker   lck( lvc.mtx(), !lvc.IsLockFree() );
 
    if ( !lvc.isValid() || !lvc.IsLocked() )
       return rtn;
 
-   RecMap          &rdb = lvc.recs();
-   int              sz  = rdb.size();
-   RecMap::iterator it;
-   int              i;
-   string           s;
-   LVCData         *tkrs;
-   char            *bp, *pSvc, *pTkr, *rp;
-
-   tkrs = sz ? new LVCData[sz] : rtn._tkrs;
-   for ( i=0,it=rdb.begin(); it!=rdb.end(); it++ ) {
-      s    = (*it).first.data();
-      bp   = (char *)s.data();
-      pSvc = ::strtok_r( bp, LVC_SVCSEP, &rp );
-      pTkr = ::strtok_r( NULL, LVC_SVCSEP, &rp );
-      if ( !lvc.CanAddItem( pSvc, pTkr ) )
-         continue; // for-i
-      d2        = dNow();
-      d         = lvc.GetItem_safe( pSvc, pTkr, False );
-      d3        = dNow();
-      d._dSnap  = ( d3-d2 );
-      tkrs[i++] = d;
+   arena           = (char *)0;
+   pa              = ld->_bArena ? &arena : (char **)0;
+   sz              = lvc.NumRecs();
+   tkrs            = sz ? new LVCData[sz] : rtn._tkrs;
+   sz              = sz ? lvc.SnapAll( tkrs, ld->_nSnapThr, pa ) : 0;
+   d1              = dNow();
+   rtn._tkrs       = tkrs;
+   rtn._arena      = arena;
+   rtn._nTkr       = sz;
+   rtn._dSnap      = ( d1-d0 );
+   rtn._bBinary    = lvc.IsBinary() ? 1 : 0;
+   /*
+    * Watermark : Newest update / drop we copied, not our clock
+    */
+   for ( i=0,tWm=0.0; i<sz; i++ ) {
+      tu  = tkrs[i]._tUpd + ( 1.0E-6 * tkrs[i]._tUpdUs );
+      tWm = gmax( tWm, tu );
+      tWm = gmax( tWm, (double)tkrs[i]._tDead );
    }
-   d1           = dNow();
-   rtn._tkrs    = tkrs;
-   rtn._nTkr    = i;
-   rtn._dSnap   = ( d1-d0 );
-   rtn._bBinary = lvc.IsBinary() ? 1 : 0;
+   rtn._tWatermark = tWm;
    return rtn;
 }
 
@@ -1046,17 +1176,68 @@ LVCDataAll LVC_ViewAll( LVC_Context cxt )
    return LVC_SnapAll( cxt );
 }
 
+LVCDataAll LVC_SnapSince( LVC_Context cxt, double tWatermark )
+{
+   LVCDef    *ld;
+   Logger    *lf;
+   LVCDataAll rtn;
+   LVCOffsets odb;
+   LVCData   *tkrs;
+   char      *arena, **pa;
+   double     d0, d1, tWm;
+   int        sz;
+
+   // Logging; Find LVCDef
+
+   d0 = dNow();
+   if ( (lf=Socket::_log) )
+      lf->logT( 3, "LVC_SnapSince( %.6f )\n", tWatermark );
+   ::memset( &rtn, 0, sizeof( rtn ) );
+   rtn._tWatermark = tWatermark;
+   if ( !(ld=_GetLVC( (int)cxt )) )
+      return rtn;
+
+   // Changed records only, if locked
+
+   GLlvcDb &lvc = ld->lvc();
+   Locker   lck( lvc.mtx(), !lvc.IsLockFree() );
+
+   if ( !lvc.isValid() || !lvc.IsLocked() )
+      return rtn;
+
+   tWm             = lvc.GetChanged( tWatermark, odb );
+   arena           = (char *)0;
+   pa              = ld->_bArena ? &arena : (char **)0;
+   sz              = odb.size();
+   tkrs            = sz ? new LVCData[sz] : rtn._tkrs;
+   sz              = lvc.SnapOffsets( odb, tkrs, ld->_nSnapThr, pa );
+   d1              = dNow();
+   rtn._tkrs       = tkrs;
+   rtn._arena      = arena;
+   rtn._nTkr       = sz;
+   rtn._dSnap      = ( d1-d0 );
+   rtn._bBinary    = lvc.IsBinary() ? 1 : 0;
+   rtn._tWatermark = tWm;
+   return rtn;
+}
+
 void LVC_FreeAll( LVCDataAll *d )
 {
-   int i, n;
+   char *blk, *nxt;
+   int   i, n;
 
    if ( d ) {
-      n = d->_nTkr;
+      n = d->_arena ? 0 : d->_nTkr;
       for ( i=0; i<n; LVC_Free( &d->_tkrs[i++] ) );
-      if ( n && d->_tkrs )
+      for ( blk=d->_arena; blk; blk=nxt ) {
+         nxt = *(char **)blk;
+         delete[] blk;
+      }
+      if ( d->_tkrs )
          delete[] d->_tkrs;
-      d->_nTkr = 0;
-      d->_tkrs = (LVCData *)0;
+      d->_nTkr  = 0;
+      d->_tkrs  = (LVCData *)0;
+      d->_arena = (char *)0;
    }
 }
 
@@ -1318,7 +1499,7 @@ void Cockpit_Destroy( Cockpit_Context cxt )
 
    if ( (it=_cock.find( cxt )) != _cock.end() ) {
       qod = (*it).second;
-      qod->thr().Stop();
+      qod->StopThread();
       _cock.erase( it );
       delete qod;
    }
@@ -22,15 +22,25 @@
 *     29 OCT 2022 jcs  Build 60: rtFld_vector
 *     13 MAR 2023 jcs  Build 62: GetItem_safe()
 *     26 JUN 2024 jcs  Build 72: _svcFltr / _schemaByName
+*     17 OCT 2026 jcs  Build 80: SnapAll() / GetItemAt() / GLlvcSnapJob; Arena; SnapSince()
+*     17 OCT 2026 jcs  Build 80: _bLockFree; CopyRecord()
+*     17 OCT 2026 jcs  Build 80: LVC_SIG_006 : On-disk index; FindIdx()
+*     17 OCT 2026 jcs  Build 80: mmap_random; bPopulate
+*     17 OCT 2026 jcs  Build 80: bPopulate : 1st map() only
+*     17 OCT 2026 jcs  Build 80: GetChanged() : Watermark = Newest _tUpd / _tDead seen
+*     17 OCT 2026 jcs  Build 80: Load() : Indexed = Walk mmap'ed slots; No _recOffs / sort
+*     17 OCT 2026 jcs  Build 80: SnapOffsets() : Persistent _snapJobs; No thread per call
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <EDG_Internal.h>
+#include <algorithm>
 
 using namespace RTEDGE_PRIVATE;
 
 static int _hSz  = sizeof( GLlvcDbHdr );
 static int _h3Sz = sizeof( GLlvcDbHdr3 );
+static int _h4Sz = sizeof( GLlvcDbHdr4 );
 static int _fSz  = sizeof( GLlvcFldDef );
 
 /////////////////////////////////////////////////////////////////////////////
@@ -42,7 +52,10 @@ static int _fSz  = sizeof( GLlvcFldDef );
 ////////////////////////////////////////////
 // Constructor / Destructor
 ////////////////////////////////////////////
-GLlvcDb::GLlvcDb( LVCDef &ld, bool bLock, DWORD waitMillis ) :
+GLlvcDb::GLlvcDb( LVCDef &ld, 
+                  bool    bLock, 
+                  DWORD   waitMillis,
+                  bool    bPopulate ) :
    GLmmap( ld.pFile(), (char *)0, 0, _hSz ),
    _def( ld ),
    _fidOffs(),
@@ -52,19 +65,29 @@ GLlvcDb::GLlvcDb( LVCDef &ld, bool bLock, DWORD waitMillis ) :
    _schemaByName(),
    _schema(),
    _recs(),
+   _recOffs(),
    _name( ld.pFile() ),
    _freeIdx( -1 ),
+   _nIdxRec( 0 ),
    _mtx(),
    _bFullCopy( ld._bFullCopy ),
+   _bLockFree( false ),
    _lock( (Semaphore *)0 ),
    _locked( true ),
    _bBinary( false ),
-   _cockpits()
+   _bIdx( false ),
+   _bIdxOK( false ),
+   _schemaOff( _h3Sz ),
+   _recOff( 0 ),
+   _cockpits(),
+   _snapMtx(),
+   _snapJobs()
 {
-   int         i, off, fSz, nFld, fid, fLen;
-   GLlvcFldDef def;
-   FidMap     &odb = _fidOffs;
-   char       *sig;
+   int          i, off, fSz, nFld, fid, fLen;
+   GLlvcFldDef  def;
+   FidMap      &odb = _fidOffs;
+   GLlvcIdxHdr *ix;
+   char        *sig;
 
    // Lock
 
@@ -74,24 +97,43 @@ GLlvcDb::GLlvcDb( LVCDef &ld, bool bLock, DWORD waitMillis ) :
          return;
    }
    
-   // Remap to file size
+   // Remap to file size : Lookups are random; Pre-fault if asked, once
 
    if ( !isValid() )
       return;
    nFld = db()._nFlds;
    fSz  = db()._fileSiz;
+   advise( mmap_random );
+   populate( bPopulate );
    map( 0, fSz );
+   populate( False );
    if ( !isValid() )
       return;
-   sig = db()._signature;
+   sig   = db()._signature;
+   _bIdx = ( ::strcmp( LVC_SIG_006, sig ) == 0 );
    if ( ::strcmp( LVC_SIG_004, sig ) ) {
-      _bBinary = ( ::strcmp( LVC_SIG_005, sig ) == 0 );
+      _bBinary = _bIdx || ( ::strcmp( LVC_SIG_005, sig ) == 0 );
       if ( !_bBinary ) {
          unmap();
          return;
       }
    }
 
+   // Record / schema offsets : Index sits between schema and records
+
+   _recOff = _schemaOff + ( _fSz * nFld );
+   if ( _bIdx ) {
+      ix         = &db4()._idx;
+      _schemaOff = _h4Sz;
+      _recOff    = ix->_slotOff + ( ix->_nSlot * sizeof( LVCint ) );
+      if ( ( ix->_nSlot <= 0 ) || ( ix->_nSlot & ( ix->_nSlot-1 ) ) ||
+           ( ix->_slotOff < _schemaOff + ( _fSz * nFld ) ) ||
+           ( _recOff > fSz ) ) {
+         unmap();
+         return;
+      }
+   }
+
    // Build fid map(s)
 
    SchemaByFid &sdb = _schemaByFid;
@@ -117,10 +159,13 @@ GLlvcDb::GLlvcDb( LVCDef &ld, bool bLock, DWORD waitMillis ) :
 
 GLlvcDb::~GLlvcDb()
 {
-   Cockpits &v = _cockpits;
+   Cockpits      &v   = _cockpits;
+   GLlvcSnapJobs &jdb = _snapJobs;
 
    for ( size_t i=0; i<v.size(); v[i++]->DetachLVC( true ) );
    v.clear();
+   for ( size_t i=0; i<jdb.size(); delete jdb[i++] );
+   jdb.clear();
    _fidOffs.clear();
    _fidFltr.clear();
    _svcFltr.clear();
@@ -153,27 +198,86 @@ GLlvcDbHdr3 &GLlvcDb::db3()
    return *rtn;
 }
 
+GLlvcDbHdr4 &GLlvcDb::db4()
+{
+   GLlvcDbHdr4 *rtn;
+
+   rtn = (GLlvcDbHdr4 *)data();
+   return *rtn;
+}
+
 GLlvcFldDef *GLlvcDb::fdb()
 {
    GLlvcFldDef *rtn;
    char        *bp;
 
    bp  = data();
-   bp += _h3Sz;
+   bp += _schemaOff;
    rtn = (GLlvcFldDef *)bp;
    return rtn;
 }
 
+LVCint *GLlvcDb::slots()
+{
+   LVCint *rtn;
+   char   *bp;
+
+   rtn = (LVCint *)0;
+   if ( _bIdx ) {
+      bp  = data();
+      bp += db4()._idx._slotOff;
+      rtn = (LVCint *)bp;
+   }
+   return rtn;
+}
+
 RecMap &GLlvcDb::recs()
 {
    return _recs;
 }
 
+LVCOffsets &GLlvcDb::recOffs()
+{
+   return _recOffs;
+}
+
+int GLlvcDb::NumRecs()
+{
+   return _bIdxOK ? _nIdxRec : (int)_recOffs.size();
+}
+
+int GLlvcDb::NumSlots()
+{
+   return _bIdxOK ? db4()._idx._nSlot : (int)_recOffs.size();
+}
+
+int GLlvcDb::RecOffAt( int i )
+{
+   int off;
+
+   /*
+    * Indexed : Slot i of mmap'ed index, in on-disk order; 0 if empty or 
+    * past what we have Load()'ed.  Else i'th of _recOffs.
+    */
+   off = _bIdxOK ? slots()[i] : _recOffs[i];
+   return ( ( off >= _recOff ) && ( off < _freeIdx ) ) ? off : 0;
+}
+
+bool GLlvcDb::IsIndexed()
+{
+   return _bIdxOK;
+}
+
 bool GLlvcDb::IsLocked()
 {
    return _locked;
 }
 
+bool GLlvcDb::IsLockFree()
+{
+   return _bLockFree;
+}
+
 int GLlvcDb::FieldOffset( int fid )
 {
    FidMap          &odb = _fidOffs;
@@ -209,7 +313,7 @@ bool GLlvcDb::CanAddItem( const char *svc, const char *tkr_notUsed )
 
 LVCData GLlvcDb::GetItem( const char *svc, const char *tkr, Bool bShallow )
 {
-   Locker lck( _mtx );
+   Locker lck( _mtx, !_bLockFree );
 
    Load();
    return GetItem_safe( svc, tkr, bShallow );
@@ -219,47 +323,83 @@ LVCData GLlvcDb::GetItem_safe( const char *pSvc,
                                const char *pTkr,
                                Bool        bShallow )
 {
-   Locker           lck( _mtx );
+   Locker           lck( _mtx, !_bLockFree );
    RecMap::iterator it;
    LVCData          d;
-   GLlvcDbItem     *rec;
+   int              off;
+
+   // 1) Find : On-disk index, else _recs
+
+   off = -1;
+   if ( _bIdxOK )
+      off = FindIdx( pSvc, pTkr );
+   else if ( (it=_recs.find( MapKey( pSvc, pTkr ) )) != _recs.end() )
+      off = (*it).second;
+   if ( off == -1 ) {
+      ::memset( &d, 0, sizeof( d ) );
+      d._pSvc     = pSvc;
+      d._pTkr     = pTkr;
+      d._bShallow = bShallow;
+      d._ty       = edg_dead;
+      d._pErr     = "Item Not Found";
+      return d;
+   }
+
+   // 2) Copy out
+
+   return GetItemAt( off, bShallow );
+}
+
+LVCData GLlvcDb::GetItemAt( int off, Bool bShallow, GLlvcArena *arena )
+{
+   LVCData          d;
+   GLlvcDbItem     *rec, *live;
    GLlvcFldDef      def;
    GLlvcFldHdr     *h;
-   char            *bp, *rp, *dp, *fp, *copy;
+   char            *bp, *rp, *dp, *fp, *copy, *tmp;
+   char             stk[LVC_STK_COPY];
    Bool             bOK;
    struct timeval   tv, tNow;
-   string           s = MapKey( pSvc, pTkr );
    double           dn;
-   int              i, n, iSz, nf, idx, fOff, off;
+   int              i, n, iSz, nf, idx, fOff, siz;
    LVCint          *ip;
 
+   /*
+    * No locking : Caller holds _mtx, else is a SnapAll() worker, else
+    * lock-free, where we walk a stable copy of the record from 
+    * CopyRecord() rather than the live one.
+    *
+    * Carve _flds, _copy and strings from arena, if not NULL
+    */
+
    // 1) Initialize return shit
 
    ::memset( &d, 0, sizeof( d ) );
-   d._pSvc     = pSvc;
-   d._pTkr     = pTkr;
-   d._bShallow = bShallow;
-
-   // 2) Find
-
-   if ( (it=_recs.find( s )) == _recs.end() ) {
-      d._ty   = edg_dead;
-      d._pErr = "Item Not Found";
-      return d;
+   bp   = data();
+   live = (GLlvcDbItem *)( bp + off );
+   rp   = (char *)live;
+   tmp  = (char *)0;
+   if ( _bLockFree ) {
+      bShallow = False;
+      siz      = live->_siz;
+      tmp      = ( siz > LVC_STK_COPY ) ? new char[siz] : stk;
+      if ( !CopyRecord( live, tmp, siz ) )
+         d._pErr = "Torn read : Retries exhausted";
+      rp       = tmp;
    }
-   bp  = data();
-   off = (*it).second;
-   rp  = bp + off;
+   d._bShallow = bShallow;
    rec = (GLlvcDbItem *)rp;
+   nf  = rec->_nFld;
 
-   // 3) Fill in item stats
+   // 2) Fill in item stats
 
    if ( !bShallow && _bFullCopy ) {
-      d._copy = new char[rec->_siz];
+      d._copy = arena ? arena->Alloc( rec->_siz ) : new char[rec->_siz];
       ::memcpy( d._copy, rp, rec->_siz );
    }
-   d._pSvc       = rec->_svc;
-   d._pTkr       = rec->_tkr;
+   d._bArena     = arena ? 1 : 0;
+   d._pSvc       = live->_svc;
+   d._pTkr       = live->_tkr;
    d._bActive    = rec->_bActive;
    d._recHdrSiz  = sizeof( GLlvcDbItem );
    d._recDataSiz = rec->_siz;
@@ -276,9 +416,15 @@ LVCData GLlvcDb::GetItem_safe( const char *pSvc,
    d._nUpd       = rec->_nUpd;
    bOK           = ( rec->_tDead < rec->_tUpd );
    d._ty         = bOK ? edg_image : edg_stale;
-   if ( !(nf=rec->_nFld) )
+   if ( !nf ) {
+      if ( tmp && ( tmp != stk ) )
+         delete[] tmp;
       return d;
-   d._flds = new rtFIELD[nf];
+   }
+   if ( arena )
+      d._flds = (rtFIELD *)arena->Alloc( nf * sizeof( rtFIELD ) );
+   else
+      d._flds = new rtFIELD[nf];
 
    // 3) Safe to walk 'em through 
 
@@ -294,13 +440,154 @@ LVCData GLlvcDb::GetItem_safe( const char *pSvc,
       def  = _schema[idx];
       copy = d._copy + ( fp-dp );
       if ( CanAddField( def._fid ) )
-         d._flds[n++] = GetField( *h, fp, def._fid, bShallow, copy );
+         d._flds[n++] = GetField( *h, fp, def._fid, bShallow, copy, arena );
       fOff += def._len;
    }
    d._nFld = n;
+   if ( tmp && ( tmp != stk ) )
+      delete[] tmp;
    return d;
 }
 
+Bool GLlvcDb::CopyRecord( GLlvcDbItem *rec, char *dst, int siz )
+{
+   GLlvcDbItem *cpy;
+   int          i;
+
+   /*
+    * Seqlock-style : Copy; Re-check version ( _nUpd, _tUpd, _tUpdUs ),
+    * then entire record in case writer bumps version after the data.
+    * Retry on mismatch.
+    */
+   cpy = (GLlvcDbItem *)dst;
+   for ( i=0; i<LVC_MAX_RETRY; i++ ) {
+      ::memcpy( dst, rec, siz );
+      ATOMIC_BARRIER();
+      if ( ( cpy->_nUpd   == rec->_nUpd   ) &&
+           ( cpy->_tUpd   == rec->_tUpd   ) &&
+           ( cpy->_tUpdUs == rec->_tUpdUs ) &&
+           !::memcmp( dst, rec, siz ) )
+         return True;
+   }
+   return False;
+}
+
+int GLlvcDb::SnapAll( LVCData *tkrs, int nThr, char **arena )
+{
+   Locker           lck( _mtx, !_bLockFree );
+   GLlvcDbItem     *rec;
+   LVCOffsets       odb;
+   char            *bp;
+   size_t           nr;
+   int              i, ns, off;
+
+   /*
+    * 1) Record offsets in on-disk order : Index slots, else file order;
+    *    Service filter from mmap.  No more than NumRecs() : tkrs[] size.
+    */
+   bp = data();
+   nr = NumRecs();
+   ns = NumSlots();
+   odb.reserve( nr );
+   for ( i=0; i<ns && odb.size()<nr; i++ ) {
+      if ( !(off=RecOffAt( i )) )
+         continue; // for-i
+      rec = (GLlvcDbItem *)( bp+off );
+      if ( CanAddItem( rec->_svc, rec->_tkr ) )
+         odb.push_back( off );
+   }
+   return SnapOffsets( odb, tkrs, nThr, arena );
+}
+
+int GLlvcDb::SnapOffsets( LVCOffsets &odb, 
+                          LVCData    *tkrs, 
+                          int         nThr, 
+                          char      **arena )
+{
+   Locker         lck( _mtx, !_bLockFree );
+   Locker         sl( _snapMtx );
+   GLlvcSnapJobs &jdb = _snapJobs;
+   int            i, n, nj, beg, end;
+
+   if ( !(n=(int)odb.size()) )
+      return 0;
+
+   /*
+    * 1) Partition across nj workers; Calling thread takes 1st slice
+    *    Workers live in _snapJobs across calls : Grow only if more needed
+    *    _snapMtx : SnapAll() from 2 threads when lock-free
+    */
+   nj = WithinRange( 1, nThr, gmax( 1, n / LVC_MIN_SLICE ) );
+   for ( i=(int)jdb.size(); i<nj; i++ )
+      jdb.push_back( new GLlvcSnapJob( *this, ( i > 0 ) ) );
+   for ( i=0; i<nj; i++ ) {
+      beg = i*n/nj;
+      end = (i+1)*n/nj;
+      jdb[i]->Set( odb, tkrs, ( arena != NULL ), beg, end );
+   }
+   for ( i=1; i<nj; jdb[i++]->Start() );
+   jdb[0]->Run();
+   for ( i=1; i<nj; jdb[i++]->Join() );
+
+   // 2) Splice each worker's arena blocks into 1 chain
+
+   if ( arena ) {
+      *arena = (char *)0;
+      for ( i=nj-1; i>=0; i-- )
+         *arena = jdb[i]->arena()->Detach( *arena );
+   }
+   return n;
+}
+
+double GLlvcDb::GetChanged( double tWm, LVCOffsets &odb )
+{
+   Locker       lck( _mtx, !_bLockFree );
+   GLlvcDbItem *rec;
+   char        *bp;
+   double       rc, tu, td;
+   int          i, ns, off;
+
+   /*
+    * Header-only pass in file order : No copy; No allocation
+    *    Changed if _tUpd.Us > tWm or _tDead in / after tWm second
+    *
+    * New watermark is the newest _tUpd / _tDead we saw, not our clock : 
+    * A record stamped by the LVC writer before we read the clock, but 
+    * stored after we passed it, is still newer than the watermark.
+    */
+   rc = tWm;
+   Load();
+   bp = data();
+   ns = NumSlots();
+   for ( i=0; i<ns; i++ ) {
+      if ( !(off=RecOffAt( i )) )
+         continue; // for-i
+      rec = (GLlvcDbItem *)( bp+off );
+      tu  = rec->_tUpd + ( 1.0E-6 * rec->_tUpdUs );
+      td  = rec->_tDead + 1.0;
+      rc  = gmax( rc, tu );
+      rc  = gmax( rc, (double)rec->_tDead );
+      if ( ( tu <= tWm ) && ( td <= tWm ) )
+         continue; // for-i
+      if ( CanAddItem( rec->_svc, rec->_tkr ) )
+         odb.push_back( off );
+   }
+   return rc;
+}
+
+void GLlvcDb::SetLockFree( bool bLockFree )
+{
+   Locker lck( _mtx );
+
+   /*
+    * Load() current shape before freezing it : Record map and file
+    * mapping are not touched again while lock-free.
+    */
+   _bLockFree = false;
+   Load();
+   _bLockFree = bLockFree;
+}
+
 int GLlvcDb::SetFilter( const char *flds, const char **svcs )
 {
    FIDSet              &fdb   = _fidFltr;
@@ -380,14 +667,18 @@ void GLlvcDb::Detach( Cockpit *c )
 ////////////////////////////////////////////
 void GLlvcDb::Load()
 {
-   Locker           lck( _mtx );
    RecMap::iterator it;
    GLlvcDbItem     *rec;
    string           s;
    char            *bp, *pn;
    int              off;
 
-   // Pre-condition
+   // Pre-condition : Shape frozen if lock-free
+
+   if ( _bLockFree )
+      return;
+
+   Locker lck( _mtx );
 
    if ( db()._freeIdx == _freeIdx )
       return;
@@ -395,15 +686,24 @@ void GLlvcDb::Load()
    // 1) Blow away existing
 
    _recs.clear();
+   _recOffs.clear();
    _freeIdx = db()._freeIdx;
+   _bIdxOK  = _bIdx && ( db4()._idx._freeIdx == _freeIdx );
+   _nIdxRec = _bIdxOK ? db4()._idx._nRec : 0;
    bp = map( 0, _freeIdx );
    if ( !isValid() )
       return;
 
-   // 2) Walk thru GLlvcDbItem's, storing offsets
+   /*
+    * 2) Index current : Nothing to build; FindIdx() / RecOffAt() read 
+    *    the mmap'ed slots directly
+    */
+   if ( _bIdxOK )
+      return;
+
+   // 3) Else walk thru GLlvcDbItem's, storing offsets
 
-   off  = _h3Sz;
-   off += ( _fSz * db()._nFlds );
+   off = _recOff;
    while( off<_freeIdx ) {
       rec = (GLlvcDbItem *)( bp+off );
       s   = MapKey( rec->_svc, rec->_tkr );
@@ -411,13 +711,20 @@ void GLlvcDb::Load()
       _recs[s] = off;
       off += rec->_siz;
    }
+
+   // 4) Unique offsets in file order for SnapAll() / GetChanged()
+
+   _recOffs.reserve( _recs.size() );
+   for ( it=_recs.begin(); it!=_recs.end(); _recOffs.push_back( (*it).second ), it++ );
+   std::sort( _recOffs.begin(), _recOffs.end() );
 }
 
 rtFIELD GLlvcDb::GetField( GLlvcFldHdr &h, 
                            char        *fp, 
                            int          fid, 
                            Bool         bShallow,
-                           char        *copy )
+                           char        *copy,
+                           GLlvcArena  *arena )
 {
    SchemaByFid          &sdb = _schemaByFid;
    SchemaByFid::iterator it;
@@ -475,7 +782,10 @@ rtFIELD GLlvcDb::GetField( GLlvcFldHdr &h,
          if ( _bFullCopy )
             b._data = copy;
          else {
-            b._data = new char[b._dLen+4];
+            if ( arena )
+               b._data = arena->Alloc( b._dLen+4 );
+            else
+               b._data = new char[b._dLen+4];
             ::memset( b._data, 0, b._dLen+4 );
             ::memcpy( b._data, fp, b._dLen );
          }
@@ -502,6 +812,247 @@ string GLlvcDb::MapKey( const char *pSvc, const char *pTkr )
    return s;
 }
 
+int GLlvcDb::FindIdx( const char *pSvc, const char *pTkr )
+{
+   char *bp;
+   int   ix, off;
+
+   /*
+    * Slot may be written by LVC server past what we have Load()'ed
+    */
+   bp  = data();
+   ix  = FindSlot( bp, slots(), db4()._idx._nSlot, _freeIdx, pSvc, pTkr );
+   off = ( ix != -1 ) ? slots()[ix] : 0;
+   if ( ( off < _recOff ) || ( off >= _freeIdx ) )
+      return -1;
+   return off;
+}
+
+
+////////////////////////////////////////////
+// Class-wide
+////////////////////////////////////////////
+u_int GLlvcDb::HashKey( const char *pSvc, const char *pTkr )
+{
+   const u_char *cp;
+   u_int         h;
+
+   // FNV-1a : svc|tkr; Part of LVC_SIG_006 file format
+
+   h = 2166136261U;
+   for ( cp=(const u_char *)pSvc; *cp; h = ( h ^ *cp++ ) * 16777619U );
+   h = ( h ^ (u_char)LVC_SVCSEP[0] ) * 16777619U;
+   for ( cp=(const u_char *)pTkr; *cp; h = ( h ^ *cp++ ) * 16777619U );
+   return h;
+}
+
+int GLlvcDb::FindSlot( char       *bp, 
+                       LVCint     *sp, 
+                       int         nSlot, 
+                       int         maxOff,
+                       const char *pSvc, 
+                       const char *pTkr )
+{
+   GLlvcDbItem *rec;
+   int          i, ix, off;
+
+   /*
+    * Slot holding ( svc,tkr ), else first empty slot to insert into;
+    * -1 if table full.  Records at or past maxOff are not looked at.
+    */
+   ix = HashKey( pSvc, pTkr ) & ( nSlot-1 );
+   for ( i=0; i<nSlot; i++, ix=( ix+1 ) & ( nSlot-1 ) ) {
+      if ( !(off=sp[ix]) )
+         return ix;
+      if ( off >= maxOff )
+         continue; // for-i
+      rec = (GLlvcDbItem *)( bp+off );
+      if ( !::strcmp( rec->_tkr, pTkr ) && !::strcmp( rec->_svc, pSvc ) )
+         return ix;
+   }
+   return -1;
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+//              c l a s s      G L l v c A r e n a
+//
+/////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////
+// Constructor
+////////////////////////////////////////////
+GLlvcArena::GLlvcArena() :
+   _blk( (char *)0 ),
+   _cp( (char *)0 ),
+   _ep( (char *)0 )
+{
+}
+
+
+////////////////////////////////////////////
+// Operations
+////////////////////////////////////////////
+char *GLlvcArena::Alloc( size_t sz )
+{
+   char  *rc;
+   size_t bSz;
+
+   // Aligned; New block if no room in current
+
+   sz  = ( sz + LVC_ARENA_ALIGN-1 ) & ~( (size_t)LVC_ARENA_ALIGN-1 );
+   if ( (size_t)( _ep-_cp ) < sz ) {
+      bSz            = gmax( sz + sizeof( char * ), (size_t)LVC_ARENA_BLOCK );
+      rc             = new char[bSz];
+      *(char **)rc   = _blk;
+      _blk           = rc;
+      _cp            = rc + sizeof( char * );
+      _ep            = rc + bSz;
+   }
+   rc   = _cp;
+   _cp += sz;
+   return rc;
+}
+
+char *GLlvcArena::Detach( char *nxt )
+{
+   char *rc, *blk;
+
+   // Our chain, with nxt appended; Caller owns it
+
+   if ( !(rc=_blk) )
+      return nxt;
+   for ( blk=_blk; *(char **)blk; blk=*(char **)blk );
+   *(char **)blk = nxt;
+   _blk          = (char *)0;
+   _cp           = (char *)0;
+   _ep           = (char *)0;
+   return rc;
+}
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+//            c l a s s      G L l v c S n a p J o b
+//
+/////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////
+// Constructor / Destructor
+////////////////////////////////////////////
+GLlvcSnapJob::GLlvcSnapJob( GLlvcDb &lvc, bool bThr ) :
+   _lvc( lvc ),
+   _offs( (LVCOffsets *)0 ),
+   _tkrs( (LVCData *)0 ),
+   _arena( (GLlvcArena *)0 ),
+   _bArena( false ),
+   _beg( 0 ),
+   _end( 0 ),
+   _go(),
+   _done(),
+   _bStop( false ),
+   _thr( (Thread *)0 )
+{
+   // Semaphore's start signalled : Take 'em so worker parks on _go
+
+   _go.Lock();
+   _done.Lock();
+   if ( bThr )
+      _thr = new Thread( GLlvcSnapJob::_Run, this, true );
+}
+
+GLlvcSnapJob::~GLlvcSnapJob()
+{
+   if ( _thr ) {
+      _bStop = true;
+      _go.Unlock();
+      _thr->Stop();
+      delete _thr;
+   }
+   if ( _arena )
+      delete _arena;
+}
+
+
+////////////////////////////////////////////
+// Access
+////////////////////////////////////////////
+GLlvcArena *GLlvcSnapJob::arena()
+{
+   return _arena;
+}
+
+
+////////////////////////////////////////////
+// Operations
+////////////////////////////////////////////
+void GLlvcSnapJob::Set( LVCOffsets &offs, 
+                        LVCData    *tkrs, 
+                        bool        bArena, 
+                        int         beg, 
+                        int         end )
+{
+   _offs   = &offs;
+   _tkrs   = tkrs;
+   _bArena = bArena;
+   _beg    = beg;
+   _end    = end;
+   if ( _bArena && !_arena )
+      _arena = new GLlvcArena();
+}
+
+void GLlvcSnapJob::Start()
+{
+   if ( _thr )
+      _go.Unlock();
+   else
+      Run();
+}
+
+void GLlvcSnapJob::Join()
+{
+   if ( _thr )
+      _done.Lock();
+}
+
+void GLlvcSnapJob::Run()
+{
+   LVCOffsets &odb = *_offs;
+   GLlvcArena *ar  = _bArena ? _arena : (GLlvcArena *)0;
+   LVCData     d;
+   double      d0;
+   int         i;
+
+   for ( i=_beg; i<_end; i++ ) {
+      d0       = dNow();
+      d        = _lvc.GetItemAt( odb[i], False, ar );
+      d._dSnap = ( dNow()-d0 );
+      _tkrs[i] = d;
+   }
+}
+
+
+////////////////////////////////////////////
+// Class-wide
+////////////////////////////////////////////
+void GLlvcSnapJob::_Run( void *arg )
+{
+   GLlvcSnapJob *job;
+
+   // Slice per _go; Until ~GLlvcSnapJob()
+
+   job = (GLlvcSnapJob *)arg;
+   for ( job->_go.Lock(); !job->_bStop; job->_go.Lock() ) {
+      job->Run();
+      job->_done.Unlock();
+   }
+}
+
+
 
 
 /////////////////////////////////////////////////////////////////////////////
@@ -515,12 +1066,15 @@ string GLlvcDb::MapKey( const char *pSvc, const char *pTkr )
 ////////////////////////////////////////////
 LVCDef::LVCDef( const char *file, 
                 bool        bLock, 
-                DWORD       waitMillis ) :
+                DWORD       waitMillis,
+                bool        bPopulate ) :
    _file( file ),
    _lvc( (GLlvcDb *)0 ),
-   _bFullCopy( false )
+   _bFullCopy( false ),
+   _nSnapThr( 1 ),
+   _bArena( false )
 {
-   _lvc = new GLlvcDb( *this, bLock, waitMillis );
+   _lvc = new GLlvcDb( *this, bLock, waitMillis, bPopulate );
 }
 
 LVCDef::~LVCDef()
@@ -552,3 +1106,18 @@ void LVCDef::SetCopyType( bool bFullCopy )
 {
    _bFullCopy = bFullCopy;
 }
+
+void LVCDef::SetSnapThreads( int nThr )
+{
+   _nSnapThr = gmax( 1, nThr );
+}
+
+void LVCDef::SetArena( bool bArena )
+{
+   _bArena = bArena;
+}
+
+void LVCDef::SetLockFree( bool bLockFree )
+{
+   lvc().SetLockFree( bLockFree );
+}
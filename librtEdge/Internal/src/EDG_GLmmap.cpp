@@ -14,8 +14,9 @@
 *      7 NOV 2017 jcs  Build 38: pFile()
 *     14 JAN 2024 jcs  Build 67: No mo OFF_T
 *     21 DEC 2025 jcs  Build 78: FILE_SHARE_DELETE
+*     17 OCT 2026 jcs  Build 80: advise(); populate(); willNeed(); touch(); PageFaults()
 *
-*  (c) 1994-2025, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <EDG_Internal.h>
 
@@ -75,7 +76,9 @@ GLmmap::GLmmap( MMAP_FD fd,
    _flags( flags ),
    _errno( 0 ),
    _w32LoSz( 0 ),
-   _w32HiSz( 0 )
+   _w32HiSz( 0 ),
+   _advice( mmap_normal ),
+   _bPopulate( False )
 {
    // Map to existing file, if non-zero len
 
@@ -104,7 +107,9 @@ GLmmap::GLmmap( char  *fname,
    _flags( flags ),
    _errno( 0 ),
    _w32LoSz( 0 ),
-   _w32HiSz( 0 )
+   _w32HiSz( 0 ),
+   _advice( mmap_normal ),
+   _bPopulate( False )
 {
    FPHANDLE    fp;
    const char *openFlags;
@@ -176,7 +181,9 @@ GLmmap::GLmmap( char *fname, char *addr, u_int64_t off, u_int64_t len ) :
    _flags( MAP_SHARED ),
    _errno( 0 ),
    _w32LoSz( 0 ),
-   _w32HiSz( 0 )
+   _w32HiSz( 0 ),
+   _advice( mmap_normal ),
+   _bPopulate( False )
 {
    FPHANDLE fp;
    u_int64_t    stSz;
@@ -292,13 +299,18 @@ int GLmmap::error()
    return _errno;
 }
 
+GLmmapAdvice GLmmap::advice()
+{
+   return _advice;
+}
+
 
 ////////////////////////////////////////////
 // Operations
 ////////////////////////////////////////////
 char *GLmmap::map( u_int64_t off, u_int64_t len, char *addr )
 {
-   int nPad;
+   int nPad, flags;
    int pgSz = GetPageSize();
 
    // Unmap / Map
@@ -328,15 +340,22 @@ char *GLmmap::map( u_int64_t off, u_int64_t len, char *addr )
                                         addr );
    _base = !_base ? (char *)MAP_FAILED : _base;
 #else
+   flags = _flags;
+#if defined(MAP_POPULATE)
+   flags |= _bPopulate ? MAP_POPULATE : 0;
+#endif // defined(MAP_POPULATE)
 #if defined(_LARGEFILE64_SOURCE)
-   _base = (char *)::mmap64( addr, _mLen, _prot, _flags, _fd, _mOff );
+   _base = (char *)::mmap64( addr, _mLen, _prot, flags, _fd, _mOff );
 #else
-   _base = (char *)::mmap( addr, _mLen, _prot, _flags, _fd, _mOff );
+   _base = (char *)::mmap( addr, _mLen, _prot, flags, _fd, _mOff );
 #endif // defined(_LARGEFILE64_SOURCE)
 #endif // WIN32
    _pa   = _base;
-   if ( isValid() )
+   if ( isValid() ) {
       _pa += nPad;
+      if ( _advice != mmap_normal )
+         _madvise();
+   }
    else
 #ifdef WIN32
       _errno = ::GetLastError();
@@ -371,6 +390,80 @@ void GLmmap::unmap()
    _off  = 0;
 }
 
+void GLmmap::advise( GLmmapAdvice adv )
+{
+   _advice = adv;
+   _madvise();
+}
+
+void GLmmap::populate( Bool bPopulate )
+{
+   _bPopulate = bPopulate;
+}
+
+void GLmmap::willNeed( u_int64_t off, u_int64_t len )
+{
+#ifndef WIN32
+   char     *cp;
+   u_int64_t nPad;
+
+   // Pre-condition
+
+   if ( !isValid() || ( off >= _len ) )
+      return;
+
+   // Page-align; Kernel reads ahead asynchronously
+
+   len  = gmin( len, _len-off );
+   cp   = _pa + off;
+   nPad = (u_int64_t)cp % SysPageSize();
+   ::madvise( cp-nPad, len+nPad, MADV_WILLNEED );
+#endif // WIN32
+}
+
+u_int64_t GLmmap::touch( u_int64_t off, u_int64_t len )
+{
+   volatile char *cp;
+   u_int64_t      i, pgSz, nPg;
+   char           ch;
+
+   // Pre-condition
+
+   if ( !isValid() || ( off >= _len ) )
+      return 0;
+
+   // 1 byte per page : Fault it in on the calling thread
+
+   len  = gmin( len, _len-off );
+   pgSz = SysPageSize();
+   cp   = _pa + off;
+   for ( i=0,nPg=0,ch=0; i<len; i+=pgSz,nPg++ )
+      ch += cp[i];
+   return nPg;
+}
+
+void GLmmap::_madvise()
+{
+#ifndef WIN32
+   int adv;
+
+   // Pre-condition
+
+   if ( !isValid() )
+      return;
+
+   // Whole mapping
+
+   switch( _advice ) {
+      case mmap_sequential: adv = MADV_SEQUENTIAL; break;
+      case mmap_random:     adv = MADV_RANDOM;     break;
+      default:              adv = MADV_NORMAL;     break;
+   }
+   if ( ::madvise( _base, _mLen, adv ) == -1 )
+      _errno = errno;
+#endif // WIN32
+}
+
 Bool GLmmap::_w32FileMapping( u_int64_t len )
 {
 #ifdef WIN32
@@ -614,6 +707,46 @@ int GLmmap::GetPageSize()
    return _pageSiz;
 }
 
+int GLmmap::SysPageSize()
+{
+   static int _sysPgSz = -1;
+
+   if ( _sysPgSz == -1 )
+#ifdef WIN32
+   {
+      SYSTEM_INFO si;
+
+      ::GetSystemInfo( &si );
+      _sysPgSz = si.dwPageSize;
+   }
+#else
+      _sysPgSz = ::getpagesize();
+#endif // WIN32
+   return _sysPgSz;
+}
+
+void GLmmap::PageFaults( u_int64_t &nMinor, u_int64_t &nMajor )
+{
+   nMinor = 0;
+   nMajor = 0;
+#ifndef WIN32
+   struct rusage ru;
+   int           who;
+
+   // Calling thread, if available
+
+#if defined(RUSAGE_THREAD)
+   who = RUSAGE_THREAD;
+#else
+   who = RUSAGE_SELF;
+#endif // defined(RUSAGE_THREAD)
+   if ( !::getrusage( who, &ru ) ) {
+      nMinor = ru.ru_minflt;
+      nMajor = ru.ru_majflt;
+   }
+#endif // WIN32
+}
+
 
 
 
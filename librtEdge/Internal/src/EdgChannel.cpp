@@ -30,8 +30,22 @@
 *     12 SEP 2024 jcs  Build 71: Handle !::mddSub_ParseHdr()
 *     22 DEC 2024 jcs  Build 74: ConnCbk()
 *      4 FEB 2025 jcs  Build 75: ReadOnce()
+*     17 OCT 2026 jcs  Build 80: Read() : Skip empty conflated update; DispatchBatch()
+*     17 OCT 2026 jcs  Build 80: CanLog() before any logging work
+*     17 OCT 2026 jcs  Build 80: _BuildFidTbl() : Dense FidDef by FID
+*     17 OCT 2026 jcs  Build 80: ioctl_tapeTickerIndex
+*     17 OCT 2026 jcs  Build 80: ioctl_tapeThreads; ioctl_tapeOrdered
+*     17 OCT 2026 jcs  Build 80: OnRead() : _IsEOF()
+*     17 OCT 2026 jcs  Build 80: ioctl_udpSubscribe : _OnUDP(); Gap detect / refresh
+*     17 OCT 2026 jcs  Build 80: OnRead() : _RecvUDP() ring; _OnUDP( pkt, pSz )
+*     17 OCT 2026 jcs  Build 80: TapeExport()
+*     17 OCT 2026 jcs  Build 80: ioctl_tapePrefetch
+*     17 OCT 2026 jcs  Build 80: ~EdgChannel() : RemoveIdle()
+*     17 OCT 2026 jcs  Build 80: TapeExport() : Log failure
+*     17 OCT 2026 jcs  Build 80: ioctl_tapeTickerIndex : Log failure
+*     17 OCT 2026 jcs  Build 80: DispatchBatch() : 1 _updMtx per batch
 *
-*  (c) 1994-2025, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <EDG_Internal.h>
 
@@ -47,6 +61,8 @@ using namespace RTEDGE_PRIVATE;
 static rtBUF       _zBUF  = { (char *)0, 0 };
 static const char *_undef = "Undefined";
 static const char *_err0  = "Invalid message : 0-length header";
+static const char *_errGap = "UDP sequence gap";
+static const char *_udpRfh = "<GetCache/>\n";
 
 ////////////////////////////////////////////
 // Constructor / Destructor
@@ -61,6 +77,9 @@ EdgChannel::EdgChannel( rtEdgeAttr     attr,
    _svcs(),
    _recs(),
    _schema( (rtEdgeData *)0 ),
+   _fidTbl( (FidDef *)0 ),
+   _nFidTbl( 0 ),
+   _fidOvfl(),
    _subscrID( 61202 ),
    _pumpID( 3381 ),
    _recU( (EdgRec *)0 ),
@@ -69,8 +88,17 @@ EdgChannel::EdgChannel( rtEdgeAttr     attr,
    _bRawData( true ),
    _bSvcTkr( true ),
    _bUsrStreamID( false ),
+   _udpRefresh( 0.0 ),
+   _udpSeq( 0 ),
+   _tUdpRefresh( 0.0 ),
+   _udpTkrs(),
+   _udpRecs(),
    _bTapeDir( true ),
+   _nTapeThr( 1 ),
+   _bTapeOrdered( true ),
+   _tapePrefetch( 0 ),
    _Q(),
+   _dsp(),
    _tape( (TapeChannel *)0 )
 {
    string s( attr._pUsername );
@@ -96,6 +124,7 @@ EdgChannel::EdgChannel( rtEdgeAttr     attr,
 
    ::memset( &_zzz, 0, sizeof( _zzz ) );
    ::memset( &_dfltStats, 0, sizeof( _dfltStats ) );
+   ::memset( _udpSession, 0, sizeof( _udpSession ) );
    SetStats( &_dfltStats );
 
    // Tape??
@@ -109,6 +138,7 @@ EdgChannel::~EdgChannel()
    SvcMap::iterator     it;
    RecByIdMap::iterator rt;
 
+   pump().RemoveIdle( EdgChannel::_OnIdle, this );
    if ( _tape )
       delete _tape;
    for ( it=_svcs.begin(); it!=_svcs.end(); delete (*it).second,it++ );
@@ -229,6 +259,7 @@ rtEdgeData EdgChannel::GetSchema()
    }
    _schema->_flds = fdb;
    _schema->_nFld = nf;
+   _BuildFidTbl();
    return *_schema;
 }
 
@@ -248,6 +279,29 @@ mddField *EdgChannel::GetDef( const char *pFld )
    return def;
 }
 
+FidDef *EdgChannel::GetFidDef( int fid )
+{
+   FidDefMap::iterator it;
+   FidDef             *def;
+
+   // Quickest : Array; Next quickest : map
+
+   if ( InRange( 0, fid, _nFidTbl-1 ) ) {
+      def = &_fidTbl[fid];
+      return def->_name ? def : (FidDef *)0;
+   }
+   it = _fidOvfl.find( fid );
+   return ( it != _fidOvfl.end() ) ? &((*it).second) : (FidDef *)0;
+}
+
+const char *EdgChannel::FidName( int fid )
+{
+   FidDef *def;
+
+   def = GetFidDef( fid );
+   return def ? def->_name : _undef;
+}
+
 rtFIELD *EdgChannel::GetField( const char *pFld )
 {
    mddField *def;
@@ -447,9 +501,11 @@ int EdgChannel::Unsubscribe( int StreamID )
 
    // Close on rtEdgeCache; Blow away ...
 
-   Close( *rec );
+   if ( !_bConnectionless )
+      Close( *rec );
    if ( (rt=_recs.find( StreamID )) != _recs.end() )
       _recs.erase( rt );
+   _udpRecs.clear();
    rec->_svc.Remove( rec );
    if ( rec->cache() )
       _Q.Close( rec->cache() );
@@ -509,6 +565,23 @@ int EdgChannel::StopPumpFullTape( int pumpID )
    return _tape ? _tape->StopPumpFullTape( pumpID ) : 0;
 }
 
+u_int64_t EdgChannel::TapeExport( const char *pFile, 
+                                  const char *tStart, 
+                                  const char *tEnd, 
+                                  const char *pTkrs, 
+                                  const char *pFlds )
+{
+   const char *err;
+   u_int64_t   rc;
+
+   if ( !_tape )
+      return 0;
+   rc = _tape->Export( pFile, tStart, tEnd, pTkrs, pFlds );
+   if ( _log && (err=_tape->err()) )
+      _log->logT( 1, "TapeExport( %s ) : %s\n", pFile ? pFile : "", err );
+   return rc;
+}
+
 
 ////////////////////////////////////////////
 // Operations - Conflate / RTD
@@ -554,10 +627,78 @@ int EdgChannel::Dispatch( int maxUpd, double dWait )
    return n;
 }
 
+int EdgChannel::DispatchBatch( rtEdgeData *ddb, int maxUpd, double dWait )
+{
+   Update      ctl;
+   string     *s;
+   const char *pc;
+   size_t      i, nb;
+   int         n, nf;
+   bool        bCtl;
+
+   /*
+    * All rtEdgeData._flds carved from _fldsU; Valid until next Read(), 
+    * Dispatch() or DispatchBatch()
+    *
+    * 1 _updMtx per batch : Held while we convert, so Close() can not 
+    * delete a Record from under us.  Conn / Svc / Schema callbacks run 
+    * outside it, then we pick up where we left off; Rest Unget()'ed.
+    */
+   _Q.Wait( dWait );
+   for ( n=0,nf=0,bCtl=true; bCtl && n<maxUpd && nf<MAX_FLD; ) {
+      bCtl = false;
+      {
+         Locker lck( _Q.mtx() );
+
+         _dsp.clear();
+         nb = _Q.GetBatch( _dsp, maxUpd-n );
+         for ( i=0; !bCtl && i<nb && n<maxUpd && nf<MAX_FLD; i++ ) {
+            Update &upd = _dsp[i];
+
+            switch( upd._mt ) {
+               case EVT_IMG:
+               case EVT_UPD:
+                  if ( _SetConflated( ddb[n], upd, &_fldsU[nf], MAX_FLD-nf ) )
+                     nf += ddb[n++]._nFld;
+                  if ( upd._msg )
+                     delete upd._msg;
+                  break;
+               default:
+                  ctl  = upd;
+                  bCtl = true;
+                  break;
+            }
+         }
+         _Q.Unget( _dsp, i );
+      }
+      if ( !bCtl )
+         break; // for-n
+      s  = ctl._msg;
+      pc = s ? s->c_str() : "Undefined";
+      switch( ctl._mt ) {
+         case EVT_CONN:
+            ConnCbk( pc, ( ctl._state == edg_up ) );
+            break;
+         case EVT_SVC:
+            if ( _attr._svcCbk )
+               (*_attr._svcCbk)( _cxt, pc, ctl._state );
+            break;
+         case EVT_SCHEMA:
+            if ( _attr._schemaCbk )
+               (*_attr._schemaCbk)( _cxt, GetSchema() );
+            break;
+         default:
+            break;
+      }
+      if ( s )
+         delete s;
+   }
+   return n;
+}
+
 int EdgChannel::Read( double dWait, rtEdgeRead &rd )
 {
    Update      upd;
-   Record     *rec;
    bool        bUpd;
    string     *s;
    const char *pc;
@@ -576,20 +717,8 @@ int EdgChannel::Read( double dWait, rtEdgeRead &rd )
    switch( upd._mt ) {
       case EVT_IMG:
       case EVT_UPD:
-         if ( !(rec=upd._rec) )
+         if ( !_SetConflated( rd._d, upd, _fldsU, MAX_FLD ) )
             return EVT_NONE;
-         rd._d._tMsg     = ::rtEdge_TimeNs();
-         rd._d._rawData  = "Conflated";
-         rd._d._rawLen   = 9;
-         rd._d._flds     = _fldsU;
-         rd._d._nFld     = rec->GetUpds( _fldsU );
-         rd._d._pSvc     = rec->pSvc();
-         rd._d._pTkr     = rec->pTkr();
-         rd._d._pErr     = "OK";
-         rd._d._arg      = (VOID_PTR)rec->StreamID();
-         rd._d._ty       = ( upd._mt == EVT_IMG ) ? edg_image : edg_update;
-         rd._d._StreamID = rec->StreamID();
-         rd._d._RTL      = 0; // _recU->_nUpd
          break;
      case EVT_CONN:
      case EVT_SVC:
@@ -623,6 +752,7 @@ bool EdgChannel::Ioctl( rtEdgeIoctl ctl, void *arg )
    bool       bArg, *pbArg;
    char      *pArg;
    u_int64_t *i64;
+   int        iArg;
 
    // 1) Base Socket Class??
 
@@ -635,6 +765,7 @@ bool EdgChannel::Ioctl( rtEdgeIoctl ctl, void *arg )
    pbArg = (bool *)arg; 
    pArg  = (char *)arg; 
    i64   = arg ? (u_int64_t *)arg : (u_int64_t *)0;
+   iArg  = (int)(size_t)arg;
    switch( ctl ) {
       case ioctl_rawData:
          _bRawData = bArg;
@@ -662,6 +793,32 @@ bool EdgChannel::Ioctl( rtEdgeIoctl ctl, void *arg )
          if ( _tape && i64 )
             *i64 = _tape->hdr()._curTime().tv_sec;
          return( _tape && i64 );
+      case ioctl_tapeTickerIndex:
+         if ( !_tape )
+            return false;
+         if ( _tape->BuildTickerIndex() )
+            return true;
+         if ( _log )
+            _log->logT( 1, "BuildTickerIndex() : %s\n", _tape->err() );
+         return false;
+      case ioctl_tapeThreads:
+         _nTapeThr = WithinRange( 1, iArg, K );
+         return true;
+      case ioctl_tapeOrdered:
+         _bTapeOrdered = bArg;
+         return true;
+      case ioctl_tapePrefetch:
+         _tapePrefetch = gmax( 0, iArg );
+         return true;
+      case ioctl_udpSubscribe:
+         if ( fd() || _tape )
+            return false;
+         _bConnectionless = bArg;
+         _udpPort         = ( bArg && _ports.size() ) ? _ports[0] : 0;
+         return true;
+      case ioctl_udpGapRefresh:
+         _udpRefresh = 0.001 * gmax( 0, iArg );
+         return true;
       default:
          break;
    }
@@ -677,6 +834,14 @@ void EdgChannel::OnConnect( const char *pc )
    rtEdgeChanStats &st = stats();
    Update           u;
 
+   // UDP : Binary from connectionless PubChannel; No mount
+
+   if ( _bConnectionless ) {
+      _proto  = mddProto_Binary;
+      _udpSeq = 0;
+      ::mddWire_SetProtocol( _mdd, _proto );
+   }
+
    // Notify
 
    st._lastMsg = _tvNow().tv_sec;
@@ -728,7 +893,20 @@ void EdgChannel::OnRead()
 {
    Locker           lck( _mtx );
    rtEdgeChanStats &st = stats();
-   int              tot, nb;
+   int              i, tot, nb;
+
+   // UDP : Drain kernel queue into packet ring; Parse in place
+
+   if ( _bConnectionless && _rxBatch ) {
+      do {
+         nb = _RecvUDP();
+         for ( i=0; i<nb; i++ ) {
+            if ( _rxLen[i] > 0 )
+               _OnUDP( (const char *)&_rxQ[i], _rxLen[i] );
+         }
+      } while ( nb == _rxBatch );
+      return;
+   }
 
    // Normal (old) processing
 
@@ -751,7 +929,7 @@ void EdgChannel::OnRead()
    }
    setBlocking();
 #if !defined(WIN32)
-   if ( !tot )
+   if ( !tot && _IsEOF( nb ) )
       OnException();
 #endif // !defined(WIN32)
 }
@@ -766,6 +944,13 @@ void EdgChannel::_OnRead()
    struct timeval   tv;
    int              i, sz, nMsg, nb, nL;
 
+   // 1) UDP : 1 Mold64 packet in _in
+
+   if ( _bConnectionless ) {
+      _OnUDP( _in.bp(), _in.bufSz() );
+      return;
+   }
+
    // 2) OK, now we chop up ...
 
    cp = _in.bp();
@@ -787,10 +972,9 @@ void EdgChannel::_OnRead()
       nMsg  += 1;
       if ( _log && _log->CanLog( 2 ) ) {
          Locker lck( _log->mtx() );
-         string s( cp, nb );
 
          _log->logT( 2, "[XML-RX]" );
-         _log->Write( 2, s.c_str(), nb );
+         _log->Write( 2, cp, nb );
       }
       switch( _proto ) {
          case mddProto_Undef:  break;
@@ -825,6 +1009,78 @@ void EdgChannel::_OnRead()
    _in.Set( nL );
 }
 
+void EdgChannel::_OnUDP( const char *pkt, int pSz )
+{
+   Locker           lck( _mtx );
+   rtEdgeChanStats &st = stats();
+   Mold64PktHdr     ph;
+   Mold64MsgHdr     mh;
+   const char      *cp;
+   u_int64_t        seq, nSkip;
+   int              i, sz, nMsg, mSz;
+   bool             bLen;
+
+   // Pre-condition
+
+   cp = pkt;
+   sz = pSz;
+   if ( sz < (int)sizeof( ph ) )
+      return;
+   ::memcpy( &ph, cp, sizeof( ph ) );
+   cp  += sizeof( ph );
+   sz  -= sizeof( ph );
+   seq  = ph._wire_seqNum;
+   nMsg = ph._wire_numMsg;
+   st._lastMsg = _tvNow().tv_sec;
+
+   // 1) New session : Publisher restarted
+
+   if ( ::memcmp( _udpSession, ph._session, sizeof( _udpSession ) ) ) {
+      ::memcpy( _udpSession, ph._session, sizeof( _udpSession ) );
+      _udpSeq = 0;
+   }
+
+   // 2) Heartbeat (non-sequenced) or duplicate
+
+   if ( _udpSeq && ( seq+nMsg <= _udpSeq ) )
+      return;
+
+   // 3) Gap
+
+   if ( _udpSeq && ( seq > _udpSeq ) ) {
+      st._nUdpGap  += 1;
+      st._nUdpLost += ( seq - _udpSeq );
+      _OnUdpGap( seq - _udpSeq );
+   }
+   nSkip   = ( _udpSeq > seq ) ? _udpSeq - seq : 0;
+   _udpSeq = seq + nMsg;
+
+   /*
+    * 4) Batched : <Mold64MsgHdr><msg> ...
+    *    Else    : 1 mddBinary msg; 1st 2 bytes of its length always 0
+    */
+   bLen = false;
+   if ( sz >= (int)sizeof( mh ) ) {
+      ::memcpy( &mh, cp, sizeof( mh ) );
+      bLen = ( mh._len != 0 );
+   }
+   for ( i=0; i<nMsg && sz>0; i++ ) {
+      mSz = sz;
+      if ( bLen ) {
+         ::memcpy( &mh, cp, sizeof( mh ) );
+         cp  += sizeof( mh );
+         sz  -= sizeof( mh );
+         mSz  = gmin( (int)mh._len, sz );
+      }
+      if ( i >= (int)nSkip )
+         _OnUdpMsg( cp, mSz );
+      cp += mSz;
+      sz -= mSz;
+   }
+   st._nUdpPkt += 1;
+   st._nUdpMsg += nMsg;
+}
+
 
 ////////////////////////////////////////////
 // TimerEvent Notifications
@@ -864,8 +1120,8 @@ void EdgChannel::OnMF( mddMsgBuf b, const char *ty )
    rtEdgeChanStats &st = stats();
    EdgSvc          *svc;
    bool             bUp, bImg, bBin;
-   const char      *pn, *pSvc, *pTkr;
-   int              i, sz, fid;
+   const char      *pSvc, *pTkr;
+   int              i, sz;
    mddWireMsg       m;
    mddBuf          &bSvc = m._svc;
    mddBuf          &bTkr = m._tkr;
@@ -874,12 +1130,11 @@ void EdgChannel::OnMF( mddMsgBuf b, const char *ty )
 
    // 1) Log, if required
 
-   if ( _log ) {
+   if ( _log && _log->CanLog( 1 ) ) {
       Locker lck( _log->mtx() );
-      string s( b._data, b._dLen );
 
       _log->logT( 1, "[%s-RX %06d bytes]\n    ", ty, b._dLen );
-      _log->HexLog( 4, s.c_str(), b._dLen );
+      _log->HexLog( 4, b._data, b._dLen );
    }
 
    // 2) Parse
@@ -887,7 +1142,7 @@ void EdgChannel::OnMF( mddMsgBuf b, const char *ty )
    m._flds = _fl;
    if ( !(sz=::mddSub_ParseMsg( _mdd, b, &m )) )
       return;
-   _recU = GetRec( m._tag );
+   _recU = _bConnectionless ? _GetUdpRec( m._tag ) : GetRec( m._tag );
    _fl   = m._flds;
 
    // 3) On-pass by msg type ...
@@ -896,7 +1151,6 @@ void EdgChannel::OnMF( mddMsgBuf b, const char *ty )
    rtEdgeData &d   = _recU ? _recU->upd() : dz;
    rtFIELD    *fdb = (rtFIELD *)fl._flds;
    int         nf  = fl._nFld;
-   mddField   *def;
    Record     *c;
    Update      u;
 
@@ -924,12 +1178,8 @@ void EdgChannel::OnMF( mddMsgBuf b, const char *ty )
          }
          if ( (c=_recU->cache()) )
             c->Cache( fl );
-         for ( i=0; i<nf; i++ ) {
-            fid = fdb[i]._fid;
-            def = GetDef( fid );
-            pn  = def ? def->_name : "Undefined";
-            fdb[i]._name = pn;
-         }
+         for ( i=0; i<nf; i++ )
+            fdb[i]._name = FidName( fdb[i]._fid );
          d._flds = fdb;
          d._nFld = nf;
          if ( _bSvcTkr ) {
@@ -1215,6 +1465,7 @@ void EdgChannel::OnXMLIoctl( mddMsgHdr &h )
    if ( strlen( (pAttr=_GetAttr( h, _mdd_pAttrDict )) ) ) {
       _ClearSchema();
       ::mddWire_SetSchema( _mdd, pAttr );
+      GetSchema();
       if ( _attr._schemaCbk ) {
          if ( _bConflate ) {
             ::memset( &u, 0, sizeof( u ) );
@@ -1256,6 +1507,205 @@ void EdgChannel::_ClearSchema()
       delete _schema;
    }
    _schema = (rtEdgeData *)0;
+   if ( _fidTbl )
+      delete[] _fidTbl;
+   _fidTbl  = (FidDef *)0;
+   _nFidTbl = 0;
+   _fidOvfl.clear();
+}
+
+void EdgChannel::_BuildFidTbl()
+{
+   rtFIELD *fdb;
+   FidDef   def;
+   int      i, nf, fid, maxFid;
+
+   /*
+    * Once per schema : Dense by FID in [ 0, _MAX_DENSE_FID );
+    * Negative and sparse FIDs into _fidOvfl
+    */
+   fdb    = _schema->_flds;
+   nf     = _schema->_nFld;
+   maxFid = -1;
+   for ( i=0; i<nf; i++ ) {
+      fid = (int)fdb[i]._fid;
+      if ( fid >= 0 )
+         maxFid = gmax( maxFid, fid );
+   }
+   _nFidTbl = WithinRange( 0, maxFid+1, _MAX_DENSE_FID );
+   _fidTbl  = _nFidTbl ? new FidDef[_nFidTbl] : (FidDef *)0;
+   if ( _fidTbl )
+      ::memset( _fidTbl, 0, _nFidTbl * sizeof( FidDef ) );
+   for ( i=0; i<nf; i++ ) {
+      fid       = (int)fdb[i]._fid;
+      def._name = fdb[i]._name;
+      def._type = fdb[i]._type;
+      def._off  = i;
+      if ( InRange( 0, fid, _nFidTbl-1 ) )
+         _fidTbl[fid] = def;
+      else
+         _fidOvfl[fid] = def;
+   }
+}
+
+bool EdgChannel::_SetConflated( rtEdgeData &d, 
+                                Update     &upd, 
+                                rtFIELD    *fdb, 
+                                int         maxFld )
+{
+   Record *rec;
+
+   // Changed fields only : Record.GetUpds() consumes Field._bUpd
+
+   if ( !(rec=upd._rec) )
+      return false;
+   ::memset( &d, 0, sizeof( d ) );
+   d._tMsg     = ::rtEdge_TimeNs();
+   d._rawData  = "Conflated";
+   d._rawLen   = 9;
+   d._flds     = fdb;
+   d._nFld     = rec->GetUpds( fdb, maxFld );
+   d._pSvc     = rec->pSvc();
+   d._pTkr     = rec->pTkr();
+   d._pErr     = "OK";
+   d._arg      = (VOID_PTR)rec->StreamID();
+   d._ty       = ( upd._mt == EVT_IMG ) ? edg_image : edg_update;
+   d._StreamID = rec->StreamID();
+   d._RTL      = 0; // _recU->_nUpd
+   /*
+    * Fields left over if maxFld exceeded : Re-queue
+    */
+   if ( rec->HasUpds() )
+      _Q.Add( upd );
+   /*
+    * Re-queued while in EventPump batch; Already dispatched
+    */
+   if ( !d._nFld && ( upd._mt == EVT_UPD ) )
+      return false;
+   return true;
+}
+
+void EdgChannel::_OnUdpMsg( const char *cp, int len )
+{
+   rtEdgeChanStats &st = stats();
+   mddMsgBuf        b;
+   mddMsgHdr        h;
+   struct timeval   tv;
+
+   // 1) Header
+
+   b._data = (char *)cp;
+   b._dLen = len;
+   b._hdr  = (mddMsgHdr *)0;
+   h       = _InitHdr( mddMt_undef );
+   if ( ::mddSub_ParseHdr( _mdd, b, &h ) <= 0 )
+      return;
+   b._hdr  = &h;
+
+   // 2) Heartbeat not sequenced; Stream ID announcement; Else data
+
+   switch( h._mt ) {
+      case mddMt_ping:    break;
+      case mddMt_dbTable: _OnUdpStreamID( b ); break;
+      default:            OnBinary( b );       break;
+   }
+   _ClearUpd();
+
+   // Stats
+
+   tv            = _tvNow();
+   st._lastMsg   = tv.tv_sec;
+   st._lastMsgUs = tv.tv_usec;
+   st._nMsg     += 1; 
+}
+
+void EdgChannel::_OnUdpStreamID( mddMsgBuf b )
+{
+   RecByIdMap::iterator rt;
+   mddWireMsg           m;
+   mddField            *fdb;
+   int                  i, nf;
+
+   // PubChannel._PubStreamID() : _FID_STREAMID / _FID_TICKER
+
+   m._flds = _fl;
+   if ( !::mddSub_ParseMsg( _mdd, b, &m ) )
+      return;
+   fdb = m._flds._flds;
+   nf  = m._flds._nFld;
+   for ( i=0; i<nf; i++ ) {
+      if ( fdb[i]._fid != _FID_TICKER )
+         continue; // for-i
+
+      mddBuf &bt = fdb[i]._val._buf;
+      string  tkr( bt._data, bt._dLen );
+
+      if ( _udpTkrs[m._tag] != tkr ) {
+         _udpTkrs[m._tag] = tkr;
+         if ( (rt=_udpRecs.find( m._tag )) != _udpRecs.end() )
+            _udpRecs.erase( rt );
+      }
+   }
+}
+
+void EdgChannel::_OnUdpGap( u_int64_t nLost )
+{
+   RecByIdMap::iterator rt;
+   EdgRec              *rec;
+   rtEdgeData           d;
+   struct sockaddr     *sa;
+   double               now;
+
+   if ( _log && _log->CanLog( 1 ) )
+      _log->logT( 1, "UDP gap : %lld msgs lost\n", (long long)nLost );
+
+   // 1) All open streams are suspect
+
+   for ( rt=_recs.begin(); rt!=_recs.end() && _attr._dataCbk; rt++ ) {
+      rec = (*rt).second;
+      ::memset( &d, 0, sizeof( d ) );
+      d._tMsg     = ::rtEdge_TimeNs();
+      d._pSvc     = rec->pSvc();
+      d._pTkr     = rec->pTkr();
+      d._pErr     = _errGap;
+      d._arg      = rec->_arg;
+      d._ty       = edg_recovering;
+      d._StreamID = rec->_StreamID;
+      (*_attr._dataCbk)( _cxt, d );
+   }
+
+   // 2) Refresh from publisher : Throttled
+
+   now = ::rtEdge_TimeNs();
+   if ( !_udpRefresh || ( ( now - _tUdpRefresh ) < _udpRefresh ) )
+      return;
+   _tUdpRefresh = now;
+   sa           = (struct sockaddr *)&_src;
+   ::sendto( fd(), _udpRfh, strlen( _udpRfh )+1, 0, sa, sizeof( _src ) );
+}
+
+EdgRec *EdgChannel::_GetUdpRec( int StreamID )
+{
+   RecByIdMap::iterator rt;
+   UdpTkrMap::iterator  tt;
+   SvcMap::iterator     it;
+   EdgRec              *rec;
+
+   // 1) Resolved already?
+
+   if ( (rt=_udpRecs.find( StreamID )) != _udpRecs.end() )
+      return (*rt).second;
+
+   // 2) Publisher StreamID -> Ticker -> Our record in any service
+
+   rec = (EdgRec *)0;
+   if ( (tt=_udpTkrs.find( StreamID )) == _udpTkrs.end() )
+      return rec;
+   for ( it=_svcs.begin(); !rec && it!=_svcs.end(); it++ )
+      rec = (*it).second->GetRec( (*tt).second.data() );
+   if ( rec )
+      _udpRecs[StreamID] = rec;
+   return rec;
 }
 
 
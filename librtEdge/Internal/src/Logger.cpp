@@ -15,8 +15,9 @@
 *     21 MAR 2016 jcs  Build 32: Linux compatibility in libmddWire; 2 logT()'s
 *      3 JUN 2023 jcs  Build 63: HexDump()
 *      5 OCT 2023 jcs  Build 65: dbl2ttime()
+*     17 OCT 2026 jcs  Build 80: Check level before locking
 *
-*  (c) 1994-2023, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <EDG_Internal.h>
 
@@ -71,16 +72,17 @@ bool Logger::CanLog( int lvl )
 ////////////////////////////////////////////
 void Logger::log( int lvl, char *fmt, ... )
 {
-   Locker  lck( _mtx );
    char    sText[8*K];
    char   *sp;
    va_list ap;
 
-   // Pre-condition
+   // Pre-condition : Before we lock
 
    if ( !CanLog( lvl ) )
       return;
 
+   Locker lck( _mtx );
+
    // varargs ... Tried and True
 
    va_start( ap,fmt );
@@ -96,17 +98,18 @@ void Logger::log( int lvl, char *fmt, ... )
 
 void Logger::logT( int lvl, char *fmt, ... )
 {
-   Locker  lck( _mtx );
    char    sText[8*K];
    char   *sp;
    va_list ap;
    string  s;
 
-   // Pre-condition
+   // Pre-condition : Before we lock
 
    if ( !CanLog( lvl ) )
       return;
 
+   Locker lck( _mtx );
+
    // varargs ... Tried and True
 
    va_start( ap,fmt );
@@ -122,17 +125,18 @@ void Logger::logT( int lvl, char *fmt, ... )
 
 void Logger::logT( int lvl, const char *fmt, ... )
 {
-   Locker  lck( _mtx );
    char    sText[8*K];
    char   *sp;
    va_list ap;
    string  s;
 
-   // Pre-condition
+   // Pre-condition : Before we lock
 
    if ( !CanLog( lvl ) )
       return;
 
+   Locker lck( _mtx );
+
    // varargs ... Tried and True
 
    va_start( ap,fmt );
@@ -148,9 +152,9 @@ void Logger::logT( int lvl, const char *fmt, ... )
 
 void Logger::Write( int lvl, const char *data, int dLen )
 {
-   Locker  lck( _mtx );
-
    if ( CanLog( lvl ) ) {
+      Locker lck( _mtx );
+
       ::fwrite( data, dLen, 1, _log );
       ::fflush( _log );
    }
@@ -158,11 +162,12 @@ void Logger::Write( int lvl, const char *data, int dLen )
 
 void Logger::HexDump( int lvl, const char *data, int dLen )
 {
-   Locker lck( _mtx );
-   char  *obuf;
-   int    nOut;
+   char *obuf;
+   int   nOut;
 
    if ( CanLog( lvl ) ) {
+      Locker lck( _mtx );
+
       obuf = new char[dLen*8];
       nOut = rtEdge_hexDump( (char *)data, dLen, obuf );
       ::fwrite( obuf, nOut, 1, _log );
@@ -173,11 +178,12 @@ void Logger::HexDump( int lvl, const char *data, int dLen )
 
 void Logger::HexLog( int lvl, const char *data, int dLen )
 {
-   Locker lck( _mtx );
-   char  *obuf;
-   int    nOut;
+   char *obuf;
+   int   nOut;
 
    if ( CanLog( lvl ) ) {
+      Locker lck( _mtx );
+
       obuf = new char[dLen*8];
       nOut = rtEdge_hexMsg( (char *)data, dLen, obuf );
       ::fwrite( obuf, nOut, 1, _log );
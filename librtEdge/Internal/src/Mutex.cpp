@@ -9,6 +9,7 @@
 *     12 NOV 2014 jcs  Build 28: Semaphore; RTEDGE_PRIVATE
 *     20 MAR 2016 jcs  Build 32: EDG_Internal.h
 *      8 JUN 2026 jcs  Build 79: Mutex.Lock() like GFC2; ::int64_t _cnt
+*     17 OCT 2026 jcs  Build 80: Locker( Mutex &, bool )
 *
 *  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
@@ -369,6 +370,14 @@ Locker::Locker( Mutex &mtx ) :
       _mtx.Lock();
 }
 
+Locker::Locker( Mutex &mtx, bool bLock ) :
+   _mtx( mtx ),
+   _bLock( bLock && ( mtx.tid() != mtx.CurrentThreadID() ) )
+{
+   if ( _bLock )
+      _mtx.Lock();
+}
+
 Locker::~Locker()
 {
    if ( _bLock )
@@ -32,8 +32,16 @@
 *     21 APR 2024 jcs  Build 71: OnConnect() / Ioctl() : Lock _mtx
 *      7 NOV 2024 jcs  Build 73: ioctl_setRawLog
 *     22 DEC 2024 jcs  Build 74: ConnCbk()
+*     17 OCT 2026 jcs  Build 80: OnRead() : No string copy for logging
+*     17 OCT 2026 jcs  Build 80: _FlushUDP() from _OnIdle(); Heartbeat in own packet
+*     17 OCT 2026 jcs  Build 80: _GetStreamCache() : Image on next Publish()
+*     17 OCT 2026 jcs  Build 80: PubGetData() : lastRef() if ioctl_gatherIO
+*     17 OCT 2026 jcs  Build 80: PublishBatch()
+*     17 OCT 2026 jcs  Build 80: PubRec._tmpl : mddPub_BuildMsgFromTemplate()
+*     17 OCT 2026 jcs  Build 80: ~PubChannel() : RemoveIdle()
+*     17 OCT 2026 jcs  Build 80: On1SecTimer() : No UDP heartbeat behind unsent packets
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <EDG_Internal.h>
 
@@ -89,6 +97,7 @@ PubChannel::~PubChannel()
    WatchListByName          &ndb = _wlByName;
    WatchListByName::iterator nt;
 
+   pump().RemoveIdle( PubChannel::_OnIdle, this );
    for ( nt=ndb.begin(); nt!=ndb.end(); delete (*nt++).second );
    ndb.clear();
    _wlByID.clear();
@@ -152,7 +161,24 @@ void PubChannel::InitSchema( rtEdgeDataFcn schemaCbk )
    _schemaCbk = schemaCbk;
 }
 
-int PubChannel::Publish( rtEdgeData &d )
+int PubChannel::PublishBatch( rtEdgeData *ddb, int nd )
+{
+   Locker lck( _mtx );
+   int    i, n;
+
+   /*
+    * 1 lock; Back-to-back into outbound buffer; 1 flush
+    */
+   for ( i=0,n=0; i<nd; i++ )
+      n += Publish( ddb[i], false ) ? 1 : 0;
+   if ( !_bConnectionless )
+      OnWrite();
+   else if ( _udpBatch )
+      _FlushUDP();
+   return n;
+}
+
+int PubChannel::Publish( rtEdgeData &d, bool bFlush )
 {
    Locker           lck( _mtx );
    rtEdgeChanStats &st = stats();
@@ -223,12 +249,24 @@ int PubChannel::Publish( rtEdgeData &d )
       fl._flds = (mddField *)d._flds;
       fl._nFld = d._nFld;
       nf       = ::mddPub_AddFieldList( _mdd, fl );
-      b        = ::mddPub_BuildMsg( _mdd, h, &_bldBuf );
+      b._data  = (char *)0;
+      b._dLen  = 0;
+      if ( _proto == mddProto_Binary ) {
+         mddMsgTemplate &t = pub->_tmpl;
+
+         // Header encoded once per stream; Rebuild if protocol changed
+
+         if ( !t._hdrLen || ( t._proto != _proto ) )
+            t = ::mddPub_BuildMsgTemplate( _mdd, h );
+         b = ::mddPub_BuildMsgFromTemplate( _mdd, &t, mt, h._RTL, &_bldBuf );
+      }
+      if ( !b._dLen )
+         b = ::mddPub_BuildMsg( _mdd, h, &_bldBuf );
    }
 
    // Write, stats, return bytes written
 
-   rtn           = Write( b._data, b._dLen ) ? b._dLen : 0;
+   rtn           = Write( b._data, b._dLen, bFlush ) ? b._dLen : 0;
    tv            = _tvNow();
    st._lastMsg   = tv.tv_sec;
    st._lastMsgUs = tv.tv_usec;
@@ -295,8 +333,13 @@ rtBUF PubChannel::PubGetData()
 {
    rtBUF b;
 
-   b._data = _bldBuf._data;
-   b._dLen = _bldBuf._dLen;
+   // ioctl_gatherIO : Last message built is queued; _bldBuf is pooled
+
+   b = oBuf().lastRef();
+   if ( !b._data ) {
+      b._data = _bldBuf._data;
+      b._dLen = _bldBuf._dLen;
+   }
    return b;
 }
 
@@ -326,7 +369,8 @@ void PubChannel::_GetStreamCache()
 
    _PubStreamSymList();
    for ( n=0,it=ndb.begin(); it!=ndb.end(); it++ ) {
-      rec = (*it).second;
+      rec         = (*it).second;
+      rec->_nOpn  = rec->_nImg + 1;  // Next Publish() is image
       if ( _attr._imgQryCbk )
          (*_attr._imgQryCbk)( _cxt, rec->pTkr(), (VOID_PTR)rec->_StreamID );
    }
@@ -644,10 +688,9 @@ void PubChannel::OnRead()
       nMsg++;
       if ( _log && _log->CanLog( 2 ) ) {
          Locker lck( _log->mtx() );
-         string s( cp, nb );
 
          _log->logT( 2, "[XML-RX] (%02d of ,%d) ", nb, sz );
-         _log->Write( 2, s.data(), nb );
+         _log->Write( 2, cp, nb );
       }
       OnXML( h );
       cp += nb;
@@ -700,8 +743,12 @@ void PubChannel::On1SecTimer()
 
    age = tv.tv_sec - st._lastMsg;
    if ( _bConnectionless && ( age > 1 ) ) {
-      _udp._wire_seqNum -= 1;  // Heartbeats are non-sequenced
-      _SendPing();
+      _FlushUDP();
+      if ( !_nUdpQ ) {            // Own packet : Not behind unsent ones
+         _udp._wire_seqNum -= 1;  // Heartbeats are non-sequenced
+         _SendPing();
+         _FlushUDP();
+      }
    }
 
    // 3) Heartbeat
@@ -981,6 +1028,8 @@ void PubChannel::_OnIdle( void *arg )
    PubChannel *us;
 
    us = (PubChannel *)arg;
+   if ( us->_bConnectionless )
+      us->_FlushUDP( false );
    us->OnIdle();
 }
 
@@ -1005,6 +1054,7 @@ PubRec::PubRec( PubChannel &pub,
    _nImg( 0 ),
    _nUpd( 0 )
 {
+   ::memset( &_tmpl, 0, sizeof( _tmpl ) );
 }
 
 PubRec::~PubRec()
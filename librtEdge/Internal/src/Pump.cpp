@@ -13,8 +13,13 @@
 *     17 OCT 2023 jcs  Build 65: poll() only; WIN64 working
 *     13 NOV 2023 jcs  Build 66: RTEDGE_PRIVATE::EventPump
 *     22 DEC 2024 jcs  Build 74: Socket.ConnCbk()
+*     17 OCT 2026 jcs  Build 80: EPollMap; PollMap grows; Dispatch all revents
+*     17 OCT 2026 jcs  Build 80: SetSpin() / _RunSpin()
+*     17 OCT 2026 jcs  Build 80: RemoveIdle( fcn, arg ); _OnTimer() under _mtx
+*     17 OCT 2026 jcs  Build 80: _RunSpin() : Snapshot fds; _mtx per Socket
+*     17 OCT 2026 jcs  Build 80: SetWritable( Socket *, bool ) : EPOLLOUT per fd
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <EDG_Internal.h>
 
@@ -50,6 +55,12 @@ static string _sockMsgName( "RTEDGE_PRICATE::EventPump" );
 static string _className( _sockMsgName );
 #endif // WIN32
 
+#if defined(linux)
+bool Pump::_bEPoll = true;
+#else
+bool Pump::_bEPoll = false;
+#endif // defined(linux)
+
 ////////////////////////////////////////////
 // Constructor / Destructor
 ////////////////////////////////////////////
@@ -60,12 +71,14 @@ Pump::Pump() :
    _idle(),
    _mtx(),
    _pollMap( (PollMap *)0 ),
+   _ePoll( (EPollMap *)0 ),
    _maxFd( 0 ),
 #ifdef WIN32
    _hWnd( 0 ),
    _tmrID( 0 ),
 #endif // WIN32
    _bRun( true ),
+   _bSpin( false ),
    _t0( dNow() )
 {
    _pollMap = new PollMap( *this );
@@ -79,6 +92,10 @@ Pump::~Pump()
    for ( it=_sox.begin(); it!=_sox.end(); delete (*it).second, it++ );
    _sox.clear();
    delete _pollMap;
+#if defined(linux)
+   if ( _ePoll )
+      delete _ePoll;
+#endif // defined(linux)
 }
 
  
@@ -93,6 +110,12 @@ void Pump::Add( Socket *s )
    if ( (fd=s->fd()) ) {
       Remove( s );
       _sox[fd] = s;
+#if defined(linux)
+      if ( _ePoll )
+         _ePoll->Add( s );
+      else
+         _UseEPoll();
+#endif // defined(linux)
    }
 }
 
@@ -105,6 +128,10 @@ void Pump::Remove( Socket *s )
    if ( (it=_sox.find( (fd=s->fd()) )) != _sox.end() )
       _sox.erase( it );
    _dels.push_back( fd );
+#if defined(linux)
+   if ( _ePoll && fd )
+      _ePoll->Remove( fd );
+#endif // defined(linux)
 }
 
 
@@ -135,12 +162,13 @@ void Pump::RemoveTimer( TimerEvent &t )
 
 void Pump::_OnTimer()
 {
+   Locker               lck( _mtx );
    TimerTable::iterator it;
-   EdgIdleCbk          cbk;
+   EdgIdleCbk           cbk;
    size_t               i;
    double               d1;
 
-   // Registered Idle functions
+   // Registered Idle functions : Under _mtx vs. RemoveIdle() on Shared Pump
 
    for ( i=0; i<_idle.size(); i++ ) {
       cbk = _idle[i];
@@ -188,12 +216,24 @@ void Pump::Run( double dPoll )
    struct timeval tv, *tm, tt;
    double         dt, age, tExp;
    PollMap       &pm = *_pollMap;
-   struct pollfd *pl = pm.pollList();
+   struct pollfd *pl;
 
    // Polling Interval
 
    for ( dt=dNow(); _bRun; ) {
+      if ( _bSpin ) {
+         _RunSpin( dPoll );
+         dt = dNow();
+         continue; // for-dt
+      }
+#if defined(linux)
+      if ( _ePoll ) {
+         _RunEPoll( dPoll );
+         break; // for-dt
+      }
+#endif // defined(linux)
       buildFDs();
+      pl    = pm.pollList();
       age   = dNow() - dt;
       tExp  = gmax( 0.0, dPoll - age );
       tv    = Logger::dbl2time( tExp );
@@ -219,7 +259,9 @@ void Pump::Run( double dPoll )
          {
             Locker lck( _mtx );
 
-            for ( i=0; i<rc; i++ ) {
+            for ( i=0; i<pm.nPoll(); i++ ) {
+               if ( !pl[i].revents )
+                  continue; // for-i
                fd = pl[i].fd;
                if ( !(sock=_sox[fd]) )
                   continue; // for-i
@@ -246,6 +288,7 @@ void Pump::Run( double dPoll )
 void Pump::Stop()
 {
    _bRun = false;
+   Wake();
 }
 
 void Pump::AddIdle( EdgIdleFcn fcn, void *arg )
@@ -258,7 +301,33 @@ void Pump::AddIdle( EdgIdleFcn fcn, void *arg )
    _idle.push_back( c );
 }
 
-void Pump::RemoveIdle( EdgIdleFcn fcn )
+void Pump::Wake()
+{
+#if defined(linux)
+   if ( _ePoll )
+      _ePoll->Wake();
+#endif // defined(linux)
+}
+
+void Pump::SetSpin( bool bSpin )
+{
+   _bSpin = bSpin;
+   Wake();
+}
+
+void Pump::SetWritable( Socket *s, bool bWr )
+{
+   /*
+    * Called from Socket.Write() / OnWrite() w/ Socket._mtx held : No _mtx 
+    * here, else we deadlock w/ _RunEPoll().  epoll_ctl() is thread-safe.
+    */
+#if defined(linux)
+   if ( _ePoll )
+      _ePoll->SetWritable( s, bWr );
+#endif // defined(linux)
+}
+
+void Pump::RemoveIdle( EdgIdleFcn fcn, void *arg )
 {
    Locker             lck( _mtx ); 
    EdgIdleCbk         c;
@@ -266,7 +335,7 @@ void Pump::RemoveIdle( EdgIdleFcn fcn )
 
    for ( it=_idle.begin(); it!=_idle.end(); it++ ) {
       c = (*it);
-      if ( c._fcn == fcn ) {
+      if ( ( c._fcn == fcn ) && ( c._arg == arg ) ) {
          _idle.erase( it );
          return;
       }
@@ -278,6 +347,35 @@ void Pump::RemoveIdle( EdgIdleFcn fcn )
 ////////////////////////////////////////////
 // Helpers
 ////////////////////////////////////////////
+bool Pump::_UseEPoll()
+{
+   /*
+    * Linux : Switch to epoll() once we carry _MIN_EPOLLFD Sockets.  By
+    * default each Socket runs its own Pump, which stays on poll() and does
+    * not hold the 3 extra descriptors; Channels on the Shared Pump from
+    * rtEdge_SetSharedPump() get here.
+    */
+#if defined(linux)
+   Locker            lck( _mtx );
+   Sockets::iterator it;
+
+   if ( _ePoll || !_bEPoll || ( _sox.size() < _MIN_EPOLLFD ) )
+      return( _ePoll != (EPollMap *)0 );
+   _ePoll = new EPollMap();
+   if ( !_ePoll->IsValid() ) {
+      delete _ePoll;
+      _ePoll = (EPollMap *)0;
+   }
+   for ( it=_sox.begin(); _ePoll && it!=_sox.end(); it++ ) {
+      if ( (*it).second )
+         _ePoll->Add( (*it).second );
+   }
+   return( _ePoll != (EPollMap *)0 );
+#else
+   return false;
+#endif // defined(linux)
+}
+
 void Pump::_Create()
 {
    // WIN32-specific
@@ -346,6 +444,106 @@ void Pump::_Destroy()
 #endif // WIN32
 }
 
+void Pump::_RunEPoll( double dPoll )
+{
+#if defined(linux)
+   EPollMap           &em = *_ePoll;
+   struct epoll_event *ev = em.evts();
+   Sockets::iterator   it;
+   Socket             *sock;
+   u_int32_t           evts;
+   bool                bTmr;
+   int                 i, fd, rc;
+
+   /*
+    * No re-build : EPOLLOUT armed per fd from Socket.Write() / OnWrite()
+    */
+   em.SetTimer( dPoll );
+   for ( ; _bRun; ) {
+      if ( _bSpin ) {
+         _RunSpin( dPoll );
+         continue; // for-EINTR
+      }
+      {
+         Locker lck( _mtx );
+
+         _dels.clear();
+      }
+      if ( (rc=em.Wait()) <= 0 )
+         continue; // for-EINTR
+      bTmr = false;
+      {
+         Locker lck( _mtx );
+
+         for ( i=0; i<rc; i++ ) {
+            fd   = ev[i].data.fd;
+            evts = ev[i].events;
+            if ( ( fd == em.tmrFd() ) || ( fd == em.wakeFd() ) ) {
+               em.Drain( fd );
+               bTmr |= ( fd == em.tmrFd() );
+               continue; // for-i
+            }
+            if ( (it=_sox.find( fd )) == _sox.end() )
+               continue; // for-i
+            if ( !(sock=(*it).second) )
+               continue; // for-i
+            if ( evts & ( EPOLLIN | EPOLLPRI ) )
+               sock->OnRead();
+            if ( ( evts & EPOLLOUT ) && ( sock->fd() == fd ) )
+               sock->OnWrite();
+            if ( ( evts & ( EPOLLERR | EPOLLHUP ) ) && ( sock->fd() == fd ) )
+               sock->OnException();
+         }
+      }
+      if ( bTmr )
+         _OnTimer();
+   }
+#endif // defined(linux)
+}
+
+void Pump::_RunSpin( double dPoll )
+{
+   Sockets::iterator it;
+   Socket           *sock;
+   SoxFD             fds;
+   double            now, tNxt;
+   size_t            i;
+
+   /*
+    * Busy-poll : No poll() / epoll_wait(); Non-blocking OnRead() on every
+    * Socket each pass.  Timers from rtEdge_ClockNs().
+    *
+    * Snapshot fds, then hold _mtx only while dispatching 1 Socket, so 
+    * Add() / Remove() from other threads get in during the pass.  Look 
+    * up by fd each time since OnRead() may Remove() a Socket.
+    */
+   tNxt = ::rtEdge_ClockNs() + dPoll;
+   for ( ; _bRun && _bSpin; ) {
+      {
+         Locker lck( _mtx );
+
+         fds.clear();
+         for ( it=_sox.begin(); it!=_sox.end(); fds.push_back( (*it).first ), it++ );
+         _dels.clear();
+      }
+      for ( i=0; i<fds.size(); i++ ) {
+         Locker lck( _mtx );
+
+         if ( (it=_sox.find( fds[i] )) == _sox.end() )
+            continue; // for-i
+         if ( !(sock=(*it).second) )
+            continue; // for-i
+         sock->OnRead();
+         if ( ( sock->fd() == fds[i] ) && sock->IsWritable() )
+            sock->OnWrite();
+      }
+      if ( (now=::rtEdge_ClockNs()) >= tNxt ) {
+         tNxt = now + dPoll;
+         _OnTimer();
+      }
+   }
+}
+
 int Pump::buildFDs()
 {
    Locker lck( _mtx );
@@ -505,6 +703,14 @@ void PollMap::buildFDs( Sockets &sdb )
    short             evts;
    int               fd, maxfd;
 
+   /*
+    * Grow : No cap on channels / thread
+    */
+   if ( (int)sdb.size() >= _maxx ) {
+      delete[] (u_char *)_pollList;
+      _maxx     = gmax( 2*_maxx, (int)sdb.size()+1 );
+      _pollList = (struct pollfd *)new u_char[_maxx * sizeof( struct pollfd )];
+   }
    maxfd  = 0;
    _nPoll = 0;
    for ( it=sdb.begin(); it!=sdb.end(); it++ ) {
@@ -529,3 +735,155 @@ void PollMap::Reset()
    for ( i=0; i<_nPoll; i++ )
       _pollList[i].revents = 0;
 }
+
+
+
+#if defined(linux)
+////////////////////////////////////////////////////////////////////////////////
+//
+//                  c l a s s      E P o l l M a p
+//
+////////////////////////////////////////////////////////////////////////////////
+
+static u_int32_t _epRdEvts = EPOLLIN  | EPOLLPRI | EPOLLRDHUP;
+static u_int32_t _epExEvts = EPOLLERR | EPOLLHUP;
+
+////////////////////////////////////////////
+// Constructor / Destructor
+////////////////////////////////////////////
+EPollMap::EPollMap() :
+   _epFd( ::epoll_create1( EPOLL_CLOEXEC ) ),
+   _tmrFd( ::timerfd_create( CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC ) ),
+   _wakeFd( ::eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC ) ),
+   _evts( new struct epoll_event[_MAX_EPOLLEVT] )
+{
+   struct epoll_event ev;
+
+   // Timer and Wake-up always readable; Level-triggered
+
+   if ( !IsValid() )
+      return;
+   ::memset( &ev, 0, sizeof( ev ) );
+   ev.events  = EPOLLIN;
+   ev.data.fd = _tmrFd;
+   ::epoll_ctl( _epFd, EPOLL_CTL_ADD, _tmrFd, &ev );
+   ev.data.fd = _wakeFd;
+   ::epoll_ctl( _epFd, EPOLL_CTL_ADD, _wakeFd, &ev );
+}
+
+EPollMap::~EPollMap()
+{
+   if ( _wakeFd != -1 )
+      ::close( _wakeFd );
+   if ( _tmrFd != -1 )
+      ::close( _tmrFd );
+   if ( _epFd != -1 )
+      ::close( _epFd );
+   delete[] _evts;
+}
+
+
+////////////////////////////////////////////
+// Access
+////////////////////////////////////////////
+bool EPollMap::IsValid()
+{
+   return( ( _epFd != -1 ) && ( _tmrFd != -1 ) && ( _wakeFd != -1 ) );
+}
+
+struct epoll_event *EPollMap::evts()
+{
+   return _evts;
+}
+
+int EPollMap::tmrFd()
+{
+   return _tmrFd;
+}
+
+int EPollMap::wakeFd()
+{
+   return _wakeFd;
+}
+
+
+////////////////////////////////////////////
+// Operations
+////////////////////////////////////////////
+void EPollMap::Add( Socket *sox )
+{
+   struct epoll_event ev;
+   int                fd;
+
+   /*
+    * Queued output, if any, from before we switched to epoll()
+    */
+   fd         = sox->fd();
+   ::memset( &ev, 0, sizeof( ev ) );
+   ev.events  = _epRdEvts | _epExEvts;
+   ev.events |= sox->IsConnectionless() ? 0 : EPOLLET;
+   ev.events |= sox->IsWritable() ? EPOLLOUT : 0;
+   ev.data.fd = fd;
+   if ( ::epoll_ctl( _epFd, EPOLL_CTL_ADD, fd, &ev ) )
+      ::epoll_ctl( _epFd, EPOLL_CTL_MOD, fd, &ev );
+}
+
+void EPollMap::Remove( int fd )
+{
+   struct epoll_event ev;
+
+   ::memset( &ev, 0, sizeof( ev ) );
+   ::epoll_ctl( _epFd, EPOLL_CTL_DEL, fd, &ev );
+}
+
+void EPollMap::SetWritable( Socket *sox, bool bWr )
+{
+   struct epoll_event ev;
+   int                fd;
+
+   /*
+    * Caller only calls on change; MOD re-arms edge if already writable
+    */
+   if ( !(fd=sox->fd()) )
+      return;
+   ::memset( &ev, 0, sizeof( ev ) );
+   ev.events  = _epRdEvts | _epExEvts;
+   ev.events |= sox->IsConnectionless() ? 0 : EPOLLET;
+   ev.events |= bWr ? EPOLLOUT : 0;
+   ev.data.fd = fd;
+   ::epoll_ctl( _epFd, EPOLL_CTL_MOD, fd, &ev );
+}
+
+void EPollMap::SetTimer( double dPoll )
+{
+   struct itimerspec ts;
+   u_int64_t         ns;
+
+   ns = (u_int64_t)( dPoll * 1.0E9 );
+   ns = gmax( ns, (u_int64_t)1000000 );
+   ts.it_interval.tv_sec  = ns / 1000000000;
+   ts.it_interval.tv_nsec = ns % 1000000000;
+   ts.it_value            = ts.it_interval;
+   ::timerfd_settime( _tmrFd, 0, &ts, (struct itimerspec *)0 );
+}
+
+bool EPollMap::Wake()
+{
+   u_int64_t one;
+
+   one = 1;
+   return( ::write( _wakeFd, &one, sizeof( one ) ) == sizeof( one ) );
+}
+
+bool EPollMap::Drain( int fd )
+{
+   u_int64_t val;
+
+   return( ::read( fd, &val, sizeof( val ) ) == sizeof( val ) );
+}
+
+int EPollMap::Wait()
+{
+   return ::epoll_wait( _epFd, _evts, _MAX_EPOLLEVT, -1 );
+}
+#endif // defined(linux)
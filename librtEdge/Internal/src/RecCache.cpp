@@ -11,8 +11,12 @@
 *     12 OCT 2015 jcs  Build 32: EDG_Internal.h
 *     23 MAY 2022 jcs  Build 54: rtFld_unixTime
 *     29 OCT 2022 jcs  Build 60: rtFld_vector
+*     17 OCT 2026 jcs  Build 80: EventPump ring; GetUpds() batch drain; HasUpds()
+*     17 OCT 2026 jcs  Build 80: GetField() : Dense _fdb; _flds if sparse
+*     17 OCT 2026 jcs  Build 80: GetOneUpd() / QueueSize() under _updMtx
+*     17 OCT 2026 jcs  Build 80: EventPump.GetBatch() / Unget() : 1 _updMtx per batch
 *
-*  (c) 1994-2022, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <EDG_Internal.h>
 
@@ -147,6 +151,7 @@ Record::Record( const char *pSvc, const char *pTkr, int StreamID ) :
    _StreamID( StreamID ),
    _mtx(),
    _flds(),
+   _fdb(),
    _upds(),
    _bQ( false ),
    _tUpd( 0.0 )
@@ -161,6 +166,7 @@ Record::~Record()
    for ( it=_flds.begin(); it!=_flds.end(); it++ )
       delete (*it).second;
    _flds.clear();
+   _fdb.clear();
    ::mddFieldList_Free( _fl );
 }
 
@@ -188,13 +194,17 @@ Field *Record::GetField( int fid )
    FldMap::iterator it;
    Field           *fld;
 
+   // Quickest : Array; Next quickest : map
+
+   if ( InRange( 0, fid, _REC_DENSE_FID-1 ) )
+      return ( fid < (int)_fdb.size() ) ? _fdb[fid] : (Field *)0;
    fld = (Field *)0;
    if ( (it=_flds.find( fid )) != _flds.end() )
       fld = (*it).second;
    return fld;
 }
 
-int Record::GetUpds( rtFIELD *fdb )
+int Record::GetUpds( rtFIELD *fdb, int maxFld )
 {
    Locker  lck( _mtx );
    Field  *fld;
@@ -202,7 +212,9 @@ int Record::GetUpds( rtFIELD *fdb )
    rtBUF  &b = f._val._buf;
    int     i, nf;
 
-   nf = _upds.size();
+   // Fields past maxFld remain dirty for the next GetUpds()
+
+   nf = gmin( (int)_upds.size(), gmax( maxFld, 0 ) );
    for ( i=0; i<nf; i++ ) {
       fld     = _upds[i];
       f._fid  = fld->Fid();
@@ -213,10 +225,20 @@ int Record::GetUpds( rtFIELD *fdb )
       fdb[i]  = f;
       fld->ClearUpd();
    }
-   _upds.clear();
+   if ( nf == (int)_upds.size() )
+      _upds.clear();
+   else
+      _upds.erase( _upds.begin(), _upds.begin()+nf );
    return nf;
 }
 
+bool Record::HasUpds()
+{
+   Locker lck( _mtx );
+
+   return( _upds.size() > 0 );
+}
+
 mddFieldList Record::GetCache()
 {
    return _fl;
@@ -255,6 +277,11 @@ void Record::Cache( mddFieldList &fl )
          fld        = new Field( *this, c );
          _flds[fid] = fld;
          _upds.push_back( fld );
+         if ( InRange( 0, fid, _REC_DENSE_FID-1 ) ) {
+            if ( fid >= (int)_fdb.size() )
+               _fdb.resize( fid+1, (Field *)0 );
+            _fdb[fid] = fld;
+         }
       }
       if ( fld ) {
          if ( !fld->_bUpd )
@@ -278,16 +305,44 @@ void Record::Cache( mddFieldList &fl )
 ///////////////////////////////
 EventPump::EventPump() :
    _updMtx(),
-   _upds(),
+   _ring( new Update[_EVT_RING_SZ] ),
+   _nAlloc( _EVT_RING_SZ ),
+   _beg( 0 ),
+   _nQ( 0 ),
+   _batch(),
+   _iBatch( 0 ),
    _evt()
 {
+   _batch.reserve( _EVT_MAX_BATCH );
 }
 
 EventPump::~EventPump()
 {
    Locker ul( _updMtx );
 
-   _upds.clear();
+   delete[] _ring;
+   _batch.clear();
+}
+
+
+///////////////////////////////
+// Access
+///////////////////////////////
+Mutex &EventPump::mtx()
+{
+   return _updMtx;
+}
+
+int EventPump::QueueSize()
+{
+   Locker ul( _updMtx );
+
+   return _nQ + (int)( _batch.size() - _iBatch );
+}
+
+bool EventPump::HasUpds()
+{
+   return( QueueSize() > 0 );
 }
 
 
@@ -300,8 +355,12 @@ void EventPump::Add( Update &u )
    Record *rec;
 
    rec = u._rec;
-   if ( !rec || !rec->_bQ )
-      _upds.push_back( u );
+   if ( !rec || !rec->_bQ ) {
+      if ( _nQ == _nAlloc )
+         _Grow();
+      _ring[(_beg+_nQ) & (_nAlloc-1)] = u;
+      _nQ += 1;
+   }
    if ( rec )
       rec->_bQ = true;
 }
@@ -314,34 +373,116 @@ void EventPump::AddAndNotify( Update &u )
 
 bool EventPump::GetOneUpd( Update &u )
 {
-   Locker            ul( _updMtx );
-   Updates::iterator ut;
-   Record           *rec;
-   bool              bUpd;
+   Locker ul( _updMtx );
+
+   /*
+    * _batch / _iBatch under _updMtx : Close() may run on another thread.
+    * Re-entrant, so GetUpds() below does not re-lock.
+    */
+
+   // 1) Drain next batch, if required
+
+   if ( _iBatch >= _batch.size() ) {
+      _batch.clear();
+      _iBatch = 0;
+      GetUpds( _batch, _EVT_MAX_BATCH );
+   }
+
+   // 2) Hand out next from current batch; Skip Close()'ed records
+
+   for ( ; _iBatch < _batch.size(); ) {
+      u = _batch[_iBatch++];
+      if ( u._mt != EVT_NONE )
+         return true;
+   }
+   return false;
+}
+
+int EventPump::GetUpds( Updates &udb, int maxUpd )
+{
+   Locker  ul( _updMtx );
+   Update *u;
+   Record *rec;
+   int     i, nu;
 
-   // Pull 1st update off _upds queue
+   // Pull up to maxUpd off front of _ring
 
-   bUpd = ( (ut=_upds.begin()) != _upds.end() );
-   if ( bUpd ) {
-      u = (*ut);
-      if ( (rec=u._rec) )
+   for ( i=0,nu=0; _nQ && i<maxUpd; i++ ) {
+      u     = &_ring[_beg];
+      _beg  = ( _beg+1 ) & (_nAlloc-1);
+      _nQ  -= 1;
+      if ( u->_mt == EVT_NONE )
+         continue; // for-i
+      if ( (rec=u->_rec) )
          rec->_bQ = false;
-      _upds.erase( ut );
-   }      
-   return bUpd;
-}         
+      udb.push_back( *u );
+      nu += 1;
+   }
+   return nu;
+}
 
-void EventPump::Close( Record *rec )
+int EventPump::GetBatch( Updates &udb, int maxUpd )
 {
-   Locker            ul( _updMtx ); 
-   Updates::iterator ut;
-   Update            upd;
+   Locker ul( _updMtx );
+   size_t nb;
+   int    nu;
+
+   /*
+    * Undispatched _batch from GetOneUpd() 1st, then _ring; Caller holds 
+    * _updMtx until done, so Close() can not run underneath it
+    */
+   nb = _batch.size();
+   for ( nu=0; _iBatch<nb && nu<maxUpd; _iBatch++ ) {
+      if ( _batch[_iBatch]._mt == EVT_NONE )
+         continue; // for-_iBatch
+      udb.push_back( _batch[_iBatch] );
+      nu += 1;
+   }
+   if ( _iBatch >= nb ) {
+      _batch.clear();
+      _iBatch = 0;
+   }
+   if ( nu < maxUpd )
+      nu += GetUpds( udb, maxUpd-nu );
+   return nu;
+}
 
-   for ( ut=_upds.begin(); ut!=_upds.end(); ut++ ) {
-      upd = (*ut);
-      if ( upd._rec == rec ) {
-         _upds.erase( ut );
-         return;
+void EventPump::Unget( Updates &udb, size_t i0 )
+{
+   Locker ul( _updMtx );
+
+   // Back to front of _batch, ahead of anything left there
+
+   if ( i0 >= udb.size() )
+      return;
+   _batch.erase( _batch.begin(), _batch.begin()+_iBatch );
+   _batch.insert( _batch.begin(), udb.begin()+i0, udb.end() );
+   _iBatch = 0;
+}
+
+void EventPump::Close( Record *rec )
+{
+   Locker  ul( _updMtx ); 
+   Update *u;
+   size_t  j;
+   int     i;
+
+   /*
+    * Record is about to be deleted : Invalidate in place, in both the 
+    * _ring and undispatched portion of current _batch
+    */
+   for ( i=0; i<_nQ; i++ ) {
+      u = &_ring[(_beg+i) & (_nAlloc-1)];
+      if ( u->_rec == rec ) {
+         u->_mt  = EVT_NONE;
+         u->_rec = (Record *)0;
+      }
+   }
+   for ( j=_iBatch; j<_batch.size(); j++ ) {
+      u = &_batch[j];
+      if ( u->_rec == rec ) {
+         u->_mt  = EVT_NONE;
+         u->_rec = (Record *)0;
       }
    }
 }
@@ -357,7 +498,27 @@ void EventPump::Notify()
 
 void EventPump::Wait( double dWait )
 {
-   _evt.WaitEvent( dWait );
+   if ( !HasUpds() )
+      _evt.WaitEvent( dWait );
 }
 
 
+///////////////////////////////
+// Helpers
+///////////////////////////////
+void EventPump::_Grow()
+{
+   Update *ring;
+   int     i, nA;
+
+   // Double; Unwrap into front of new ring
+
+   nA   = _nAlloc * 2;
+   ring = new Update[nA];
+   for ( i=0; i<_nQ; i++ )
+      ring[i] = _ring[(_beg+i) & (_nAlloc-1)];
+   delete[] _ring;
+   _ring   = ring;
+   _nAlloc = nA;
+   _beg    = 0;
+}
@@ -33,6 +33,22 @@
 *      4 FEB 2025 jcs  Build 75: ReadOnce(); _bLowLatency
 *      6 MAR 2025 jcs  Build 76: _in.Init( 4MB ) : Default ByteStream 1MB
 *      5 JUN 2025 jcs  Build 79: OneOff
+*     17 OCT 2026 jcs  Build 80: CanLog() before logging
+*     17 OCT 2026 jcs  Build 80: IsConnectionless(); _IsEOF(); OnWrite() : Wake()
+*     17 OCT 2026 jcs  Build 80: ioctl_nonBlockingIO; _nRdCall / _nWrCall / _nFcntl
+*     17 OCT 2026 jcs  Build 80: ioctl_busyPoll; ioctl_busyPollUs
+*     17 OCT 2026 jcs  Build 80: ioctl_udpBatch : _PushUDP() / _FlushUDP() via sendmmsg()
+*     17 OCT 2026 jcs  Build 80: ReadOnce() : recvfrom() into _src if connectionless
+*     17 OCT 2026 jcs  Build 80: ioctl_udpRecvBatch : _RecvUDP() via recvmmsg(); SO_RXQ_OVFL
+*     17 OCT 2026 jcs  Build 80: ioctl_gatherIO : GatherBuffer; Write() : PushRef( _bldBuf )
+*     17 OCT 2026 jcs  Build 80: Write( ..., bFlush ) : PublishBatch()
+*     17 OCT 2026 jcs  Build 80: Tokenize copy of pHosts : Merged tape list intact
+*     17 OCT 2026 jcs  Build 80: _bSharedPump; StopThread(); Write() : Wake()
+*     17 OCT 2026 jcs  Build 80: _FlushUDP() : Keep unsent tail on EAGAIN; Else _nUdpDrop
+*     17 OCT 2026 jcs  Build 80: CMsgBuf _rxCtl
+*     17 OCT 2026 jcs  Build 80: _ArmWrite() : EPOLLOUT on out queue empty / non-empty
+*     17 OCT 2026 jcs  Build 80: _PushUDP() : Oversize sent alone; _SendUDP() : > _MTU dropped
+*     17 OCT 2026 jcs  Build 80: Write() : _nOverflow
 *
 *  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
@@ -44,6 +60,14 @@ using namespace RTEDGE_PRIVATE;
 
 static socklen_t _dSz = sizeof( struct sockaddr_in );
 static int       _pSz = sizeof( Mold64PktHdr );
+static int       _mSz = sizeof( Mold64MsgHdr );
+static int       _uSz = _UDP_MAXPKT - sizeof( Mold64PktHdr );
+#if defined(linux)
+static int       _cSz = CMSG_SPACE( sizeof( u_int ) );
+#endif // defined(linux)
+static Thread   *_shThr = (Thread *)0;
+static int       _shRef = 0;
+static Mutex     _shMtx;
 
 
 /////////////////////////////////////////////////////////////////////////////
@@ -52,13 +76,15 @@ static int       _pSz = sizeof( Mold64PktHdr );
 //
 /////////////////////////////////////////////////////////////////////////////
 
-Logger *Socket::_log = (Logger *)0;
+Logger *Socket::_log         = (Logger *)0;
+bool    Socket::_bSharedPump = false;
 
 ////////////////////////////////////////////
 // Constructor / Destructor
 ////////////////////////////////////////////
 Socket::Socket( const char *pHosts, bool bConnectionless, bool bCircBuf ) :
-   _thr( new Thread() ),
+   _thr( (Thread *)0 ),
+   _bShThr( _bSharedPump ),
    _bConnectionless( bConnectionless ),
    _mdd( (mddWire_Context)0 ),
    _proto( bConnectionless ? mddProto_Binary : mddProto_XML ),
@@ -83,20 +109,54 @@ Socket::Socket( const char *pHosts, bool bConnectionless, bool bCircBuf ) :
    _bRandomize( false ),
    _bIdleCbk( false ),
    _bLowLatency( false ),
+   _bNonBlkIO( false ),
+   _bWrArm( false ),
    _ovrFloMtx(),
    _overflow(),
    _tHbeat( 3600 ),
    _SO_RCVBUF( 0 ),
    _bufIO( 0 ),
+   _busyPollUs( 0 ),
+   _udpQ(),
+   _udpLen(),
+   _nUdpQ( 0 ),
+   _udpBatch( 0 ),
+   _udpFlush( 0.001 ),
+   _tUdpQ( 0.0 ),
+   _rxQ(),
+   _rxLen(),
+   _rxBatch( 0 ),
+   _rxOvfl( 0 ),
+#if defined(linux)
+   _udpMsgs(),
+   _udpIOV(),
+   _rxMsgs(),
+   _rxIOV(),
+   _rxCtl(),
+#endif // defined(linux)
    sync_out( 0 ),
    sync_wr( 0 )
 {
+   string      s( pHosts );
    char       *cp, *hp, *pp, *rp;
    const char *_sep0 = ",";
    const char *_sep1 = ":";
    Hosts       tmp;
    size_t      i, sz;
 
+   // Thread : Our own or the Shared Pump
+
+   if ( _bShThr ) {
+      Locker lck( _shMtx );
+
+      if ( !_shThr )
+         _shThr = new Thread();
+      _shRef += 1;
+      _thr    = _shThr;
+   }
+   else
+      _thr = new Thread();
+
    // Buffer Initialization
 
    _out = bCircBuf ?  new CircularBuffer() : new Buffer();
@@ -105,10 +165,11 @@ Socket::Socket( const char *pHosts, bool bConnectionless, bool bCircBuf ) :
    _in.Init( 4*K*K );
    _out->Init( K*K );
 
-   // host:port,host:port, ...
+   // host:port,host:port, ... : Caller's string untouched
 
    ::memset( &_dst, 0, _dSz );
-   cp = (char *)pHosts;
+   ::memset( &_src, 0, _dSz );
+   cp = (char *)s.data();
    for ( cp=::strtok_r( cp,_sep0,&rp ); cp; cp=::strtok_r( NULL,_sep0,&rp ) )
       tmp.push_back( new string( cp ) );
    for ( i=0; i<tmp.size(); i++ ) {
@@ -152,9 +213,12 @@ Socket::~Socket()
 {
    int i, sz;
 
-   // Timer
+   // Timer; Shared Pump keeps running for everyone else
 
-   thr().Stop();
+   if ( _bShThr )
+      _DetachPump( false );
+   else
+      thr().Stop();
    pump().RemoveTimer( *this );
 
    // Guts
@@ -166,7 +230,17 @@ Socket::~Socket()
    _mdd = 0;
    ::mddFieldList_Free( _fl );
    ::mddBldBuf_Free( _bldBuf );
-   delete _thr;
+   if ( _bShThr ) {
+      Locker lck( _shMtx );
+
+      if ( !(--_shRef) ) {
+         _shThr->Stop();
+         delete _shThr;
+         _shThr = (Thread *)0;
+      }
+   }
+   else
+      delete _thr;
    delete _out;
    if ( _log )
       _log->logT( 3, "~Socket( %s )\n", dstConn() );
@@ -186,6 +260,14 @@ Pump &Socket::pump()
    return thr().pump();
 }
 
+void Socket::StopThread()
+{
+   if ( _bShThr )
+      _DetachPump( true );
+   else
+      thr().Stop();
+}
+
 Mutex &Socket::mtx()
 {
    return _mtx;
@@ -211,6 +293,11 @@ bool Socket::IsCache()
    return _bCache;
 }
 
+bool Socket::IsConnectionless()
+{
+   return _bConnectionless;
+}
+
 bool Socket::IsWritable()
 {
    return( oBuf().bufSz() > 0 );
@@ -330,6 +417,11 @@ const char *Socket::Connect()
    // Stats / Notify
 
    if ( pRtn ) { 
+      if ( _bNonBlkIO )
+         _SetNonBlockingIO( true );
+      _SetBusyPoll();
+      _rxOvfl = 0;
+      _SetRxOvfl();
       safe_strcpy( st._dstConn, dstConn() );
       st._lastConn = (int)::rtEdge_TimeSec();
       st._nConn   += 1;
@@ -363,10 +455,12 @@ bool Socket::Disconnect( const char *reason )
 
    _in.Reset();
    out.Reset();
+   _nUdpQ  = 0;
+   _bWrArm = false;
    return true;
 }
 
-bool Socket::Write( const char *pData, int dLen )
+bool Socket::Write( const char *pData, int dLen, bool bFlush )
 {
 // assert( _mtx.tid() );
    Locker           lck( _mtx );
@@ -374,38 +468,32 @@ bool Socket::Write( const char *pData, int dLen )
    Buffer          &out = oBuf();
    Locker           l( _mtx );
 //   OneOff           oneW( sync_wr, false );
-   struct sockaddr *sa;
    bool             bOK, flush;
-   char            *pkt, buf[K];
-   int              wSz, pSz, bSz0, bSz1;
+   char             buf[K];
+   int              bSz0, bSz1, half;
 
-   // Unbuffered if _bConnectionless
+   // Unbuffered if _bConnectionless; Batched if ioctl_udpBatch
 
-   if ( _bConnectionless ) {
-      ::memcpy( _udp._data, pData, dLen );
-      _udp._wire_numMsg  = 1;
-      pkt                = (char *)&_udp;
-      pSz                = _pSz + dLen;
-      sa                 = (struct sockaddr *)&_dst;
-      wSz                = ::sendto( fd(), pkt, pSz, 0, sa, _dSz );
-      _udp._wire_seqNum += _udp._wire_numMsg;
-      bOK                = ( wSz == pSz );
-      return bOK;
-   }
+   if ( _bConnectionless )
+      return _udpBatch ? _PushUDP( pData, dLen ) : _SendUDP( pData, dLen );
 
    // Buffered IO
 //   {
 //      OneOff oneO( sync_out );
 
       bSz0 = bSz1 = out.bufSz();
-      bOK  = out.Push( (char *)pData, dLen );
+      bOK  = out.PushRef( _bldBuf, (char *)pData, dLen );
 //   }
    if ( bOK ) {
       bSz1  += dLen;
       flush  = !_bufIO;
       flush |= ( ( bSz0 < _bufIO ) && ( bSz1 > _bufIO ) );
+      half   = out.maxSiz() / 2;
+      flush &= bFlush;
+      flush |= ( !bFlush && ( bSz0 <= half ) && ( bSz1 > half ) );
       if ( flush )
          OnWrite();
+      _ArmWrite( out.bufSz() > 0 );
    }
    else {
       Locker lck( _ovrFloMtx );
@@ -413,9 +501,11 @@ bool Socket::Write( const char *pData, int dLen )
       sprintf( buf, "Overflow : %d bytes; ", out.bufSz() );
       _overflow  = buf;
       _overflow += dstConn();
+      st._nOverflow += 1;
    }
-   st._qSiz    = out.bufSz();
-   st._qSizMax = gmax( st._qSiz, st._qSizMax );
+   st._qSiz     = out.bufSz();
+   st._qSizMax  = gmax( st._qSiz, st._qSizMax );
+   st._nOutCopy = out.nCopy();
    return bOK;
 }
 
@@ -533,6 +623,34 @@ out.Grow( out.maxSiz() );
       case ioctl_lowLatency:
          _bLowLatency = i32 ? true : false; 
          return true;
+      case ioctl_nonBlockingIO:
+         _bNonBlkIO = i32 ? true : false;
+         ATOMIC_EXCH( &_nNonBlk, 0 );
+         _SetNonBlockingIO( _bNonBlkIO );
+         return true;
+      case ioctl_busyPoll:
+         if ( i32 && !_bNonBlkIO ) {
+            _bNonBlkIO = true;
+            ATOMIC_EXCH( &_nNonBlk, 0 );
+            _SetNonBlockingIO( _bNonBlkIO );
+         }
+         pump().SetSpin( i32 ? true : false );
+         return true;
+      case ioctl_busyPollUs:
+         _busyPollUs = gmax( 0, i32 );
+         _SetBusyPoll();
+         return true;
+      case ioctl_udpBatch:
+         _SetUdpBatch( i32 );
+         return true;
+      case ioctl_udpFlushUs:
+         _udpFlush = 0.000001 * gmax( 0, i32 );
+         return true;
+      case ioctl_udpRecvBatch:
+         _SetUdpRecv( i32 );
+         return true;
+      case ioctl_gatherIO:
+         return _SetGatherIO( bArg );
       default:
          break;
    }
@@ -551,6 +669,7 @@ void Socket::OnRead()
    // Drain ; Connectionless is 1 read ...
 
    setNonBlocking();
+   nb = 0;
    if ( _bConnectionless )
       tot = ReadOnce();
    else {
@@ -562,7 +681,7 @@ void Socket::OnRead()
    }
    setBlocking();
 #if !defined(WIN32)
-   if ( !tot )
+   if ( !tot && _IsEOF( nb ) )
       OnException();
 #endif // !defined(WIN32)
 }
@@ -575,6 +694,7 @@ void Socket::OnWrite()
    rtEdgeChanStats &st  = stats();
    Buffer          &out = oBuf();
    const char      *fmt = "Socket.OnWrite( %s ) : nWr=%d; nL=%d; qSz=%d\n";
+   u_int64_t        nSys;
    int              wSz, nWr, nL, off, nb;
 
    // Pre-condition
@@ -585,14 +705,16 @@ void Socket::OnWrite()
    // 1) Drain ...
 
    setNonBlocking();
-   wSz = out.bufSz();
-   nWr = wSz;
-   off = 0;
+   wSz  = out.bufSz();
+   nWr  = wSz;
+   off  = 0;
+   nSys = out.nSysCall();
    for ( ; nWr && ( (nb=out.WriteOut( fd(), off, nWr )) > 0 ); ) {
       off += nb;
       nWr  = gmax( nWr-nb, 0 );
    }
    setBlocking();
+   st._nWrCall += ( out.nSysCall() - nSys );
    if ( !off )
       return;
 
@@ -603,9 +725,11 @@ void Socket::OnWrite()
       out.Move( off, nL );
    else
       out.Reset();
-   st._qSiz    =  out.bufSz();
-   st._qSizMax = gmax( st._qSiz, st._qSizMax );
-   if ( nL && _log )
+   _ArmWrite( nL > 0 );
+   st._qSiz     =  out.bufSz();
+   st._qSizMax  = gmax( st._qSiz, st._qSizMax );
+   st._nOutCopy = out.nCopy();
+   if ( nL && _log && _log->CanLog( 0 ) )
       _log->logT( 0, fmt, dstConn(), nWr, nL, st._qSiz );
 }
 
@@ -616,7 +740,7 @@ void Socket::OnException()
    err += dstConn();
    OnDisconnect( err.data() );
    Disconnect( err.data() );
-   if ( _log )
+   if ( _log && _log->CanLog( 2 ) )
       _log->logT( 2, "Socket::OnRead() : %s\n", err.data() );
 }
 
@@ -754,8 +878,13 @@ int Socket::_AddAttr( mddMsgHdr &h, const char *key, char *val )
 ////////////////////////////////////////////
 int Socket::setNonBlocking()
 {
-   long nb;
+   rtEdgeChanStats &st = stats();
+   long             nb;
+
+   // ioctl_nonBlockingIO : fd already O_NONBLOCK
 
+   if ( _bNonBlkIO )
+      return _flags;
    if ( (nb=ATOMIC_INC( &_nNonBlk )) == 1 ) {
 #ifdef WIN32
 /*
@@ -769,9 +898,12 @@ int Socket::setNonBlocking()
       ::ioctlsocket( fd(), FIONBIO, &iMode );
  */
 #else
-      if ( _flags == -1 )
-         _flags = ::fcntl( fd(), F_GETFL,0 );
+      if ( _flags == -1 ) {
+         _flags     = ::fcntl( fd(), F_GETFL,0 );
+         st._nFcntl += 1;
+      }
       ::fcntl( fd(), F_SETFL, _flags | FNDELAY );
+      st._nFcntl += 1;
 #endif // WIN32
    }
    return _flags;
@@ -780,7 +912,9 @@ int Socket::setNonBlocking()
 int Socket::ReadOnce()
 {
    rtEdgeChanStats &st = stats();
-   int              nb, nL;
+   struct sockaddr *sa;
+   socklen_t        sl;
+   int              nb, nL, fl;
 
    // Caller sets into non-blocking
 
@@ -788,9 +922,17 @@ int Socket::ReadOnce()
       _in.Grow( _in.nAlloc() );
    nL = _in.nLeft();
    if ( _bConnectionless ) {
+      /*
+       * 1 datagram; Sender in _src so we may talk back
+       */
       _in.Reset();
-      nb         = _in.ReadIn( fd(), nL );
-      st._nByte += _bPub ? 0 : nb;
+      nL         = _in.nLeft();
+      sa         = (struct sockaddr *)&_src;
+      sl         = _dSz;
+      fl         = _bNonBlkIO ? _NB_RDFLAGS : 0;
+      nb         = ::recvfrom( fd(), _in.bp(), nL, fl, sa, &sl );
+      _in.Set( gmax( nb,0 ) );
+      st._nByte += _bPub ? 0 : gmax( nb,0 );
    }
    else {
       if ( (nb=_in.ReadIn( fd(), nL )) > 0 ) {
@@ -799,13 +941,19 @@ int Socket::ReadOnce()
          nL        -= nb;
       }
    }
+   st._nRdCall += 1;
    return nb;
 }
 
 void Socket::setBlocking()
 {
-   long nb;
+   rtEdgeChanStats &st = stats();
+   long             nb;
 
+   // ioctl_nonBlockingIO : fd stays O_NONBLOCK
+
+   if ( _bNonBlkIO )
+      return;
    if ( (nb=ATOMIC_DEC( &_nNonBlk )) == 0 ) {
 #ifdef WIN32
 /*
@@ -820,6 +968,7 @@ void Socket::setBlocking()
  */
 #else
       ::fcntl( fd(), F_SETFL, _flags );
+      st._nFcntl += 1;
 #endif // WIN32
    }
 }
@@ -838,6 +987,366 @@ int Socket::_GetError()
    return rtn;
 }
 
+bool Socket::_SetGatherIO( bool bGather )
+{
+   Buffer *lwc = _out;
+   int     qMax;
+
+   // Pre-condition : Nothing queued; Not UDP
+
+   if ( _bConnectionless || lwc->bufSz() )
+      return false;
+
+   // Swap; Keep max size and non-blocking
+
+   qMax = lwc->maxSiz();
+   _out = bGather ? new GatherBuffer( qMax ) : new Buffer( qMax );
+   _out->Init( K*K );
+   _out->SetNonBlocking( _bNonBlkIO );
+   delete lwc;
+   return true;
+}
+
+void Socket::_SetNonBlockingIO( bool bNonBlk )
+{
+   rtEdgeChanStats &st = stats();
+   int              flags;
+
+   /*
+    * Buffer : recv() / send() w/ MSG_DONTWAIT; fd : O_NONBLOCK once
+    */
+   _in.SetNonBlocking( bNonBlk );
+   oBuf().SetNonBlocking( bNonBlk );
+   if ( !fd() )
+      return;
+#if !defined(WIN32)
+   flags       = ::fcntl( fd(), F_GETFL, 0 );
+   flags       = bNonBlk ? ( flags | FNDELAY ) : ( flags & ~FNDELAY );
+   ::fcntl( fd(), F_SETFL, flags );
+   st._nFcntl += 2;
+#endif // !defined(WIN32)
+}
+
+void Socket::_SetUdpBatch( int nPkt )
+{
+   Locker lck( _mtx );
+
+   // Flush what we have, then re-size
+
+   _FlushUDP();
+   _udpBatch = WithinRange( 0, nPkt, _UDP_MAXBATCH );
+   if ( _nUdpQ > _udpBatch ) {
+      stats()._nUdpDrop += ( _nUdpQ - _udpBatch );
+      _nUdpQ             = _udpBatch;
+   }
+   _udpQ.resize( _udpBatch );
+   _udpLen.resize( _udpBatch );
+#if defined(linux)
+   _udpMsgs.resize( _udpBatch );
+   _udpIOV.resize( _udpBatch );
+#endif // defined(linux)
+}
+
+bool Socket::_SendUDP( const char *pData, int dLen )
+{
+   rtEdgeChanStats &st = stats();
+   struct sockaddr *sa;
+   char            *pkt;
+   bool             bOK;
+   int              wSz, pSz, fl;
+
+   // Pre-condition : Must fit in _udp
+
+   if ( dLen > _MTU ) {
+      st._nUdpDrop += 1;
+      return false;
+   }
+
+   // 1 message / packet / sendto()
+
+   ::memcpy( _udp._data, pData, dLen );
+   _udp._wire_numMsg  = 1;
+   pkt                = (char *)&_udp;
+   pSz                = _pSz + dLen;
+   sa                 = (struct sockaddr *)&_dst;
+   fl                 = _bNonBlkIO ? _NB_WRFLAGS : 0;
+   wSz                = ::sendto( fd(), pkt, pSz, fl, sa, _dSz );
+   st._nWrCall       += 1;
+   _udp._wire_seqNum += _udp._wire_numMsg;
+   bOK                = ( wSz == pSz );
+   st._nUdpPkt       += bOK ? 1 : 0;
+   st._nUdpMsg       += bOK ? 1 : 0;
+   st._nUdpDrop      += bOK ? 0 : 1;
+   return bOK;
+}
+
+bool Socket::_PushUDP( const char *pData, int dLen )
+{
+   Mold64Pkt   *pkt;
+   Mold64MsgHdr mh;
+   u_char      *cp;
+   bool         bNew;
+   int          ix, need;
+
+   /*
+    * Pre-condition : Must fit in 1 packet, else flush and send alone as 
+    * if unbatched; Queued packets 1st to keep _wire_seqNum in order.
+    */
+   need = _mSz + dLen;
+   if ( need > _uSz ) {
+      _FlushUDP();
+      return !_nUdpQ && _SendUDP( pData, dLen );
+   }
+
+   // 1) New packet if current full; Flush if all full; Still full = EAGAIN
+
+   ix   = _nUdpQ - 1;
+   bNew = !_nUdpQ || ( ( _udpLen[ix] + need ) > _uSz );
+   if ( bNew && ( _nUdpQ == _udpBatch ) )
+      _FlushUDP();
+   if ( bNew && ( _nUdpQ == _udpBatch ) )
+      return false;
+   if ( bNew ) {
+      ix                = _nUdpQ++;
+      pkt               = &_udpQ[ix];
+      ::memcpy( pkt->_session, _udp._session, sizeof( pkt->_session ) );
+      pkt->_wire_seqNum = _udp._wire_seqNum;
+      pkt->_wire_numMsg = 0;
+      _udpLen[ix]       = 0;
+      _tUdpQ            = ix ? _tUdpQ : Logger::dblNow();
+   }
+
+   // 2) Append : <Mold64MsgHdr><msg>; _wire_seqNum is 1st msg in packet
+
+   pkt                = &_udpQ[ix];
+   cp                 = pkt->_data + _udpLen[ix];
+   mh._len            = (u_short)dLen;
+   ::memcpy( cp, &mh, _mSz );
+   ::memcpy( cp+_mSz, pData, dLen );
+   _udpLen[ix]       += need;
+   pkt->_wire_numMsg += 1;
+   _udp._wire_seqNum += 1;
+
+   // 3) Flush interval
+
+   _FlushUDP( false );
+   return true;
+}
+
+int Socket::_FlushUDP( bool bForce )
+{
+   Locker           lck( _mtx );
+   rtEdgeChanStats &st = stats();
+   Mold64Pkt       *pkt;
+   int              i, n, rc, nPkt, nMsg, nL, fl, err;
+
+   // Pre-condition(s)
+
+   if ( !(n=_nUdpQ) )
+      return 0;
+   if ( !bForce && ( ( Logger::dblNow() - _tUdpQ ) < _udpFlush ) )
+      return 0;
+
+   // Many packets per sendmmsg(); sendto() if not available
+
+   fl   = _bNonBlkIO ? _NB_WRFLAGS : 0;
+   nMsg = 0;
+   err  = 0;
+#if defined(linux)
+   struct msghdr *mh;
+
+   for ( i=0; i<n; i++ ) {
+      pkt                  = &_udpQ[i];
+      mh                   = &_udpMsgs[i].msg_hdr;
+      _udpIOV[i].iov_base  = (void *)pkt;
+      _udpIOV[i].iov_len   = _pSz + _udpLen[i];
+      ::memset( &_udpMsgs[i], 0, sizeof( mmsghdr ) );
+      mh->msg_name         = (void *)&_dst;
+      mh->msg_namelen      = _dSz;
+      mh->msg_iov          = &_udpIOV[i];
+      mh->msg_iovlen       = 1;
+   }
+   for ( nPkt=0; nPkt<n; nPkt+=rc ) {
+      rc           = ::sendmmsg( fd(), &_udpMsgs[nPkt], n-nPkt, fl );
+      st._nWrCall += 1;
+      if ( rc <= 0 ) {
+         err = ( rc < 0 ) ? _GetError() : 0;
+         break; // for-nPkt
+      }
+   }
+#else
+   struct sockaddr *sa = (struct sockaddr *)&_dst;
+   int              pSz;
+
+   for ( nPkt=0; nPkt<n; nPkt++ ) {
+      pkt          = &_udpQ[nPkt];
+      pSz          = _pSz + _udpLen[nPkt];
+      rc           = ::sendto( fd(), (char *)pkt, pSz, fl, sa, _dSz );
+      st._nWrCall += 1;
+      if ( rc != pSz ) {
+         err = ( rc < 0 ) ? _GetError() : 0;
+         break; // for-nPkt
+      }
+   }
+#endif // defined(linux)
+   for ( i=0; i<nPkt; nMsg+=_udpQ[i++]._wire_numMsg );
+   st._nUdpPkt += nPkt;
+   st._nUdpMsg += nMsg;
+   /*
+    * Partial send : Socket full (EAGAIN, etc.) keeps unsent tail queued
+    * for next flush; Any other error drops it into _nUdpDrop
+    */
+   nL = n - nPkt;
+   if ( nL && ( ( err == EAGAIN ) || ( err == EWOULDBLOCK ) || ( err == EINTR ) ) ) {
+      for ( i=0; i<nL; i++ ) {
+         _udpQ[i]   = _udpQ[nPkt+i];
+         _udpLen[i] = _udpLen[nPkt+i];
+      }
+   }
+   else {
+      st._nUdpDrop += nL;
+      nL            = 0;
+   }
+   _nUdpQ = nL;
+   return nPkt;
+}
+
+void Socket::_SetUdpRecv( int nPkt )
+{
+   Locker lck( _mtx );
+
+   // Pre-allocated ring; msghdr's point into it for life
+
+   _rxBatch = WithinRange( 0, nPkt, _UDP_MAXBATCH );
+   _rxQ.resize( _rxBatch );
+   _rxLen.resize( _rxBatch );
+#if defined(linux)
+   struct msghdr *mh;
+   int            i;
+
+   _rxMsgs.resize( _rxBatch );
+   _rxIOV.resize( _rxBatch );
+   _rxCtl.resize( _rxBatch * _cSz );
+   ::memset( _rxMsgs.data(), 0, _rxBatch * sizeof( mmsghdr ) );
+   for ( i=0; i<_rxBatch; i++ ) {
+      mh                 = &_rxMsgs[i].msg_hdr;
+      _rxIOV[i].iov_base = (void *)&_rxQ[i];
+      _rxIOV[i].iov_len  = sizeof( Mold64Pkt );
+      mh->msg_name       = (void *)&_src;
+      mh->msg_iov        = &_rxIOV[i];
+      mh->msg_iovlen     = 1;
+      mh->msg_control    = (void *)( _rxCtl.data() + ( i*_cSz ) );
+   }
+#endif // defined(linux)
+   _SetRxOvfl();
+}
+
+void Socket::_SetRxOvfl()
+{
+   /*
+    * SO_RXQ_OVFL : Kernel drop count in cmsg of each datagram; Linux only
+    */
+#if defined(SO_RXQ_OVFL)
+   int       val;
+   socklen_t siz;
+
+   if ( !fd() || !_bConnectionless || !_rxBatch )
+      return;
+   val = 1;
+   siz = sizeof( val );
+   ::setsockopt( fd(), SOL_SOCKET, SO_RXQ_OVFL, (char *)&val, siz );
+#endif // defined(SO_RXQ_OVFL)
+}
+
+int Socket::_RecvUDP()
+{
+   rtEdgeChanStats &st = stats();
+   int              n, nb;
+
+   // Pre-condition
+
+   if ( !fd() || !_rxBatch )
+      return 0;
+#if defined(linux)
+   struct msghdr  *mh;
+   struct cmsghdr *cm;
+   u_int           ovfl;
+   int             i;
+
+   // 1) Re-arm what kernel overwrites
+
+   for ( i=0; i<_rxBatch; i++ ) {
+      mh                 = &_rxMsgs[i].msg_hdr;
+      mh->msg_namelen    = _dSz;
+      mh->msg_controllen = _cSz;
+   }
+   n            = ::recvmmsg( fd(), _rxMsgs.data(), _rxBatch, MSG_DONTWAIT, 0 );
+   st._nRdCall += 1;
+
+   // 2) Lengths; Truncated is 0; Kernel drop count from any cmsg
+
+   for ( i=0; i<n; i++ ) {
+      mh         = &_rxMsgs[i].msg_hdr;
+      nb         = _rxMsgs[i].msg_len;
+      _rxLen[i]  = ( mh->msg_flags & MSG_TRUNC ) ? 0 : nb;
+      st._nByte += nb;
+      for ( cm=CMSG_FIRSTHDR( mh ); cm; cm=CMSG_NXTHDR( mh, cm ) ) {
+         if ( cm->cmsg_level != SOL_SOCKET || cm->cmsg_type != SO_RXQ_OVFL )
+            continue; // for-cm
+         ::memcpy( &ovfl, CMSG_DATA( cm ), sizeof( ovfl ) );
+         st._nUdpDrop += ( ovfl - _rxOvfl );
+         _rxOvfl       = ovfl;
+      }
+   }
+#else
+   struct sockaddr *sa = (struct sockaddr *)&_src;
+   socklen_t        sl;
+
+   // recvfrom() until empty or ring full
+
+   for ( n=0; n<_rxBatch; n++ ) {
+      sl           = _dSz;
+      nb           = ::recvfrom( fd(), (char *)&_rxQ[n], sizeof( Mold64Pkt ), 0, sa, &sl );
+      st._nRdCall += 1;
+      if ( nb <= 0 )
+         break; // for-n
+      _rxLen[n]    = nb;
+      st._nByte   += nb;
+   }
+#endif // defined(linux)
+   return gmax( n,0 );
+}
+
+void Socket::_SetBusyPoll()
+{
+   /*
+    * SO_BUSY_POLL : Kernel spins on device queue in recv(); Linux only
+    */
+#if defined(SO_BUSY_POLL)
+   int       val;
+   socklen_t siz;
+
+   if ( !fd() || !_busyPollUs )
+      return;
+   val = _busyPollUs;
+   siz = sizeof( val );
+   ::setsockopt( fd(), SOL_SOCKET, SO_BUSY_POLL, (char *)&val, siz );
+#endif // defined(SO_BUSY_POLL)
+}
+
+bool Socket::_IsEOF( int nb )
+{
+   int err;
+
+   /*
+    * 0 = Orderly shutdown; EAGAIN = Spurious wake-up (edge-triggered)
+    */
+   if ( nb >= 0 )
+      return( nb == 0 );
+   err = _GetError();
+   return( ( err != EAGAIN ) && ( err != EWOULDBLOCK ) && ( err != EINTR ) );
+}
+
 bool Socket::NagleOff()
 {
    int       bSet, bs, rtn, r1;
@@ -853,3 +1362,31 @@ bool Socket::NagleOff()
    r1   = ::getsockopt( fd(), IPPROTO_TCP, TCP_NODELAY, (char *)&bs, &siz );
    return( rtn == 0 );
 }
+
+void Socket::_DetachPump( bool bCbk )
+{
+   bool bUp;
+
+   /*
+    * Shared Pump : Pull this Socket only, then Disconnect() as 
+    * Pump._Destroy() would.  Pump.Remove() outside _mtx waits out any 
+    * dispatch in progress on the Pump thread.
+    */
+   pump().RemoveTimer( *this );
+   bUp = ( fd() != 0 );
+   pump().Remove( this );
+   Disconnect( "Pump.Destroy()" );
+   if ( bCbk && bUp )
+      ConnCbk( "Pump.Destroy()", false );
+}
+
+void Socket::_ArmWrite( bool bWr )
+{
+   /*
+    * epoll() : EPOLLOUT only while out queue non-empty; No-op if no change
+    */
+   if ( bWr == _bWrArm )
+      return;
+   _bWrArm = bWr;
+   pump().SetWritable( this, bWr );
+}
@@ -10,10 +10,28 @@
 *     14 OCT 2022 jcs  PumpOneMsg( ..., bool &bContinue )
 *     12 JAN 2024 jcs  Build 67: TapeHeader.h
 *     16 JUN 2025 jcs  Build 77: Read from Live Tape
+*     17 OCT 2026 jcs  Build 80: GLrpyTkrIdxVw; PumpTicker() : off = _loc()
+*     17 OCT 2026 jcs  Build 80: _PumpParallel(); TapePumpJob
+*     17 OCT 2026 jcs  Build 80: TapeSlice._bBar : Per-ticker OHLC / VWAP bars
+*     17 OCT 2026 jcs  Build 80: Export() : TapeColExport
+*     17 OCT 2026 jcs  Build 80: _tapeOffset() : Multi-day, sub-bucket; _SeekIdx()
+*     17 OCT 2026 jcs  Build 80: _tapeOffset() : Header index day from _curIdxTm; Keep _idx
+*     17 OCT 2026 jcs  Build 80: TapePumpJob.Run() : TapePrefetch per range
+*     17 OCT 2026 jcs  Build 80: Export() : err() on failure
+*     17 OCT 2026 jcs  Build 80: madvise(); TapePrefetch; _PageFaults()
+*     17 OCT 2026 jcs  Build 80: Merged tapes : _TapeFiles(); TapeMerge
+*     17 OCT 2026 jcs  Build 80: Merged tapes : Unsubscribe() returns merged ID
+*     17 OCT 2026 jcs  Build 80: ~TapeChannel() : Walk _dead
+*     17 OCT 2026 jcs  Build 80: BuildTickerIndex() : Refuse if busy; Pump() waits
+*     17 OCT 2026 jcs  Build 80: GLrpyTkrIdxVw : Map whole file
+*     17 OCT 2026 jcs  Build 80: TapeColExport : Skip FID <= 0 or repeated
 *
-*  (c) 1994-2025, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <EDG_Internal.h>
+#if !defined(WIN32)
+#include <glob.h>
+#endif // !defined(WIN32)
 
 using namespace RTEDGE_PRIVATE;
 
@@ -26,8 +44,11 @@ using namespace RTEDGE_PRIVATE;
 
 static const char *t_ALL  = "*";
 static const char *t_SEP  = "|";
+static const char *t_BAR  = "BAR";
+static const char *t_CSV  = ",";
 static const char *_undef = "Undefined";
 static const char *_pIdx  = ".idx";
+static const char *_pTkr  = ".tkr";
 static int _mSz8          = sizeof( GLrecTapeMsg );
 static int _mSz4          = _mSz8 - 4;
 static int _ixSz          = sizeof( u_int64_t );
@@ -40,15 +61,18 @@ static u_int64_t _iSz       = sizeof( u_int64_t );
 ////////////////////////////////////////////
 // Constructor / Destructor
 ////////////////////////////////////////////
-TapeChannel::TapeChannel( EdgChannel &chan ) :
+TapeChannel::TapeChannel( EdgChannel &chan, const char *pFile ) :
    _chan( chan ),
    _attr( chan.attr() ),
+   _tapeFile(),
    _idxFile(),
+   _tkrIdxFile(),
    _schema(),
    _schemaByName(),
    _vwHdr( (GLmmap *)0 ),
    _hdr( (TapeHeader *)0 ),
    _idx( (GLrpyDailyIdxVw *)0 ),
+   _tkrIdx( (GLrpyTkrIdxVw *)0 ),
    _rdb(),
    _tdb(),
    _wl(),
@@ -60,11 +84,35 @@ TapeChannel::TapeChannel( EdgChannel &chan ) :
    _nSub( 0 ),
    _sliceMtx(),
    _slice( (TapeSlice *)0 ),
+   _pf( (TapePrefetch *)0 ),
+   _flt0Min( 0 ),
+   _flt0Maj( 0 ),
+   _kids(),
+   _mrgIDs(),
+   _mrgRdb(),
+   _mrgRecs(),
+   _mrgNext( 0 ),
    _bRun( false ),
    _bInUse( false )
 {
-   string tmp( pTape() );
-   char  *pi;
+   TapeFiles fdb;
+   string    tmp;
+   char     *pi;
+   size_t    i;
+
+   /*
+    * 0) _pSvrHosts = CSV list and / or glob of tapes : Merged
+    *    1st tape is us; Rest are _kids, merged by msg time in Pump()
+    */
+   if ( pFile )
+      _tapeFile = pFile;
+   else {
+      _TapeFiles( pTape(), fdb );
+      _tapeFile = fdb.size() ? fdb[0] : pTape();
+      for ( i=1; i<fdb.size(); i++ )
+         _kids.push_back( new TapeChannel( chan, fdb[i].data() ) );
+   }
+   tmp = _tapeFile;
 
    // 1) Binary Protocol Always
 
@@ -87,6 +135,11 @@ TapeChannel::TapeChannel( EdgChannel &chan ) :
    tmp += _pIdx;
    if ( !_idxFile.length() )
       _idxFile = tmp;
+
+   // 3) Per-ticker index : ULTRA.trep_20180304.1.tkr
+
+   _tkrIdxFile  = _tapeFile;
+   _tkrIdxFile += _pTkr;
 }
 
 TapeChannel::~TapeChannel()
@@ -96,11 +149,14 @@ TapeChannel::~TapeChannel()
 
    for ( i=0; _bInUse; i++ );
    _bRun = false;
-   for ( it=_dead.begin(); it!=_dead.end(); delete (*it).second );
+   _PrefetchStop();
+   for ( it=_dead.begin(); it!=_dead.end(); delete (*it).second, it++ );
    _ClearFieldMap();
    _wl.clear();
    _dead.clear();
    Unload();
+   for ( i=0; i<(int)_kids.size(); delete _kids[i], i++ );
+   _kids.clear();
    ::mddFieldList_Free( _fl );
    ::mddSub_Destroy( _mdd );
    for ( size_t ii=0; ii<_tdb.size(); delete _tdb[ii], ii++ );
@@ -136,11 +192,26 @@ const char *TapeChannel::pTape()
    return _attr._pSvrHosts;
 }
 
+const char *TapeChannel::pFile()
+{
+   return _tapeFile.data();
+}
+
+bool TapeChannel::IsMerged()
+{
+   return( _kids.size() > 0 );
+}
+
 const char *TapeChannel::pIdxFile()
 {
    return _idxFile.data();
 }
 
+const char *TapeChannel::pTkrIdxFile()
+{
+   return _tkrIdxFile.data();
+}
+
 const char *TapeChannel::err()
 {
    return _err.length() ? _err.data() : (const char *)0;
@@ -260,12 +331,56 @@ int TapeChannel::StopPumpFullTape( int id )
 }
 
 
+////////////////////////////////////
+// Columnar Export
+////////////////////////////////////
+u_int64_t TapeChannel::Export( const char *pFile, 
+                               const char *tStart, 
+                               const char *tEnd, 
+                               const char *pTkrs, 
+                               const char *pFlds )
+{
+   u_int64_t rc;
+
+   // Pre-condition(s)
+
+   _err = "";
+   if ( !_hdr || !pFile || !pFlds ) {
+      _err = !_hdr ? "Tape not loaded" : "No file or fields";
+      return 0;
+   }
+   {
+      Locker lck( _sliceMtx );
+
+      if ( _slice || _bRun || _bInUse ) {
+         _err = "Tape busy";
+         return 0;
+      }
+      _bInUse = true;
+   }
+   /*
+    * Own mddWire_Context : Leave _bRun alone so On1SecTimer() 
+    * does not Pump() underneath us
+    */
+   TapeColExport *xp;
+
+   // Merged : 1st tape only
+
+   xp      = new TapeColExport( *this, pFile, tStart, tEnd, pTkrs, pFlds );
+   rc      = xp->Run();
+   delete xp;
+   _bInUse = false;
+   return rc;
+}
+
+
 ////////////////////////////////////
 // Operations
 ////////////////////////////////////
 int TapeChannel::Subscribe( const char *svc, const char *tkr )
 {
-   int ix;
+   TapeRecords::iterator rt;
+   int                   i, ix, kx;
 
    // Special Case : Run baby
 
@@ -283,8 +398,18 @@ int TapeChannel::Subscribe( const char *svc, const char *tkr )
    _nSub += 1;
    if ( HasTicker( svc, tkr, ix ) ) 
       _wl[ix] = ix;
-   else  {
-      ix        = hdr()._maxRec() + _nSub;
+   /*
+    * Merged : Watch in each tape that has it; Dead only if none do
+    */
+   for ( i=0; i<(int)_kids.size(); i++ ) {
+      if ( !_kids[i]->HasTicker( svc, tkr, kx ) )
+         continue; // for-i
+      _kids[i]->_wl[kx] = kx;
+      if ( ( ix == -1 ) && (rt=_mrgRdb.find( _Key( svc, tkr ) )) != _mrgRdb.end() )
+         ix = (*rt).second;
+   }
+   if ( ix == -1 ) {
+      ix        = _mrgNext + _nSub;
       _dead[ix] = new string( _Key( svc, tkr ) );
    }
    return ix;
@@ -293,7 +418,8 @@ int TapeChannel::Subscribe( const char *svc, const char *tkr )
 int TapeChannel::Unsubscribe( const char *svc, const char *tkr )
 {
    TapeWatchList::iterator it;
-   int                     ix;
+   TapeRecords::iterator   rt;
+   int                     i, ix, kx, rc;
    
    // Special Case : Run baby
    
@@ -304,12 +430,20 @@ int TapeChannel::Unsubscribe( const char *svc, const char *tkr )
 
    // Dead Tickers are removed when we 1st pump
 
+   rc = 0;
+   for ( i=0; i<(int)_kids.size(); i++ ) {
+      if ( !_kids[i]->HasTicker( svc, tkr, kx ) )
+         continue; // for-i
+      _kids[i]->Unsubscribe( svc, tkr );
+      if ( (rt=_mrgRdb.find( _Key( svc, tkr ) )) != _mrgRdb.end() )
+         rc = (*rt).second;
+   }
    if ( HasTicker( svc, tkr, ix ) ) {
       if ( (it=_wl.find( ix )) != _wl.end() )
          _wl.erase( it );
       return ix;
    }
-   return 0;
+   return rc;
 
 }
 
@@ -324,10 +458,10 @@ bool TapeChannel::Load()
 
    if ( _vwHdr )
       return true;
-   _vwHdr = new GLmmap( (char *)pTape(),  (char *)0, 0, sizeof( GLrecTapeHdr ) );
+   _vwHdr = new GLmmap( (char *)pFile(),  (char *)0, 0, sizeof( GLrecTapeHdr ) );
    if ( !_vwHdr->isValid() ) {
       _err  = "Can not map file ";
-      _err += pTape();
+      _err += pFile();
       Unload();
       return false;
    }
@@ -347,7 +481,7 @@ bool TapeChannel::Load()
    if ( !hdr()._bMDDirect() ) {
       Unload();
       _err  = "Invalid tape file ";
-      _err += pTape();
+      _err += pFile();
       return false;
    }
    /*
@@ -376,7 +510,12 @@ bool TapeChannel::Load()
       _rdb[s] = i;
       _tdb.push_back( rec );
    }
-   return true;
+   /*
+    * Per-ticker index, if built
+    */
+   _LoadTkrIdx();
+   _mrgNext = hdr()._maxRec();
+   return _LoadMerged();
 }
 
 int TapeChannel::Pump()
@@ -386,27 +525,37 @@ int TapeChannel::Pump()
    struct timeval          t0;
    char                   *bp, *cp;
    mddBuf                  m;
+   Offsets                 rdb;
    u_int64_t               off;
    size_t                  nt;
    bool                    bPmp;
    int                     n, mSz, rc;
 
-   // Pre-condition(s)
+   // Pre-condition(s) : Export() / BuildTickerIndex() 1st
 
-   if ( !_hdr || !_bRun )
+   if ( !_hdr || !_bRun || _bInUse )
       return 0;
 
-   // Specific ticker(s)??
+   // Merged : Watch list and time slice applied per tape
 
    TapeRun run( *this );
 
+   if ( IsMerged() && ( !_slice || _slice->_bByTime ) ) {
+      TapeMerge mrg( *this );
+
+      return mrg.Run();
+   }
+
+   // Specific ticker(s)??
+
    if ( (nt=_wl.size()) ) {
       it = _wl.begin();
       for ( rc=0; it!=_wl.end(); rc += PumpTicker( (*it).first ), it++ );
       return rc;
    }
    /*
-    * PumpTpe( off, nMsg )??
+    * PumpTpe( off, nMsg )??  Merged : Offsets, and hence PumpTicker() 
+    * above, are 1st tape only
     */
    {
       Locker lck( _sliceMtx );
@@ -425,6 +574,18 @@ int TapeChannel::Pump()
    _PumpDead();
    if ( t0.tv_sec )
       off = _tapeOffset( t0 );
+   _vwHdr->advise( mmap_sequential );
+   /*
+    * ioctl_tapeThreads : One range per thread
+    */
+   if ( !_nSub && ( _chan._nTapeThr > 1 ) ) {
+      if ( _TapeRanges( off, _vwHdr->siz(), _chan._nTapeThr, rdb ) > 1 )
+         return _PumpParallel( rdb );
+   }
+   /*
+    * ioctl_tapePrefetch : Touch pages ahead of us
+    */
+   _PrefetchStart( off );
    for ( n=0; !_nSub && bPmp && _bRun && off<_vwHdr->siz(); ) {
       cp      = bp+off;
       msg     = (GLrecTapeMsg *)cp;
@@ -433,6 +594,8 @@ int TapeChannel::Pump()
       m._dLen = msg->_msgLen - mSz;
       n      += _PumpOneMsg( *msg, m, false, bPmp );
       off    += msg->_msgLen;
+      if ( _pf )
+         _pf->Reader( off );
    }
    _PumpComplete( msg, off );  
 
@@ -468,6 +631,7 @@ int TapeChannel::PumpTicker( int ix )
    /*
     * Remap if too big
     */
+   off     = rec->_loc();
    loc     = hdr()._curLoc();
    vwSz    = _vwHdr->siz();
    loc     = _vwHdr->siz();
@@ -481,6 +645,11 @@ int TapeChannel::PumpTicker( int ix )
       loc1  = hdr()._curLoc();
    }
    _PumpDead();
+   _vwHdr->advise( mmap_random );
+   if ( _tkrIdx )
+      return _PumpTickerIdx( ix, off );
+   if ( _slice && _slice->_bByTime && _WindowCheaper( nMsg ) )
+      return _PumpTickerWindow( ix );
    bPmp = true;
    bp   = _vwHdr->data();
    for ( i=0,n=0; bPmp && _bRun && off; i++ ) {
@@ -531,6 +700,7 @@ int TapeChannel::PumpTicker( int ix )
       m._dLen = msg->_msgLen - mSz;
       n      += _PumpOneMsg( *msg, m, true, notUsed );
    }
+   n += _PumpBars();
    _PumpStatus( msg, "Stream Complete", edg_streamDone );
 
    // Return number pumped
@@ -538,6 +708,47 @@ int TapeChannel::PumpTicker( int ix )
    return n;
 }
 
+bool TapeChannel::BuildTickerIndex()
+{
+   u_int64_t loc;
+   bool      bOK;
+
+   // Pre-condition(s)
+
+   _err = "";
+   if ( !_hdr || !_vwHdr ) {
+      _err = "Tape not loaded";
+      return false;
+   }
+   {
+      Locker lck( _sliceMtx );
+
+      if ( _slice || _bRun || _bInUse ) {
+         _err = "Tape busy";
+         return false;
+      }
+      _bInUse = true;
+   }
+   loc = gmin( hdr()._curLoc(), _vwHdr->siz() );
+   bOK = ( _tkrIdx && ( _tkrIdx->curLoc() == loc ) );
+
+   // Unmap before re-writing; Build; Load
+
+   if ( !bOK ) {
+      if ( _tkrIdx )
+         delete _tkrIdx;
+      _tkrIdx = (GLrpyTkrIdxVw *)0;
+      bOK     = GLrpyTkrIdxVw::Build( hdr(), _vwHdr->data(), loc, pTkrIdxFile() );
+      bOK     = bOK && _LoadTkrIdx();
+      if ( !bOK ) {
+         _err  = "Can not build ";
+         _err += pTkrIdxFile();
+      }
+   }
+   _bInUse = false;
+   return bOK;
+}
+
 void TapeChannel::Stop()
 {
    _bRun = false;
@@ -553,9 +764,12 @@ void TapeChannel::Unload()
       delete _vwHdr;
    if ( _idx )
       delete _idx;
-   _vwHdr = (GLmmap *)0;
-   _hdr   = (TapeHeader *)0;
-   _idx   = (GLrpyDailyIdxVw *)0;
+   if ( _tkrIdx )
+      delete _tkrIdx;
+   _vwHdr  = (GLmmap *)0;
+   _hdr    = (TapeHeader *)0;
+   _idx    = (GLrpyDailyIdxVw *)0;
+   _tkrIdx = (GLrpyTkrIdxVw *)0;
 }
 
 
@@ -571,12 +785,72 @@ bool TapeChannel::_LoadHdr()
       delete _hdr;      
       _hdr  = (TapeHeader *)0;
       _err  = "Can not map header ";
-      _err += pTape();
+      _err += pFile();
       Unload();
    }
    return _hdr ? true : false;
 }    
 
+bool TapeChannel::_LoadTkrIdx()
+{
+   char *pi;
+
+   if ( _tkrIdx )
+      delete _tkrIdx;
+   pi      = (char *)_tkrIdxFile.data();
+   _tkrIdx = new GLrpyTkrIdxVw( pi );
+   if ( !_tkrIdx->IsValid( hdr() ) ) {
+      delete _tkrIdx;
+      _tkrIdx = (GLrpyTkrIdxVw *)0;
+   }
+   return( _tkrIdx != (GLrpyTkrIdxVw *)0 );
+}
+
+bool TapeChannel::_LoadMerged()
+{
+   TapeChannel          *kid;
+   TapeRecords::iterator it;
+   string                s;
+   size_t                i, j, nr;
+   int                   ix;
+
+   // Pre-condition(s)
+
+   if ( !IsMerged() )
+      return true;
+
+   /*
+    * Load each kid; Map its dbIdx to a merged StreamID :
+    *    In our tape  : Our dbIdx
+    *    Else         : _mrgNext++, shared by all kids
+    */
+   _mrgRdb.clear();
+   _mrgRecs.clear();
+   for ( i=0; i<_kids.size(); i++ ) {
+      kid = _kids[i];
+      if ( !kid->Load() ) {
+         _err = kid->err() ? kid->err() : kid->pFile();
+         return false;
+      }
+      nr = kid->_tdb.size();
+      kid->_mrgIDs.resize( nr );
+      for ( j=0; j<nr; j++ ) {
+         s = _Key( kid->_tdb[j]->_svc(), kid->_tdb[j]->_tkr() );
+         if ( (it=_rdb.find( s )) != _rdb.end() )
+            ix = (*it).second;
+         else if ( (it=_mrgRdb.find( s )) != _mrgRdb.end() )
+            ix = (*it).second;
+         else {
+            ix         = _mrgNext++;
+            _mrgRdb[s] = ix;
+            _mrgRecs.push_back( kid->_tdb[j] );
+         }
+         kid->_mrgIDs[j] = ix;
+      }
+   }
+   return true;
+}
+
 TapeRecHdr *TapeChannel::_GetRecHdr( int dbIdx )
 {
    TapeHeader &h = hdr();
@@ -604,6 +878,18 @@ TapeRecHdr *TapeChannel::_GetRecHdr( int dbIdx )
    return rec;
 }
 
+TapeRecHdr *TapeChannel::_StreamRec( int ix )
+{
+   size_t mx;
+
+   // Merged StreamID beyond our tape : 1st kid that has it
+
+   if ( ix < (int)_tdb.size() )
+      return _tdb[ix];
+   mx = (size_t)( ix - hdr()._maxRec() );
+   return( mx < _mrgRecs.size() ) ? _mrgRecs[mx] : _tdb[0];
+}
+
 bool TapeChannel::_InTimeRange( GLrecTapeMsg &m )
 {
    return _slice ? _slice->InTimeRange( m ) : true;
@@ -673,6 +959,13 @@ int TapeChannel::_LoadSchema()
 }
 
 bool TapeChannel::_ParseFieldList( mddBuf raw )
+{
+   return _ParseFieldList( _mdd, _fl, raw );
+}
+
+bool TapeChannel::_ParseFieldList( mddWire_Context mdd, 
+                                   mddFieldList   &fl, 
+                                   mddBuf          raw )
 {
    FieldMap          &sdb = _schema;
    FieldMap::iterator it;
@@ -682,25 +975,25 @@ bool TapeChannel::_ParseFieldList( mddBuf raw )
    mddField           f;
    int                i, nb, nh, nf;
 
-   _fl._nFld = 0;
-   w._dt     = mddDt_FieldList;
-   w._flds   = _fl;
-   w._svc    = _zBUF;
-   w._tkr    = _zBUF;
+   fl._nFld = 0;
+   w._dt    = mddDt_FieldList;
+   w._flds  = fl;
+   w._svc   = _zBUF;
+   w._tkr   = _zBUF;
    ::memset( &h, 0, sizeof( h ) );
 
    // Parse : Header 1st, then full enchilada
 
-   nh  = ::mddSub_ParseHdr( _mdd, inp, &h );
-   nb  = ::mddSub_ParseMsg( _mdd, inp, &w );
-   _fl = w._flds;
-   nf  = _fl._nFld;
+   nh = ::mddSub_ParseHdr( mdd, inp, &h );
+   nb = ::mddSub_ParseMsg( mdd, inp, &w );
+   fl = w._flds;
+   nf = fl._nFld;
    for ( i=0; i<nf; i++ ) {
-      f       = _fl._flds[i];
+      f       = fl._flds[i];
       f._name = _undef;
       if ( (it=sdb.find( f._fid )) != sdb.end() )
          f._name = (*it).second._name;
-      _fl._flds[i] = f;
+      fl._flds[i] = f;
    }
    return( nf > 0 );
 }
@@ -759,6 +1052,8 @@ void TapeChannel::_PumpStatus( GLrecTapeMsg *msg,
    d._pErr     = sts;
    d._ty       = ty;
    d._TapePos  = off;
+   if ( ty == edg_streamDone )
+      _PageFaults();
    if ( _attr._dataCbk )
       (*_attr._dataCbk)( _chan.cxt(), d );
 }
@@ -820,11 +1115,25 @@ int TapeChannel::_PumpSlice( u_int64_t off0, int nMsg )
 }
 
 int TapeChannel::_PumpOneMsg( GLrecTapeMsg &msg, mddBuf m, bool bRev, bool &bPmp )
+{
+   rtEdgeData d;
+
+   if ( !_ParseOneMsg( msg, m, bRev, bPmp, _mdd, _fl, d ) )
+      return 0;
+   return _DispatchOne( d );
+}
+
+bool TapeChannel::_ParseOneMsg( GLrecTapeMsg   &msg, 
+                                mddBuf          m, 
+                                bool            bRev, 
+                                bool           &bPmp,
+                                mddWire_Context mdd,
+                                mddFieldList   &fl,
+                                rtEdgeData     &d )
 {
    TapeRecHdr    *rec;
-   rtEdgeData     d;
    struct timeval tv;
-   int            ix, n;
+   int            ix;
 
    // Pre-condition(s)
 
@@ -833,12 +1142,12 @@ int TapeChannel::_PumpOneMsg( GLrecTapeMsg &msg, mddBuf m, bool bRev, bool &bPmp
          bPmp &= ( msg._tv_sec >= _slice->_t0.tv_sec );
       else
          bPmp &= ( msg._tv_sec <= _slice->_t1.tv_sec );
-      return 0;
+      return false;
    }
    if ( !_IsWatched( msg ) )
-      return 0;
-   if ( !_ParseFieldList( m ) )
-      return 0;
+      return false;
+   if ( !_ParseFieldList( mdd, fl, m ) )
+      return false;
 
    // Msg Time
 
@@ -846,7 +1155,7 @@ int TapeChannel::_PumpOneMsg( GLrecTapeMsg &msg, mddBuf m, bool bRev, bool &bPmp
    tv.tv_usec = msg._tv_usec;
    ::memset( &d, 0, sizeof( d ) );
 
-   // Fill in rtEdgeData and dispatch
+   // Fill in rtEdgeData
 
    ix          = msg._dbIdx;
    rec         = _tdb[ix];
@@ -855,19 +1164,29 @@ int TapeChannel::_PumpOneMsg( GLrecTapeMsg &msg, mddBuf m, bool bRev, bool &bPmp
    d._pTkr     = rec->_tkr();
    d._pErr     = "OK";
    d._ty       = edg_update;
-   d._flds     = (rtFIELD *)_fl._flds;
-   d._nFld     = _fl._nFld;
+   d._flds     = (rtFIELD *)fl._flds;
+   d._nFld     = fl._nFld;
    d._rawData  = m._data;
    d._rawLen   = m._dLen;
-   d._StreamID = ix;
+   d._StreamID = _mrgIDs.size() ? _mrgIDs[ix] : ix;
    d._TapePos  = (char *)&msg - _vwHdr->data();
    d._RTL      = msg._nUpd;
+   return true;
+}
+
+int TapeChannel::_DispatchOne( rtEdgeData &d )
+{
+   rtFIELD *fdb;
+   int      n, nf;
+
+   fdb = d._flds;
+   nf  = d._nFld;
    if ( _slice ) {
       for ( n=0; _slice->CanPump( n, d ); n++ ) {
          if ( _attr._dataCbk )
             (*_attr._dataCbk)( _chan.cxt(), d );
-         d._flds = (rtFIELD *)_fl._flds;
-         d._nFld = _fl._nFld;
+         d._flds = fdb;
+         d._nFld = nf;
       }
       return n;
    }
@@ -879,12 +1198,286 @@ int TapeChannel::_PumpOneMsg( GLrecTapeMsg &msg, mddBuf m, bool bRev, bool &bPmp
    return n;
 }
 
+int TapeChannel::_PumpParallel( Offsets &rdb )
+{
+   TapePumpJobs  jobs;
+   TapePumpJob  *job;
+   TapeMsgBlk   *blk;
+   GLrecTapeMsg *msg;
+   rtEdgeData    d;
+   mddBuf        m;
+   bool          bOrd, bDone;
+   size_t        j, nm;
+   int           i, n, nr, fOff;
+
+   /*
+    * 1) One job per range : Sampled slice is stateful, so always ordered
+    */
+   nr   = (int)rdb.size() - 1;
+   bOrd = _chan._bTapeOrdered || ( _slice && _slice->IsSampled() );
+   for ( i=0; i<nr; i++ ) {
+      jobs.push_back( new TapePumpJob( *this, rdb[i], rdb[i+1], bOrd ) );
+      jobs[i]->Start();
+   }
+   /*
+    * 2) Ordered : Drain each job in turn on this thread; Unordered : Wait
+    */
+   for ( i=0,n=0; bOrd && i<nr; ) {
+      job   = jobs[i];
+      bDone = job->IsDone();
+      if ( !(blk=job->Pop()) ) {
+         if ( bDone )
+            i++;
+         else
+            ::rtEdge_Sleep( 0.001 );
+         continue; // for-i
+      }
+      nm = blk->_msgs.size();
+      for ( j=0; _bRun && j<nm; j++ ) {
+         d    = blk->_msgs[j];
+         fOff = blk->_fOff[j];
+         if ( fOff == -1 ) {
+            m._data = (char *)d._rawData;
+            m._dLen = d._rawLen;
+            _ParseFieldList( m );
+            d._flds = (rtFIELD *)_fl._flds;
+            d._nFld = _fl._nFld;
+         }
+         else
+            d._flds = blk->_flds.data() + fOff;
+         n += _DispatchOne( d );
+      }
+      delete blk;
+   }
+   for ( i=0; i<nr; jobs[i++]->Join() );
+   /*
+    * 3) Stream Complete from last msg on tape; Clean up
+    */
+   msg = (GLrecTapeMsg *)0;
+   for ( i=0; i<nr; i++ ) {
+      n  += bOrd ? 0 : jobs[i]->_nMsg;
+      msg = jobs[i]->_last ? jobs[i]->_last : msg;
+      delete jobs[i];
+   }
+   _PumpComplete( msg, rdb[nr] );
+   return n;
+}
+
+int TapeChannel::_TapeRanges( u_int64_t off0, 
+                              u_int64_t end, 
+                              int       nThr, 
+                              Offsets  &rdb )
+{
+   TapeHeader   &h = hdr();
+   GLrecTapeMsg *msg;
+   char         *bp, *cp;
+   u_int64_t    *idb, tgt, off;
+   int           i, k, ni;
+
+   /*
+    * Split on tapeIdxDb() boundaries nearest ( end-off0 ) / nThr;
+    * Each boundary is the 1st msg in its time interval
+    */
+   rdb.clear();
+   off0 = off0 ? off0 : h._hdrSiz();
+   rdb.push_back( off0 );
+   bp   = _vwHdr->data();
+   cp   = bp + h._DbHdrSize( h._numDictEntry(), 0, 0 );
+   idb  = (u_int64_t *)cp;
+   ni   = h._numSecIdxT();
+   for ( i=1,k=0; i<nThr; i++ ) {
+      tgt = off0 + ( ( end-off0 ) * i ) / nThr;
+      for ( ; k<ni && ( idb[k] < tgt ); k++ );
+      if ( k == ni )
+         break; // for-i
+      off = idb[k];
+      if ( ( off <= rdb.back() ) || ( off >= end ) )
+         continue; // for-i
+      msg = (GLrecTapeMsg *)( bp+off );
+      if ( !InRange( 0, msg->_dbIdx, (u_int32_t)h._numRec() ) )
+         continue; // for-i
+      rdb.push_back( off );
+   }
+   rdb.push_back( end );
+   return (int)rdb.size() - 1;
+}
+
+int TapeChannel::_PumpTickerIdx( int ix, u_int64_t off )
+{
+   GLrecTapeMsg *msg;
+   Offsets       tail;
+   char         *bp, *cp;
+   mddBuf        m;
+   u_int64_t    *idb, loc, diff, nIdx, nt, nm, jLo, jHi, i, j;
+   bool          bPmp, bRev;
+   int           n, mSz;
+
+   /*
+    * 1) Msgs since index built : Walk back from _loc() to index _curLoc
+    * 2) Index + tail : Oldest 1st, else newest 1st if _bTapeDir
+    */
+   bp  = _vwHdr->data();
+   loc = _tkrIdx->curLoc();
+   for ( ; off && ( off >= loc ); off -= diff ) {
+      tail.push_back( off );
+      msg  = (GLrecTapeMsg *)( bp+off );
+      if ( msg->_bLast4 )
+         diff = (u_int64_t)_get32( msg->_last );
+      else
+         diff = _get64( msg->_last );
+   }
+   idb  = _tkrIdx->offsets( ix, nIdx );
+   nt   = tail.size();
+   nm   = nIdx + nt;
+   jLo  = 0;
+   jHi  = nm;
+   bRev = _chan._bTapeDir;
+   bPmp = true;
+   msg  = (GLrecTapeMsg *)0;
+   /*
+    * 3) Time slice : Binary search index; Tail only if slice reaches it
+    */
+   if ( _slice && _slice->_bByTime ) {
+      jLo = _SeekIdx( idb, nIdx, _slice->_t0 );
+      jHi = _SeekIdx( idb, nIdx, _SliceEnd() );
+      jHi = ( jHi < nIdx ) ? jHi : nm;
+   }
+   for ( i=0,n=0; bPmp && _bRun && i<jHi-jLo; i++ ) {
+      j       = bRev ? jHi-1-i : jLo+i;
+      off     = ( j < nIdx ) ? idb[j] : tail[nt-1-(j-nIdx)];
+      cp      = bp+off;
+      msg     = (GLrecTapeMsg *)cp;
+      mSz     = msg->_bLast4 ? _mSz4 : _mSz8;
+      m._data = cp + mSz;
+      m._dLen = msg->_msgLen - mSz;
+      n      += _PumpOneMsg( *msg, m, bRev, bPmp );
+   }
+   n += _PumpBars();
+   _PumpStatus( msg, "Stream Complete", edg_streamDone );
+
+   // Return number pumped
+
+   return n;
+}
+
+int TapeChannel::_PumpTickerWindow( int ix )
+{
+   GLrecTapeMsg *msg;
+   Offsets       odb;
+   char         *bp, *cp;
+   mddBuf        m;
+   u_int64_t     off, end;
+   size_t        i, nr;
+   bool          bPmp, bRev;
+   int           n, mSz;
+
+   /*
+    * 1) Seek to slice; Hop msg headers thru end of slice
+    */
+   _vwHdr->advise( mmap_sequential );
+   bp  = _vwHdr->data();
+   off = _tapeOffset( _slice->_t0 );
+   end = _tapeOffset( _SliceEnd() );
+   msg = (GLrecTapeMsg *)0;
+   for ( ; off<end; off+=msg->_msgLen ) {
+      msg = (GLrecTapeMsg *)( bp+off );
+      if ( !msg->_msgLen )
+         break; // for-off
+      if ( (int)msg->_dbIdx == ix )
+         odb.push_back( off );
+   }
+   /*
+    * 2) Oldest 1st, else newest 1st if _bTapeDir
+    */
+   nr   = odb.size();
+   bRev = _chan._bTapeDir;
+   bPmp = true;
+   msg  = (GLrecTapeMsg *)0;
+   for ( i=0,n=0; bPmp && _bRun && i<nr; i++ ) {
+      off     = odb[bRev ? nr-1-i : i];
+      cp      = bp+off;
+      msg     = (GLrecTapeMsg *)cp;
+      mSz     = msg->_bLast4 ? _mSz4 : _mSz8;
+      m._data = cp + mSz;
+      m._dLen = msg->_msgLen - mSz;
+      n      += _PumpOneMsg( *msg, m, bRev, bPmp );
+   }
+   n += _PumpBars();
+   _PumpStatus( msg, "Stream Complete", edg_streamDone );
+
+   // Return number pumped
+
+   return n;
+}
+
+void TapeChannel::_PrefetchStart( u_int64_t off )
+{
+   u_int64_t ahead;
+
+   // Pre-condition
+
+   _PrefetchStop();
+   if ( !(ahead=_chan._tapePrefetch) )
+      return;
+
+   // Stay ahead of reader thru end of tape
+
+   _pf = new TapePrefetch( *_vwHdr, off, _vwHdr->siz(), ahead );
+   _pf->Start();
+}
+
+void TapeChannel::_PrefetchStop()
+{
+   if ( _pf ) {
+      _pf->Stop();
+      delete _pf;
+   }
+   _pf = (TapePrefetch *)0;
+}
+
+void TapeChannel::_PageFaults()
+{
+   rtEdgeChanStats &st = _chan.stats();
+   u_int64_t        nMin, nMaj;
+
+   // Since TapeRun; This (replay) thread only
+
+   GLmmap::PageFaults( nMin, nMaj );
+   st._nMinFlt = (long)( nMin - _flt0Min );
+   st._nMajFlt = (long)( nMaj - _flt0Maj );
+}
+
+bool TapeChannel::_WindowCheaper( u_int64_t nMsg )
+{
+   TapeHeader &h = hdr();
+   u_int64_t   nTape, off, end, vwSz;
+   double      dWin, dChain;
+   size_t      i;
+
+   /*
+    * Msgs visited : Slice window vs. ticker back-chain thru _t0
+    * A chain visit is _PumpOneMsg() on a scattered msg; ~4 header hops
+    */
+
+   for ( i=0,nTape=0; i<_tdb.size(); nTape+=_tdb[i]->_nMsg(), i++ );
+   vwSz = _vwHdr->siz();
+   if ( !nTape || ( vwSz <= h._hdrSiz() ) )
+      return true;
+   off    = _tapeOffset( _slice->_t0 );
+   end    = _tapeOffset( _SliceEnd() );
+   dWin   = (double)nTape * ( end - off );
+   dChain = (double)nMsg  * ( vwSz - off ) * 4.0;
+   return( dWin < dChain );
+}
+
 void TapeChannel::_PumpComplete( GLrecTapeMsg *msg, u_int64_t off )
 {
    const char *sts;
 
-   // 1) Done
+   // 1) Trailing bars, if any; Done
 
+   _PrefetchStop();
+   _PumpBars();
    sts = _bRun ? "Stream Complete" : "Stream terminated";
    _PumpStatus( msg, sts, edg_streamDone, off );
 
@@ -892,9 +1485,27 @@ void TapeChannel::_PumpComplete( GLrecTapeMsg *msg, u_int64_t off )
 
    _bRun   = false;
    _bInUse = false;
-   if ( _idx )
-      delete _idx;
-   _idx = (GLrpyDailyIdxVw *)0;
+}
+
+int TapeChannel::_PumpBars()
+{
+   rtEdgeData d;
+   int        n;
+
+   // Pre-condition
+
+   if ( !_slice || !_slice->IsBar() )
+      return 0;
+
+   // Each ticker's last bar
+
+   ::memset( &d, 0, sizeof( d ) );
+   d._pErr = "OK";
+   for ( n=0; _bRun && _slice->FlushBar( d ); n++ ) {
+      if ( _attr._dataCbk )
+         (*_attr._dataCbk)( _chan.cxt(), d );
+   }
+   return n;
 }
 
 string TapeChannel::_Key( const char *svc, const char *tkr )
@@ -922,57 +1533,144 @@ u_int64_t TapeChannel::_get64( u_char *bp )
 
 u_int64_t TapeChannel::_tapeOffset( struct timeval tv )
 {
-   int        ix;
-   char      *cp;
-   u_int64_t *idb;
+   TapeHeader    &h = hdr();
+   GLrecTapeMsg  *msg;
+   struct timeval nxt;
+   char          *bp;
+   u_int64_t     *idb, off, end;
+   time_t         tDay, tTape;
+   int            ix, nIdx, secPerIdx;
+
+   /*
+    * 1) Day : Header index is the current (latest) day, per _curIdxTm or
+    *    last insert; GLrpyDailyIdxVw holds the earlier days
+    */
+   bp        = _vwHdr->data();
+   end       = _vwHdr->siz();
+   tTape     = h._curIdxTm().tv_sec;
+   tTape     = tTape ? tTape : h._curTime().tv_sec;
+   tTape     = _DayStart( tTape ? tTape : h._tCreate() );
+   tDay      = _DayStart( tv.tv_sec );
+   nIdx      = h._numSecIdxT();
+   secPerIdx = h._secPerIdxT();
+   if ( ( secPerIdx <= 0 ) || ( nIdx <= 0 ) )
+      return h._hdrSiz();
+   if ( tDay > tTape )
+      return end;
+   if ( tDay == tTape )
+      idb = (u_int64_t *)( bp + h._DbHdrSize( h._numDictEntry(), 0, 0 ) );
+   else if ( !_idx || !(idb=_idx->Find( tDay )) )
+      return h._hdrSiz();
+
+   // 2) 1st non-empty bucket at or after tv; Else 1st msg of next day
+
+   ix = (int)( ( tv.tv_sec - tDay ) / secPerIdx );
+   ix = WithinRange( 0, ix, nIdx-1 );
+   for ( ; ix<nIdx && !idb[ix]; ix++ );
+   if ( ix == nIdx ) {
+      if ( tDay == tTape )
+         return end;
+      nxt.tv_sec  = _DayStart( tDay + 36*3600 );
+      nxt.tv_usec = 0;
+      return _tapeOffset( nxt );
+   }
+
+   // 3) Within bucket : Hop msg headers; No parse
 
-   // 1) Current Index
+   for ( off=idb[ix]; off<end; off+=msg->_msgLen ) {
+      msg = (GLrecTapeMsg *)( bp+off );
+      if ( !msg->_msgLen || !_IsBefore( *msg, tv ) )
+         break; // for-off
+   }
+   return gmin( off, end );
+}
 
-   ix = _SecIdx( tv, (GLrecTapeRec *)0 );
+u_int64_t TapeChannel::_SeekIdx( u_int64_t     *idb, 
+                                 u_int64_t      nIdx, 
+                                 struct timeval tv )
+{
+   GLrecTapeMsg *msg;
+   char         *bp;
+   u_int64_t     lo, hi, mid;
 
-   // 2) tapeIdxDb() : TODO - GLrpyDailyIdxVw
+   // Binary search : 1st idb[] entry at or after tv; idb[] is oldest 1st
 
-   cp  = _vwHdr->data();
-   cp += hdr()._DbHdrSize( hdr()._numDictEntry(), 0, 0 );
-   idb = (u_int64_t *)cp;
-   return idb[ix];
+   bp = _vwHdr->data();
+   lo = 0;
+   hi = nIdx;
+   while ( lo < hi ) {
+      mid = lo + ( ( hi-lo ) / 2 );
+      msg = (GLrecTapeMsg *)( bp+idb[mid] );
+      if ( _IsBefore( *msg, tv ) )
+         lo = mid+1;
+      else
+         hi = mid;
+   }
+   return lo;
 }
 
-int TapeChannel::_SecIdx( struct timeval now, GLrecTapeRec *rec )
+bool TapeChannel::_IsBefore( GLrecTapeMsg &msg, struct timeval tv )
+{
+   if ( (time_t)msg._tv_sec != tv.tv_sec )
+      return( (time_t)msg._tv_sec < tv.tv_sec );
+   return( (long)msg._tv_usec < (long)tv.tv_usec );
+}
+
+struct timeval TapeChannel::_SliceEnd()
 {
-   TapeHeader    &h  = hdr();
    struct timeval tv;
-   time_t         tt, tn;
-   struct tm     *tm, lt;
-   bool           bRec;
-   int            rtn, cmp, curIdx, secPerIdx;
 
-   // 1) Tape or Record?
+   // 1 uSec past _slice->_t1 : End of window for _tapeOffset() / _SeekIdx()
 
-   bRec      = ( rec != (GLrecTapeRec *)0 );
-   curIdx    = bRec ? rec->_curIdx    : h._curIdx();
-   secPerIdx = bRec ? h._secPerIdxR() : h._secPerIdxT();
-   tv        = bRec ? rec->_curIdxTm  : h._curIdxTm();
-   
-   // 2) Same Interval?
-   
-   rtn = curIdx;
-   tt  = tv.tv_sec;
-   tn  = now.tv_sec;
-   cmp = ( tn - tt );
-   if ( rtn && ( cmp > 0 ) && ( cmp < secPerIdx ) ) // 1st time?
-      return rtn;
-   
-   // 3) Else convert; Last resort = localtime
-   
-   if ( rtn )
-      rtn += ( cmp / secPerIdx );
-   else {
-      tm   = ::localtime_r( &tn, &lt );
-      rtn  = ( lt.tm_hour * 3600 ) + ( lt.tm_min * 60 ) + lt.tm_sec;
-      rtn /= secPerIdx;
+   tv          = _slice->_t1;
+   tv.tv_usec += 1;
+   if ( tv.tv_usec >= 1000000 ) {
+      tv.tv_sec  += 1;
+      tv.tv_usec -= 1000000;
+   }
+   return tv;
+}
+
+time_t TapeChannel::_DayStart( time_t t )
+{
+   struct tm *tm, lt;
+
+   tm          = ::localtime_r( &t, &lt );
+   lt.tm_hour  = 0;
+   lt.tm_min   = 0;
+   lt.tm_sec   = 0;
+   lt.tm_isdst = -1;
+   return ::mktime( &lt );
+}
+
+int TapeChannel::_TapeFiles( const char *pList, TapeFiles &fdb )
+{
+   string s( pList );
+   char  *tok, *rp;
+#if !defined(WIN32)
+   glob_t gl;
+   size_t i;
+#endif // !defined(WIN32)
+
+   /*
+    * CSV list; Each may be a glob : ULTRA.trep_202610*.1,MDD.trep_20261017.1
+    * glob() sorts, so daily tapes replay in date order
+    */
+   fdb.clear();
+   tok = ::strtok_r( (char *)s.data(), t_CSV, &rp );
+   for ( ; tok; tok=::strtok_r( NULL, t_CSV, &rp ) ) {
+#if !defined(WIN32)
+      if ( ::strpbrk( tok, "*?[" ) ) {
+         if ( !::glob( tok, 0, NULL, &gl ) ) {
+            for ( i=0; i<gl.gl_pathc; fdb.push_back( gl.gl_pathv[i] ), i++ );
+         }
+         ::globfree( &gl );
+         continue; // for-tok
+      }
+#endif // !defined(WIN32)
+      fdb.push_back( string( tok ) );
    }
-   return rtn;
+   return (int)fdb.size();
 }
 
 void TapeChannel::_BuildFieldMap()
@@ -1028,20 +1726,30 @@ TapeSlice::TapeSlice( TapeChannel &tape, const char *tkr ) :
    _fidSet(),
    _off0( 0 ),
    _NumMsg( 0 ),
-   _LVC()
+   _LVC(),
+   _bBar( false ),
+   _volFid( 0 ),
+   _barIdx(),
+   _bars(),
+   _barTkrs(),
+   _barFlds(),
+   _barNames(),
+   _barTmsg( 0.0 ),
+   _barFlush( 0 )
 {
    string         s( tkr );
    struct timeval tmp;
-   char          *ps, *p0, *p1, *p2, *p3, *rp;
+   char          *ps, *p0, *p1, *p2, *p3, *p4, *rp;
    int            fid;
 
-   // tStart|tEnd|tInteral|FIDs
+   // tStart|tEnd|tInteral|FIDs[|BAR[:VolumeField]]
 
    ps   = (char *)s.data();
    p0   = ::strtok_r( ps,   t_SEP, &rp );
    p1   = ::strtok_r( NULL, t_SEP, &rp );
    p2   = p1 ? ::strtok_r( NULL, t_SEP, &rp ) : (char *)0;
    p3   = p2 ? ::strtok_r( NULL, t_SEP, &rp ) : (char *)0;
+   p4   = p3 ? ::strtok_r( NULL, t_SEP, &rp ) : (char *)0;
    /*
     * tStart, tEnd
     */
@@ -1074,6 +1782,8 @@ TapeSlice::TapeSlice( TapeChannel &tape, const char *tkr ) :
          fdb.insert( fid );
       }
    }
+   if ( p4 )
+      _BarInit( p4 );
 }
 
 TapeSlice::TapeSlice( TapeChannel &tape, u_int64_t off0, int NumMsg ) :
@@ -1090,7 +1800,16 @@ TapeSlice::TapeSlice( TapeChannel &tape, u_int64_t off0, int NumMsg ) :
    _fidSet(),
    _off0( off0 ),
    _NumMsg( NumMsg ),
-   _LVC()
+   _LVC(),
+   _bBar( false ),
+   _volFid( 0 ),
+   _barIdx(),
+   _bars(),
+   _barTkrs(),
+   _barFlds(),
+   _barNames(),
+   _barTmsg( 0.0 ),
+   _barFlush( 0 )
 {
 }
 
@@ -1108,7 +1827,16 @@ TapeSlice::TapeSlice( const TapeSlice &c ) :
    _fidSet(),
    _off0( c._off0 ),
    _NumMsg( c._NumMsg ),
-   _LVC()
+   _LVC(),
+   _bBar( false ),
+   _volFid( 0 ),
+   _barIdx(),
+   _bars(),
+   _barTkrs(),
+   _barFlds(),
+   _barNames(),
+   _barTmsg( 0.0 ),
+   _barFlush( 0 )
 {
 }
 
@@ -1121,6 +1849,11 @@ bool TapeSlice::IsSampled()
    return( ( _tInterval > 0 ) && ( _fids.size() > 0 ) );
 }
 
+bool TapeSlice::IsBar()
+{
+   return( _bBar && IsSampled() );
+}
+
 bool TapeSlice::InTimeRange( GLrecTapeMsg &m )
 {
    struct timeval tv = { (time_t)m._tv_sec, (long)m._tv_usec };
@@ -1136,6 +1869,8 @@ bool TapeSlice::CanPump( int nDup, rtEdgeData &d )
 
    // Pre-condition(s)
 
+   if ( IsBar() )
+      return _CanPumpBar( nDup, d );
    if ( !InRange( _td0, d._tMsg, _td1 ) )
       return false;
    if ( !IsSampled() )
@@ -1173,6 +1908,25 @@ bool TapeSlice::CanPump( int nDup, rtEdgeData &d )
    return true;
 }
 
+bool TapeSlice::FlushBar( rtEdgeData &d )
+{
+   size_t nt;
+   int    ix;
+
+   // Each ticker w/ open bar once; Rewind when done
+
+   nt = _barTkrs.size();
+   for ( ; _barFlush<nt; ) {
+      ix = (int)_barFlush++;
+      if ( _barTkrs[ix]._nUpd ) {
+         _BarOut( ix, d );
+         return true;
+      }
+   }
+   _barFlush = 0;
+   return false;
+}
+
 
 ////////////////////////////////////
 // Helpers
@@ -1267,84 +2021,1333 @@ void TapeSlice::_Cache( rtEdgeData &d )
    }
 }
 
+void TapeSlice::_BarInit( char *pBar )
+{
+   FieldMap          &sdb = _tape._schema;
+   FieldMap::iterator it;
+   const char        *pn;
+   char              *pVol, buf[K];
+   size_t             i, nf;
+   int                v, fid;
+   const char        *sfx[] = { "_OPEN", "_HIGH", "_LOW", "_CLOSE", 
+                                "_VOLUME", "_VWAP", "_COUNT" };
+
+   // BAR[:VolumeField]
+
+   if ( ::strncmp( pBar, t_BAR, strlen( t_BAR ) ) )
+      return;
+   _bBar = true;
+   if ( (pVol=::strchr( pBar, ':' )) && !(_volFid=atoi( pVol+1 )) )
+      _volFid = _tape.GetFieldID( pVol+1 );
+
+   // FID to index in _bars; rtBarValue names
+
+   nf = _fids.size();
+   for ( i=0; i<nf; i++ ) {
+      fid          = _fids[i];
+      _barIdx[fid] = (int)i;
+      it           = sdb.find( fid );
+      pn           = ( it != sdb.end() ) ? (*it).second._name : (char *)0;
+      for ( v=rtBar_open; v<=rtBar_count; v++ ) {
+         if ( pn )
+            sprintf( buf, "%s%s", pn, sfx[v] );
+         else
+            sprintf( buf, "%d%s", fid, sfx[v] );
+         _barNames.push_back( string( buf ) );
+      }
+   }
+   _barFlds.resize( _barNames.size() );
+   if ( _barFlds.size() )
+      ::memset( _barFlds.data(), 0, _barFlds.size()*sizeof( rtFIELD ) );
+}
+
+bool TapeSlice::_CanPumpBar( int nDup, rtEdgeData &d )
+{
+   time_t tMsg;
+   int    ix;
+
+   // 2nd pass : Bar delivered; Restore msg time and start new bar
+
+   if ( nDup ) {
+      d._tMsg = _barTmsg;
+      _BarAdd( d );
+      return false;
+   }
+
+   /*
+    * 1st pass : Deliver ticker's bar iff msg is in another interval; 
+    * Per-ticker, so PumpTicker() one ticker at a time and reverse 
+    * tape direction work as well
+    */
+   if ( !InRange( _td0, d._tMsg, _td1 ) )
+      return false;
+   ix   = d._StreamID;
+   tMsg = (time_t)d._tMsg;
+   TapeBarTkr &t = _BarTkr( ix );
+
+   if ( !t._nUpd || InRange( t._tBar, tMsg, t._tBar+_tInterval-1 ) ) {
+      _BarAdd( d );
+      return false;
+   }
+   _barTmsg = d._tMsg;
+   _BarOut( ix, d );
+   return true;
+}
+
+TapeBarTkr &TapeSlice::_BarTkr( int ix )
+{
+   TapeBarTkr zt;
+   TapeBar    zb;
+   size_t     nt;
+
+   // Grow flat arrays as new StreamID's show up
+
+   nt = (size_t)ix + 1;
+   if ( nt > _barTkrs.size() ) {
+      ::memset( &zt, 0, sizeof( zt ) );
+      ::memset( &zb, 0, sizeof( zb ) );
+      _barTkrs.resize( nt, zt );
+      _bars.resize( nt * _fids.size(), zb );
+   }
+   return _barTkrs[ix];
+}
+
+void TapeSlice::_BarAdd( rtEdgeData &d )
+{
+   TapeBarIdx::iterator it;
+   TapeBarTkr          &t = _BarTkr( d._StreamID );
+   TapeBar             *bdb, *b;
+   rtFIELD              f;
+   double               px, vol, wgt;
+   time_t               tMsg;
+   int                  i;
+
+   // 1st update in interval : Bar start time
+
+   if ( !t._nUpd ) {
+      tMsg    = (time_t)d._tMsg;
+      t._tBar = tMsg - ( tMsg % _tInterval );
+   }
+   t._nUpd += 1;
+
+   // Volume from _volFid in this msg; Weight by tick if no _volFid
+
+   vol = 0.0;
+   for ( i=0; _volFid && i<d._nFld; i++ ) {
+      if ( d._flds[i]._fid == (u_int)_volFid ) {
+         vol = ::rtEdge_atof( d._flds[i] );
+         break; // for-i
+      }
+   }
+   wgt = _volFid ? vol : 1.0;
+
+   // Accumulate
+
+   bdb = _bars.data() + ( d._StreamID * _fids.size() );
+   for ( i=0; i<d._nFld; i++ ) {
+      f = d._flds[i];
+      if ( (it=_barIdx.find( f._fid )) == _barIdx.end() )
+         continue; // for-i
+      b  = bdb + (*it).second;
+      px = ::rtEdge_atof( f );
+      if ( !b->_cnt ) {
+         b->_open   = px;
+         b->_high   = px;
+         b->_low    = px;
+         b->_close  = px;
+         b->_tOpen  = d._tMsg;
+         b->_tClose = d._tMsg;
+      }
+      b->_high   = gmax( b->_high, px );
+      b->_low    = gmin( b->_low, px );
+      if ( d._tMsg < b->_tOpen ) {  // Reverse tape direction
+         b->_open  = px;
+         b->_tOpen = d._tMsg;
+      }
+      if ( d._tMsg >= b->_tClose ) {
+         b->_close  = px;
+         b->_tClose = d._tMsg;
+      }
+      b->_vol   += vol;
+      b->_pxWgt += px * wgt;
+      b->_wgt   += wgt;
+      b->_cnt   += 1;
+   }
+}
+
+void TapeSlice::_BarOut( int ix, rtEdgeData &d )
+{
+   TapeBarTkr &t   = _barTkrs[ix];
+   TapeRecHdr *rec = _tape._StreamRec( ix );
+   TapeBar    *bdb, *b;
+   rtFIELD    *f;
+   double      val[rtBar_count+1];
+   size_t      i, nf;
+   int         v, nOut;
+
+   // One rtFIELD per rtBarValue per field updated in interval
+
+   nf  = _fids.size();
+   bdb = _bars.data() + ( ix * nf );
+   f   = _barFlds.data();
+   for ( i=0,nOut=0; i<nf; i++ ) {
+      b = bdb+i;
+      if ( !b->_cnt )
+         continue; // for-i
+      val[rtBar_open]   = b->_open;
+      val[rtBar_high]   = b->_high;
+      val[rtBar_low]    = b->_low;
+      val[rtBar_close]  = b->_close;
+      val[rtBar_volume] = b->_vol;
+      val[rtBar_VWAP]   = b->_wgt ? b->_pxWgt / b->_wgt : b->_close;
+      for ( v=rtBar_open; v<=rtBar_count; v++, f++, nOut++ ) {
+         f->_fid  = ( _fids[i] * rtBar_MUL ) + v;
+         f->_name = _barNames[(i*(rtBar_count+1))+v].data();
+         if ( v == rtBar_count ) {
+            f->_type     = rtFld_int;
+            f->_val._i32 = b->_cnt;
+         }
+         else {
+            f->_type     = rtFld_double;
+            f->_val._r64 = val[v];
+         }
+      }
+   }
+   ::memset( bdb, 0, nf*sizeof( TapeBar ) );
+   t._nUpd = 0;
+
+   // rtEdgeData : Bar start time
+
+   d._tMsg     = t._tBar;
+   d._pSvc     = rec->_svc();
+   d._pTkr     = rec->_tkr();
+   d._ty       = edg_update;
+   d._flds     = _barFlds.data();
+   d._nFld     = nOut;
+   d._rawData  = (const char *)0;
+   d._rawLen   = 0;
+   d._StreamID = ix;
+}
+
 
 
 /////////////////////////////////////////////////////////////////////////////
 //
-//            c l a s s       G L r p y D a i l y I d x V w
+//               c l a s s      T a p e C o l u m n
 //
 /////////////////////////////////////////////////////////////////////////////
 
+static rtColType _ColType( rtFldType ty )
+{
+   switch( ty ) {
+      case rtFld_int:
+      case rtFld_int8:
+      case rtFld_int16:
+      case rtFld_int64:
+      case rtFld_unixTime:
+         return rtCol_int64;
+      case rtFld_string:
+      case rtFld_bytestream:
+         return rtCol_string;
+      default:
+         break;
+   }
+   return rtCol_double;
+}
+
 ////////////////////////////////////////////
 // Constructor / Destructor
 ////////////////////////////////////////////
-GLrpyDailyIdxVw::GLrpyDailyIdxVw( TapeHeader &hdr, char *pf ) :
-   GLmmap( pf, (char *)0, 0, 0 ),
-   _hdr( hdr ),
-   _off( 0 ),
-   _daySz( hdr._DailyIdxSize() ),
-   _fileSz( 0 ),
-   _ss( (Sentinel *)0 ),
-   _tapeIdxDb( (u_int64_t *)0 )
+TapeColumn::TapeColumn( const char *name, 
+                        int         fid, 
+                        rtColType   ty, 
+                        bool        bTyped ) :
+   _bTyped( bTyped ),
+   _cells( (u_int64_t *)0 ),
+   _set( (u_char *)0 ),
+   _nRow( 0 ),
+   _nAlloc( 0 ),
+   _heap( 1, '\0' ),
+   _strs()
 {
-   _fileSz = siz();
-   _Set();
+   ::memset( &_def, 0, sizeof( _def ) );
+   safe_strcpy( _def._name, name );
+   _def._fid  = fid;
+   _def._type = ty;
+   _strs[""]  = 0;  // Empty string at heap offset 0
 }
 
-GLrpyDailyIdxVw::~GLrpyDailyIdxVw()
+TapeColumn::~TapeColumn()
 {
+   if ( _cells )
+      ::free( _cells );
+   if ( _set )
+      ::free( _set );
 }
 
 
 ////////////////////////////////////////////
-// Access
+// Operations
 ////////////////////////////////////////////
-Sentinel &GLrpyDailyIdxVw::sentinel()
+void TapeColumn::Add( u_int64_t cell, bool bSet )
 {
-   return *_ss;
+   if ( _nRow == _nAlloc )
+      _Grow();
+   _cells[_nRow] = cell;
+   if ( bSet )
+      _set[_nRow>>3] |= ( 1 << ( _nRow & 7 ) );
+   _nRow += 1;
 }
 
-u_int64_t *GLrpyDailyIdxVw::tapeIdxDb()
+u_int64_t TapeColumn::Cell( rtFIELD &f )
 {
-   return _tapeIdxDb;
+   rtVALUE              &v = f._val;
+   rtBUF                &b = v._buf;
+   TapeColStrs::iterator it;
+   string                s;
+   char                  buf[K];
+   double                r64;
+   int64_t               i64;
+   u_int64_t             rc;
+
+   // 1st value types the column
+
+   if ( !_bTyped ) {
+      _def._type = _ColType( f._type );
+      _bTyped    = true;
+   }
+   switch( _def._type ) {
+      case rtCol_int64:
+         switch( f._type ) {
+            case rtFld_int8:     i64 = v._i8;  break;
+            case rtFld_int64:
+            case rtFld_unixTime: i64 = v._i64; break;
+            default:             i64 = (int64_t)::rtEdge_atof( f ); break;
+         }
+         return (u_int64_t)i64;
+      case rtCol_string:
+         if ( ( f._type == rtFld_string ) || ( f._type == rtFld_bytestream ) )
+            s.assign( b._data, b._dLen );
+         else {
+            sprintf( buf, "%.10g", ::rtEdge_atof( f ) );
+            s = buf;
+         }
+         if ( (it=_strs.find( s )) != _strs.end() )
+            return (*it).second;
+         rc       = _heap.size();
+         _heap   += s;
+         _heap   += '\0';
+         _strs[s] = rc;
+         return rc;
+      default:
+         break;
+   }
+   r64 = ::rtEdge_atof( f );
+   ::memcpy( &rc, &r64, sizeof( rc ) );
+   return rc;
 }
 
-Bool GLrpyDailyIdxVw::forth()
+
+////////////////////////////////////////////
+// Helpers
+////////////////////////////////////////////
+void TapeColumn::_Grow()
 {
-   u_int64_t off, nL;
-   Bool      bOK;
+   u_int64_t nb;
 
-   // Map to next _daySz chunk; Handle End of File
+   // Double; _nAlloc always multiple of 8 so set bitmap is whole bytes
 
-   off = offset() + siz();
-   nL  = _fileSz - off;
-   bOK = ( nL > 0 );
-   if ( bOK ) {
-      map( off, _daySz );
-      bOK = _Set();
+   nb       = _nAlloc / 8;
+   _nAlloc  = _nAlloc ? _nAlloc * 2 : 64*K;
+   _cells   = (u_int64_t *)::realloc( _cells, _nAlloc * sizeof( u_int64_t ) );
+   _set     = (u_char *)::realloc( _set, _nAlloc / 8 );
+   ::memset( _set+nb, 0, ( _nAlloc / 8 ) - nb );
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+//             c l a s s      T a p e C o l E x p o r t
+//
+/////////////////////////////////////////////////////////////////////////////
+
+static u_int64_t _fwrite8( FILE *fp, const void *data, size_t dLen )
+{
+   static char _pad[8] = { 0 };
+   size_t      nPad;
+
+   // Pad to 8 bytes so every column is aligned in the mapped view
+
+   nPad = ( 8 - ( dLen % 8 ) ) % 8;
+   if ( dLen )
+      ::fwrite( data, dLen, 1, fp );
+   if ( nPad )
+      ::fwrite( _pad, nPad, 1, fp );
+   return dLen + nPad;
+}
+
+////////////////////////////////////////////
+// Constructor / Destructor
+////////////////////////////////////////////
+TapeColExport::TapeColExport( TapeChannel &tape, 
+                              const char  *pFile,
+                              const char  *tStart,
+                              const char  *tEnd,
+                              const char  *pTkrs,
+                              const char  *pFlds ) :
+   _tape( tape ),
+   _file( pFile ),
+   _slice( (TapeSlice *)0 ),
+   _mdd( ::mddSub_Initialize() ),
+   _fl( ::mddFieldList_Alloc( K ) ),
+   _cols(),
+   _fidCol(),
+   _tkrRow(),
+   _tkrs(),
+   _upd(),
+   _lvc(),
+   _nRow( 0 ),
+   _t0( 0.0 ),
+   _t1( 0.0 )
+{
+   FieldMap          &sdb = tape._schema;
+   FieldMap::iterator it;
+   TapeColumn        *col;
+   const char        *p0, *p1;
+   string             s;
+   char               buf[K];
+   size_t             i;
+   int                fid;
+
+   ::mddWire_SetProtocol( _mdd, mddProto_Binary );
+
+   // 1) Time range, FIDs : tStart|tEnd|tInterval|FIDs via TapeSlice
+
+   p0  = tStart ? tStart : tEnd ? tEnd : "00:00:00";
+   p1  = tEnd   ? tEnd   : p0;
+   s   = p0;
+   s  += t_SEP;
+   s  += p1;
+   s  += t_SEP;
+   s  += "1";
+   s  += t_SEP;
+   s  += pFlds;
+   _slice = new TapeSlice( tape, s.data() );
+   if ( !tStart ) {
+      _slice->_t0  = _zT;
+      _slice->_td0 = Logger::Time2dbl( _zT );
    }
-   return bOK;
+   if ( !tEnd ) {
+      _slice->_t1  = _eT;
+      _slice->_td1 = Logger::Time2dbl( _eT );
+   }
+
+   /*
+    * 2) Columns : Time, Ticker, then 1 per FID; 1st value types FID column
+    *    FID <= 0 or already have it : Skip; _fidCol[] indexed by FID
+    */
+   _cols.push_back( new TapeColumn( "Time",   0, rtCol_time,  true ) );
+   _cols.push_back( new TapeColumn( "Ticker", 0, rtCol_tkrID, true ) );
+   FIDs &fids = _slice->_fids;
+   for ( i=0; i<fids.size(); i++ ) {
+      fid = fids[i];
+      if ( fid <= 0 )
+         continue; // for-i
+      if ( ( fid < (int)_fidCol.size() ) && _fidCol[fid] )
+         continue; // for-i
+      sprintf( buf, "FID_%d", fid );
+      if ( (it=sdb.find( fid )) != sdb.end() )
+         safe_strcpy( buf, (*it).second._name );
+      col = new TapeColumn( buf, fid, rtCol_double, false );
+      if ( fid >= (int)_fidCol.size() )
+         _fidCol.resize( fid+1, 0 );
+      _fidCol[fid] = (int)_cols.size();
+      _cols.push_back( col );
+   }
+   _upd.resize( _cols.size(), 0 );
+
+   // 3) Tickers
+
+   _SelectTickers( pTkrs );
 }
 
-Bool GLrpyDailyIdxVw::_Set()
+TapeColExport::~TapeColExport()
 {
-   char *cp;
+   size_t i;
 
-   // Pre-condition
+   for ( i=0; i<_cols.size(); delete _cols[i++] );
+   _cols.clear();
+   if ( _slice )
+      delete _slice;
+   ::mddFieldList_Free( _fl );
+   ::mddSub_Destroy( _mdd );
+}
 
-   if ( !isValid() )
-      return false;
 
-   // Sentinel
+////////////////////////////////////////////
+// Operations
+////////////////////////////////////////////
+u_int64_t TapeColExport::Run()
+{
+   TapeHeader    &h = _tape.hdr();
+   GLrecTapeMsg  *msg;
+   struct timeval tv;
+   char          *bp, *cp;
+   mddBuf         m;
+   u_int64_t      off, sz;
+   double         dt;
+   int           *tkrRow, ix, nt, mSz;
 
-   cp  = data();
-   cp += _off;
-   _ss = (Sentinel *)cp;
-   cp += _hdr._sSz();
+   // Pre-condition(s)
 
-   // Tape Index
+   if ( _cols.size() <= 2 ) {
+      _tape._err = "No valid fields";
+      return 0;
+   }
 
-   _tapeIdxDb = (u_int64_t *)cp;
-   cp        += ( _hdr._numSecIdxT() * _iSz );
-   return isValid();
+   // 1) Start offset; Front to back
+
+   _tape._vwHdr->advise( mmap_sequential );
+   bp  = _tape._vwHdr->data();
+   sz  = _tape._vwHdr->siz();
+   off = _slice->_t0.tv_sec ? _tape._tapeOffset( _slice->_t0 ) : h._hdrSiz();
+   nt     = (int)_tkrRow.size();
+   tkrRow = _tkrRow.data();
+
+   // 2) Tape is time-ordered : Stop once past tEnd
+
+   for ( ; off<sz; off += msg->_msgLen ) {
+      cp  = bp+off;
+      msg = (GLrecTapeMsg *)cp;
+      if ( !msg->_msgLen )
+         break; // for-off
+      tv.tv_sec  = msg->_tv_sec;
+      tv.tv_usec = msg->_tv_usec;
+      dt         = Logger::Time2dbl( tv );
+      if ( dt > _slice->_td1 )
+         break; // for-off
+      ix = (int)msg->_dbIdx;
+      if ( ( dt < _slice->_td0 ) || !InRange( 0, ix, nt-1 ) )
+         continue; // for-off
+      if ( tkrRow[ix] == -2 )
+         continue; // for-off
+      mSz     = msg->_bLast4 ? _mSz4 : _mSz8;
+      m._data = cp + mSz;
+      m._dLen = msg->_msgLen - mSz;
+      if ( _tape._ParseFieldList( _mdd, _fl, m ) )
+         _AddRow( *msg, dt, _fl );
+   }
+   return _Write() ? _nRow : 0;
+}
+
+
+////////////////////////////////////////////
+// Helpers
+////////////////////////////////////////////
+void TapeColExport::_SelectTickers( const char *pTkrs )
+{
+   TapeRecDb  &tdb = _tape._tdb;
+   TapeRecords sel;
+   string      s( pTkrs ? pTkrs : "" );
+   char       *ps, *tkr, *rp;
+   size_t      i;
+   bool        bAll;
+
+   /*
+    * _tkrRow[ StreamID ] : -2 = Not exported; -1 = No rows yet
+    */
+   ps   = (char *)s.data();
+   bAll = !s.length();
+   for ( tkr=::strtok_r( ps, ",", &rp ); tkr; tkr=::strtok_r( NULL, ",", &rp ) )
+      sel[string( tkr )] = 1;
+   _tkrRow.resize( tdb.size(), -2 );
+   for ( i=0; i<tdb.size(); i++ ) {
+      if ( !tdb[i] )
+         continue; // for-i
+      if ( bAll || ( sel.find( string( tdb[i]->_tkr() ) ) != sel.end() ) )
+         _tkrRow[i] = -1;
+   }
+}
+
+void TapeColExport::_AddRow( GLrecTapeMsg &msg, double dt, mddFieldList &fl )
+{
+   TapeColumn **cols;
+   TapeRecHdr  *rec;
+   rtColTicker  t;
+   rtFIELD     *fdb;
+   u_int64_t   *lvc, ut;
+   u_char      *upd;
+   int         *fidCol;
+   size_t       c, nc;
+   int          i, ix, row, fid, nFid;
+
+   // 1) 1st row for this ticker : Add to ticker table and LVC
+
+   nc = _cols.size();
+   ix = (int)msg._dbIdx;
+   if ( (row=_tkrRow[ix]) < 0 ) {
+      rec = _tape._tdb[ix];
+      ::memset( &t, 0, sizeof( t ) );
+      t._StreamID = ix;
+      safe_strcpy( t._svc, rec->_svc() );
+      safe_strcpy( t._tkr, rec->_tkr() );
+      row         = (int)_tkrs.size();
+      _tkrRow[ix] = row;
+      _tkrs.push_back( t );
+      _lvc.resize( _lvc.size() + nc, 0 );
+   }
+
+   // 2) Update LVC from this message; Raw arrays in per-row path
+
+   cols   = _cols.data();
+   lvc    = _lvc.data() + ( row*nc );
+   upd    = _upd.data();
+   fidCol = _fidCol.data();
+   nFid   = (int)_fidCol.size();
+   fdb    = (rtFIELD *)fl._flds;
+   ::memset( upd, 0, nc );
+   for ( i=0; i<fl._nFld; i++ ) {
+      fid = (int)fdb[i]._fid;
+      if ( !InRange( 0, fid, nFid-1 ) || !(c=fidCol[fid]) )
+         continue; // for-i
+      lvc[c] = cols[c]->Cell( fdb[i] );
+      upd[c] = 1;
+   }
+
+   // 3) Time, Ticker, then forward-filled fields
+
+   ::memcpy( &ut, &dt, sizeof( ut ) );
+   cols[0]->Add( ut, true );
+   cols[1]->Add( (u_int64_t)row, true );
+   for ( c=2; c<nc; c++ )
+      cols[c]->Add( lvc[c], upd[c] != 0 );
+   _tkrs[row]._nRow += 1;
+   _t0    = _nRow ? _t0 : dt;
+   _t1    = dt;
+   _nRow += 1;
+}
+
+bool TapeColExport::_Write()
+{
+   rtColFooter ftr;
+   FILE       *fp;
+   u_int64_t   off;
+   size_t      i, nc;
+   bool        bOK;
+
+   // Pre-condition(s)
+
+   if ( !(fp=::fopen( _file.data(), "wb" )) ) {
+      _tape._err  = "Can not open ";
+      _tape._err += _file;
+      return false;
+   }
+
+   // 1) Columns : Cells, Set bitmap, String heap
+
+   nc  = _cols.size();
+   off = 0;
+   for ( i=0; i<nc; i++ ) {
+      TapeColumn &col = *_cols[i];
+      rtColumn   &def = col._def;
+
+      def._off    = off;
+      off        += _fwrite8( fp, col._cells, col._nRow * sizeof( u_int64_t ) );
+      def._setOff = off;
+      off        += _fwrite8( fp, col._set, ( col._nRow+7 ) / 8 );
+      if ( def._type == rtCol_string ) {
+         def._heapOff = off;
+         def._heapLen = col._heap.size();
+         off         += _fwrite8( fp, col._heap.data(), col._heap.size() );
+      }
+   }
+
+   // 2) Ticker table, Column directory, Footer
+
+   ::memset( &ftr, 0, sizeof( ftr ) );
+   safe_strcpy( ftr._signature, COL_EXP_SIG );
+   ftr._tkrOff = off;
+   off        += _fwrite8( fp, _tkrs.data(), _tkrs.size() * sizeof( rtColTicker ) );
+   ftr._colOff = off;
+   for ( i=0; i<nc; i++ )
+      off += _fwrite8( fp, &_cols[i]->_def, sizeof( rtColumn ) );
+   ftr._nRow   = _nRow;
+   ftr._nCol   = (int)nc;
+   ftr._nTkr   = (int)_tkrs.size();
+   ftr._t0     = _t0;
+   ftr._t1     = _t1;
+   ::fwrite( &ftr, sizeof( ftr ), 1, fp );
+   bOK = !::ferror( fp );
+   bOK = ( ::fclose( fp ) == 0 ) && bOK;
+   if ( !bOK ) {
+      _tape._err  = "Can not write ";
+      _tape._err += _file;
+   }
+   return bOK;
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+//               c l a s s      T a p e P u m p J o b
+//
+/////////////////////////////////////////////////////////////////////////////
+
+static size_t _blkSz  = 1024;  // Msgs per TapeMsgBlk
+static size_t _maxBlk = 16;    // Blocks queued per job before waiting
+
+////////////////////////////////////////////
+// Constructor / Destructor
+////////////////////////////////////////////
+TapePumpJob::TapePumpJob( TapeChannel &tape, 
+                          u_int64_t    beg, 
+                          u_int64_t    end,
+                          bool         bOrdered ) :
+   _tape( tape ),
+   _mdd( ::mddSub_Initialize() ),
+   _fl( ::mddFieldList_Alloc( K ) ),
+   _beg( beg ),
+   _end( end ),
+   _bOrdered( bOrdered ),
+   _thr( (Thread *)0 ),
+   _mtx(),
+   _blks(),
+   _bDone( false ),
+   _nMsg( 0 ),
+   _last( (GLrecTapeMsg *)0 )
+{
+   ::mddWire_SetProtocol( _mdd, mddProto_Binary );
+}
+
+TapePumpJob::~TapePumpJob()
+{
+   size_t i;
+
+   Join();
+   for ( i=0; i<_blks.size(); delete _blks[i++] );
+   _blks.clear();
+   ::mddFieldList_Free( _fl );
+   ::mddSub_Destroy( _mdd );
+}
+
+
+////////////////////////////////////////////
+// Access
+////////////////////////////////////////////
+bool TapePumpJob::IsDone()
+{
+   return _bDone;
+}
+
+TapeMsgBlk *TapePumpJob::Pop()
+{
+   Locker      lck( _mtx );
+   TapeMsgBlk *blk;
+
+   if ( !_blks.size() )
+      return (TapeMsgBlk *)0;
+   blk = _blks[0];
+   _blks.erase( _blks.begin() );
+   return blk;
+}
+
+
+////////////////////////////////////////////
+// Operations
+////////////////////////////////////////////
+void TapePumpJob::Start()
+{
+   if ( !_thr )
+      _thr = new Thread( TapePumpJob::_Run, this, true );
+}
+
+void TapePumpJob::Join()
+{
+   if ( _thr ) {
+      _thr->Stop();
+      delete _thr;
+   }
+   _thr = (Thread *)0;
+}
+
+void TapePumpJob::Run()
+{
+   TapeChannel  &t = _tape;
+   TapePrefetch *pf;
+   TapeMsgBlk   *blk;
+   GLrecTapeMsg *msg;
+   rtEdgeData    d;
+   char         *bp, *cp;
+   mddBuf        m;
+   u_int64_t     off;
+   bool          bPmp, bVec;
+   int           i, mSz;
+
+   /*
+    * Unordered : Dispatch from here
+    * Ordered   : Copy fields into blocks for channel thread
+    */
+   bp   = t._vwHdr->data();
+   blk  = (TapeMsgBlk *)0;
+   bPmp = true;
+   pf   = (TapePrefetch *)0;
+   if ( t._chan._tapePrefetch ) {
+      pf = new TapePrefetch( *t._vwHdr, _beg, _end, t._chan._tapePrefetch );
+      pf->Start();
+   }
+   for ( off=_beg; bPmp && t._bRun && off<_end; off+=msg->_msgLen ) {
+      if ( pf )
+         pf->Reader( off );
+      cp      = bp+off;
+      msg     = (GLrecTapeMsg *)cp;
+      if ( !msg->_msgLen )
+         break; // for-off
+      mSz     = msg->_bLast4 ? _mSz4 : _mSz8;
+      m._data = cp + mSz;
+      m._dLen = msg->_msgLen - mSz;
+      _last   = msg;
+      if ( !t._ParseOneMsg( *msg, m, false, bPmp, _mdd, _fl, d ) )
+         continue; // for-off
+      if ( !_bOrdered ) {
+         _nMsg += t._DispatchOne( d );
+         continue; // for-off
+      }
+      /*
+       * Vector fields live in our mddWire_Context : Re-parse on delivery
+       */
+      blk  = blk ? blk : new TapeMsgBlk();
+      for ( i=0,bVec=false; !bVec && i<d._nFld; i++ )
+         bVec = ( d._flds[i]._type == rtFld_vector );
+      blk->_fOff.push_back( bVec ? -1 : (int)blk->_flds.size() );
+      if ( !bVec )
+         blk->_flds.insert( blk->_flds.end(), d._flds, d._flds+d._nFld );
+      d._flds = (rtFIELD *)0;
+      blk->_msgs.push_back( d );
+      _nMsg += 1;
+      if ( blk->_msgs.size() >= _blkSz ) {
+         _Push( blk );
+         blk = (TapeMsgBlk *)0;
+      }
+   }
+   if ( blk )
+      _Push( blk );
+   if ( pf )
+      delete pf;
+   _bDone = true;
+}
+
+void TapePumpJob::_Push( TapeMsgBlk *blk )
+{
+   size_t nb;
+
+   // Bounded : Wait for channel thread to catch up
+
+   for ( nb=_maxBlk; _tape._bRun && ( nb >= _maxBlk ); ) {
+      {
+         Locker lck( _mtx );
+
+         nb = _blks.size();
+         if ( nb < _maxBlk ) {
+            _blks.push_back( blk );
+            return;
+         }
+      }
+      ::rtEdge_Sleep( 0.001 );
+   }
+   Locker lck( _mtx );
+
+   _blks.push_back( blk );
+}
+
+
+////////////////////////////////////////////
+// Class-wide
+////////////////////////////////////////////
+void TapePumpJob::_Run( void *arg )
+{
+   TapePumpJob *job;
+
+   job = (TapePumpJob *)arg;
+   job->Run();
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+//              c l a s s      T a p e P r e f e t c h
+//
+/////////////////////////////////////////////////////////////////////////////
+
+static u_int64_t _pfChunk = 1024*1024; // Bytes touched per pass
+
+////////////////////////////////////////////
+// Constructor / Destructor
+////////////////////////////////////////////
+TapePrefetch::TapePrefetch( GLmmap   &vw, 
+                            u_int64_t beg, 
+                            u_int64_t end,
+                            u_int64_t ahead ) :
+   _vw( vw ),
+   _end( end ),
+   _ahead( ahead ),
+   _done( beg ),
+   _thr( (Thread *)0 ),
+   _rdOff( beg ),
+   _bRun( false ),
+   _nPage( 0 )
+{
+}
+
+TapePrefetch::~TapePrefetch()
+{
+   Stop();
+}
+
+
+////////////////////////////////////////////
+// Operations
+////////////////////////////////////////////
+void TapePrefetch::Reader( u_int64_t off )
+{
+   _rdOff = off;
+}
+
+void TapePrefetch::Start()
+{
+   if ( !_thr ) {
+      _bRun = true;
+      _thr  = new Thread( TapePrefetch::_Run, this, true );
+   }
+}
+
+void TapePrefetch::Stop()
+{
+   _bRun = false;
+   if ( _thr ) {
+      _thr->Stop();
+      delete _thr;
+   }
+   _thr = (Thread *)0;
+}
+
+void TapePrefetch::Run()
+{
+   u_int64_t rd, lim, sz;
+
+   // Stay _ahead bytes in front of reader; Idle once there
+
+   while ( _bRun && ( _done < _end ) ) {
+      rd    = _rdOff;
+      _done = gmax( _done, rd );
+      lim   = gmin( rd+_ahead, _end );
+      if ( _done >= lim ) {
+         ::rtEdge_Sleep( 0.0005 );
+         continue; // while
+      }
+      sz      = gmin( _pfChunk, lim-_done );
+      _nPage += _vw.touch( _done, sz );
+      _done  += sz;
+   }
+}
+
+
+////////////////////////////////////////////
+// Class-wide
+////////////////////////////////////////////
+void TapePrefetch::_Run( void *arg )
+{
+   TapePrefetch *pf;
+
+   pf = (TapePrefetch *)arg;
+   pf->Run();
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+//                c l a s s      T a p e M e r g e
+//
+/////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////
+// Constructor / Destructor
+////////////////////////////////////////////
+TapeMerge::TapeMerge( TapeChannel &tape ) :
+   _tape( tape ),
+   _heap()
+{
+   TapeChannels &kids = _tape._kids;
+   size_t        i;
+
+   // Kids share our slice : One time window, sample clock and bar set
+
+   for ( i=0; i<kids.size(); kids[i]->_slice = _tape._slice, i++ );
+}
+
+TapeMerge::~TapeMerge()
+{
+   TapeChannels &kids = _tape._kids;
+   size_t        i;
+
+   for ( i=0; i<kids.size(); kids[i]->_slice = (TapeSlice *)0, i++ );
+}
+
+
+////////////////////////////////////////////
+// Operations
+////////////////////////////////////////////
+int TapeMerge::Run()
+{
+   TapeChannels &kids = _tape._kids;
+   TapeChannel  *t;
+   GLrecTapeMsg *msg;
+   mddBuf        m;
+   size_t        i;
+   bool          bPmp;
+   int           n, mSz;
+
+   // 1) One source per tape, each w/ own mmap and start offset; Heapify
+
+   _tape._PumpDead();
+   _Add( _tape, 0 );
+   for ( i=0; i<kids.size(); _Add( *kids[i], (int)i+1 ), i++ );
+   for ( i=_heap.size()/2; i>0; _SiftDown( --i ) );
+
+   // 2) Pump earliest msg; Advance its tape; Drop at EOF or slice end
+
+   for ( n=0; _tape._bRun && _heap.size(); _SiftDown( 0 ) ) {
+      TapeMergeSrc &s = _heap[0];
+
+      t       = s._tape;
+      msg     = s._msg;
+      mSz     = msg->_bLast4 ? _mSz4 : _mSz8;
+      m._data = (char *)msg + mSz;
+      m._dLen = msg->_msgLen - mSz;
+      bPmp    = true;
+      n      += t->_PumpOneMsg( *msg, m, false, bPmp );
+      s._off += msg->_msgLen;
+      if ( t->_pf )
+         t->_pf->Reader( s._off );
+      if ( !bPmp || !_Load( s ) ) {
+         _heap[0] = _heap.back();
+         _heap.pop_back();
+      }
+   }
+
+   // 3) Done : 1 streamDone for all tapes
+
+   for ( i=0; i<kids.size(); kids[i]->_PrefetchStop(), i++ );
+   _tape._PumpComplete( (GLrecTapeMsg *)0, 0 );
+   return n;
+}
+
+
+////////////////////////////////////////////
+// Helpers
+////////////////////////////////////////////
+void TapeMerge::_Add( TapeChannel &t, int src )
+{
+   TapeMergeSrc s;
+   u_int64_t    off;
+
+   // Pre-condition : Subscribe()'ed, but none of them on this tape
+
+   if ( _tape._nSub && !t._wl.size() )
+      return;
+
+   // Sequential from slice start
+
+   off = t.hdr()._hdrSiz();
+   if ( t._slice && t._slice->_t0.tv_sec )
+      off = t._tapeOffset( t._slice->_t0 );
+   t._vwHdr->advise( mmap_sequential );
+   t._PrefetchStart( off );
+   s._tape = &t;
+   s._msg  = (GLrecTapeMsg *)0;
+   s._off  = off;
+   s._end  = t._vwHdr->siz();
+   s._src  = src;
+   if ( _Load( s ) )
+      _heap.push_back( s );
+}
+
+bool TapeMerge::_Load( TapeMergeSrc &s )
+{
+   if ( s._off >= s._end )
+      return false;
+   s._msg = (GLrecTapeMsg *)( s._tape->_vwHdr->data() + s._off );
+   return( s._msg->_msgLen != 0 );
+}
+
+bool TapeMerge::_Less( TapeMergeSrc &a, TapeMergeSrc &b )
+{
+   GLrecTapeMsg &ma = *a._msg;
+   GLrecTapeMsg &mb = *b._msg;
+
+   // Msg time; Tie goes to lower tape in list
+
+   if ( ma._tv_sec != mb._tv_sec )
+      return( ma._tv_sec < mb._tv_sec );
+   if ( ma._tv_usec != mb._tv_usec )
+      return( ma._tv_usec < mb._tv_usec );
+   return( a._src < b._src );
+}
+
+void TapeMerge::_SiftDown( size_t i )
+{
+   TapeMergeSrc tmp;
+   size_t       nh, l, r, lo;
+
+   nh = _heap.size();
+   for ( ; (l=2*i+1) < nh; i=lo ) {
+      r  = l+1;
+      lo = ( ( r < nh ) && _Less( _heap[r], _heap[l] ) ) ? r : l;
+      if ( !_Less( _heap[lo], _heap[i] ) )
+         break; // for-i
+      tmp       = _heap[i];
+      _heap[i]  = _heap[lo];
+      _heap[lo] = tmp;
+   }
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+//            c l a s s       G L r p y D a i l y I d x V w
+//
+/////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////
+// Constructor / Destructor
+////////////////////////////////////////////
+GLrpyDailyIdxVw::GLrpyDailyIdxVw( TapeHeader &hdr, char *pf ) :
+   GLmmap( pf, (char *)0, 0, 0 ),
+   _hdr( hdr ),
+   _off( 0 ),
+   _daySz( hdr._DailyIdxSize() ),
+   _fileSz( 0 ),
+   _ss( (Sentinel *)0 ),
+   _tapeIdxDb( (u_int64_t *)0 )
+{
+   _fileSz = siz();
+   _Set();
+}
+
+GLrpyDailyIdxVw::~GLrpyDailyIdxVw()
+{
+}
+
+
+////////////////////////////////////////////
+// Access
+////////////////////////////////////////////
+Sentinel &GLrpyDailyIdxVw::sentinel()
+{
+   return *_ss;
+}
+
+u_int64_t *GLrpyDailyIdxVw::tapeIdxDb()
+{
+   return _tapeIdxDb;
+}
+
+Bool GLrpyDailyIdxVw::forth()
+{
+   u_int64_t off, nL;
+   Bool      bOK;
+
+   // Map to next _daySz chunk; Handle End of File
+
+   off = offset() + siz();
+   nL  = _fileSz - off;
+   bOK = ( nL > 0 );
+   if ( bOK ) {
+      map( off, _daySz );
+      bOK = _Set();
+   }
+   return bOK;
+}
+
+u_int64_t *GLrpyDailyIdxVw::Find( time_t tDay )
+{
+   u_int64_t off;
+
+   // Pre-condition(s)
+
+   if ( !_daySz )
+      return (u_int64_t *)0;
+
+   // Current day?  Else map each _daySz chunk in turn
+
+   if ( _ss && ( TapeChannel::_DayStart( _ss->_tStart ) == tDay ) )
+      return _tapeIdxDb;
+   for ( off=0; off+_daySz<=_fileSz; off+=_daySz ) {
+      map( off, _daySz );
+      if ( !_Set() )
+         break; // for-off
+      if ( TapeChannel::_DayStart( _ss->_tStart ) == tDay )
+         return _tapeIdxDb;
+   }
+   _ss        = (Sentinel *)0;
+   _tapeIdxDb = (u_int64_t *)0;
+   return _tapeIdxDb;
+}
+
+Bool GLrpyDailyIdxVw::_Set()
+{
+   char *cp;
+
+   // Pre-condition
+
+   if ( !isValid() )
+      return false;
+
+   // Sentinel
+
+   cp  = data();
+   cp += _off;
+   _ss = (Sentinel *)cp;
+   cp += _hdr._sSz();
+
+   // Tape Index
+
+   _tapeIdxDb = (u_int64_t *)cp;
+   cp        += ( _hdr._numSecIdxT() * _iSz );
+   return isValid();
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+//            c l a s s       G L r p y T k r I d x V w
+//
+/////////////////////////////////////////////////////////////////////////////
+
+static u_int64_t _tiSz = sizeof( GLrpyTkrIdxHdr );
+
+////////////////////////////////////////////
+// Constructor / Destructor
+////////////////////////////////////////////
+GLrpyTkrIdxVw::GLrpyTkrIdxVw( char *pf ) :
+   GLmmap( pf, (char *)0, 0, ~(u_int64_t)0 ),  // Whole file
+   _ih( (GLrpyTkrIdxHdr *)0 ),
+   _beg( (u_int64_t *)0 ),
+   _offs( (u_int64_t *)0 )
+{
+}
+
+GLrpyTkrIdxVw::~GLrpyTkrIdxVw()
+{
+}
+
+
+////////////////////////////////////////////
+// Access / Operations
+////////////////////////////////////////////
+u_int64_t GLrpyTkrIdxVw::curLoc()
+{
+   return _ih ? _ih->_curLoc : 0;
+}
+
+Bool GLrpyTkrIdxVw::IsValid( TapeHeader &h )
+{
+   GLrpyTkrIdxHdr *ih;
+   u_int64_t       nr, fSz;
+
+   // Pre-condition(s)
+
+   if ( !isValid() || ( siz() < _tiSz ) )
+      return false;
+
+   /*
+    * Same tape, built at or before tape's _curLoc; Sized right
+    */
+   ih = (GLrpyTkrIdxHdr *)data();
+   if ( ::strcmp( ih->_signature, TKR_IDX_SIG ) )
+      return false;
+   if ( ( ih->_tCreate != h._tCreate() ) || ( ih->_hdrSiz != h._hdrSiz() ) )
+      return false;
+   if ( ( ih->_curLoc > h._curLoc() ) || ( ih->_numRec > h._numRec() ) )
+      return false;
+   nr  = ih->_numRec;
+   fSz = _tiSz + ( ( nr + 1 + ih->_numMsg ) * _iSz );
+   if ( siz() < fSz )
+      return false;
+   _ih   = ih;
+   _beg  = (u_int64_t *)( data() + _tiSz );
+   _offs = _beg + nr + 1;
+   return true;
+}
+
+u_int64_t *GLrpyTkrIdxVw::offsets( int ix, u_int64_t &nOff )
+{
+   nOff = 0;
+   if ( !_ih || !InRange( 0, ix, _ih->_numRec-1 ) )
+      return (u_int64_t *)0;
+   nOff = _beg[ix+1] - _beg[ix];
+   return _offs + _beg[ix];
+}
+
+
+////////////////////////////////////////////
+// Class-wide
+////////////////////////////////////////////
+Bool GLrpyTkrIdxVw::Build( TapeHeader &h, 
+                           char       *bp, 
+                           u_int64_t   loc, 
+                           const char *pf )
+{
+   GLrpyTkrIdxHdr *ih;
+   GLrecTapeMsg   *msg;
+   GLmmap         *vw;
+   Offsets         beg;
+   u_int64_t      *ib, *io, off, nm, hSz, fSz;
+   int             i, nr;
+
+   /*
+    * 2 forward passes thru tape up to loc : Count per ticker, then fill.
+    * Signature written last so a partial file is never valid.
+    */
+   nr  = h._numRec();
+   hSz = h._hdrSiz();
+   beg.resize( nr+1, 0 );
+   for ( off=hSz,nm=0; off<loc; off+=msg->_msgLen,nm++ ) {
+      msg = (GLrecTapeMsg *)( bp+off );
+      if ( !msg->_msgLen || ( msg->_dbIdx >= (u_int32_t)nr ) )
+         break; // for-off
+      beg[msg->_dbIdx+1] += 1;
+   }
+   loc = off;
+   for ( i=0; i<nr; beg[i+1] += beg[i], i++ );
+
+   // Sidecar file
+
+   fSz = _tiSz + ( ( nr + 1 + nm ) * _iSz );
+   vw  = new GLmmap( (char *)pf, fSz );
+   if ( !vw->isValid() ) {
+      delete vw;
+      return false;
+   }
+   ih = (GLrpyTkrIdxHdr *)vw->data();
+   ib = (u_int64_t *)( vw->data() + _tiSz );
+   io = ib + nr + 1;
+   ::memcpy( ib, &beg[0], ( nr+1 ) * _iSz );
+   for ( off=hSz; off<loc; off+=msg->_msgLen ) {
+      msg = (GLrecTapeMsg *)( bp+off );
+      io[beg[msg->_dbIdx]++] = off;
+   }
+   ih->_tCreate = h._tCreate();
+   ih->_hdrSiz  = hSz;
+   ih->_curLoc  = loc;
+   ih->_numMsg  = nm;
+   ih->_numRec  = nr;
+   ::strcpy( ih->_signature, TKR_IDX_SIG );
+   delete vw;
+   return true;
 }
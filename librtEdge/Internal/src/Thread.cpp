@@ -13,8 +13,9 @@
 *      7 SEP 2020 jcs  Build 44: SetName()
 *      8 JAN 2022 jcs  Build 51: bool _ready
 *     27 FEB 2024 jcs  Build 68: _affinity
+*     17 OCT 2026 jcs  Build 80: _bOnce
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <EDG_Internal.h>
 
@@ -33,6 +34,7 @@ using namespace RTEDGE_PRIVATE;
 Thread::Thread() :
    _fcn( (rtEdgeThreadFcn)0 ),
    _arg( (void *)0 ),
+   _bOnce( false ),
    _bRun( true ),
    _tid( (pthread_t)0 ),
    _hThr( (HANDLE)0 ),
@@ -43,9 +45,10 @@ Thread::Thread() :
    Start();
 }
 
-Thread::Thread( rtEdgeThreadFcn fcn, void *arg ) :
+Thread::Thread( rtEdgeThreadFcn fcn, void *arg, bool bOnce ) :
    _fcn( fcn ),
    _arg( arg ),
+   _bOnce( bOnce ),
    _bRun( true ),
    _tid( (pthread_t)0 ),
    _hThr( (HANDLE)0 ),
@@ -238,9 +241,11 @@ void *Thread::Run()
       _pump.Start();
    _ready = true;
 
-   // Check every 0.1 sec
+   // Check every 0.1 sec; One-shot calls _fcn once, then exits
 
-   if ( _fcn )
+   if ( _fcn && _bOnce )
+      (*_fcn)( _arg );
+   else if ( _fcn )
       for ( ; _bRun; (*_fcn)( _arg ) );
    else
       _pump.Run( 0.1 );
@@ -0,0 +1,262 @@
+/******************************************************************************
+*
+*  AllocPerf.cpp
+*     Heap allocations per message on the EdgChannel subscribe hot path
+*
+*  REVISION HISTORY:
+*     17 OCT 2026 jcs  Created.
+*
+*  (c) 1994-2026, Gatea Ltd.
+******************************************************************************/
+#include <EDG_Internal.h>
+#include <new>
+
+using namespace RTEDGE_PRIVATE;
+
+static volatile long _nAlloc = 0;
+static bool          _bCount = false;
+
+
+/////////////////////////////////////
+// Counting operator new / delete
+/////////////////////////////////////
+void *operator new( size_t sz )
+{
+   void *rtn;
+
+   if ( _bCount )
+      ATOMIC_INC( &_nAlloc );
+   if ( !(rtn=::malloc( sz ? sz : 1 )) )
+      throw std::bad_alloc();
+   return rtn;
+}
+
+void *operator new[]( size_t sz )
+{
+   return operator new( sz );
+}
+
+void operator delete( void *p ) noexcept
+{
+   ::free( p );
+}
+
+void operator delete[]( void *p ) noexcept
+{
+   ::free( p );
+}
+
+void operator delete( void *p, size_t ) noexcept
+{
+   ::free( p );
+}
+
+void operator delete[]( void *p, size_t ) noexcept
+{
+   ::free( p );
+}
+
+
+/////////////////////////////////////
+// Version
+/////////////////////////////////////
+const char *AllocPerfID()
+{
+   static std::string s;
+   const char   *sccsid;
+
+   // Once
+
+   if ( !s.length() ) {
+      char bp[K], *cp;
+
+      cp  = bp;
+      cp += sprintf( cp, "@(#)AllocPerf Build %s ", _MDD_LIB_BLD );
+      cp += sprintf( cp, "%s %s Gatea Ltd.\n", __DATE__, __TIME__ );
+      cp += sprintf( cp, "%s", ::rtEdge_Version() );
+      s   = bp;
+   }
+   sccsid = s.data();
+   return sccsid+4;
+}
+
+static void _OnData( rtEdge_Context, rtEdgeData )
+{
+}
+
+
+////////////////////////
+//
+//     A l l o c C h a n
+//
+////////////////////////
+class AllocChan : public EdgChannel
+{
+public:
+	AllocChan( rtEdgeAttr attr ) :
+	   EdgChannel( attr, (rtEdge_Context)0 )
+	{
+	   _proto = mddProto_MF;
+	   ::mddWire_SetProtocol( _mdd, _proto );
+	}
+
+	// Access
+
+	Buffer &in() { return _in; }
+
+	// Mutator
+
+	void Drain() { _OnRead(); }
+
+}; // class AllocChan
+
+
+////////////////////////////////
+// Main Functions
+////////////////////////////////
+static void RunIt( AllocChan &ch, int id, int nFld, int nMsg, int nItr )
+{
+   mddWire_Context pub;
+   mddBldBuf       bld;
+   mddFieldList    fl;
+   mddMsgHdr       h;
+   mddBuf          b;
+   std::string     msg;
+   rtFIELD        *fdb;
+   double          d0, tDrain;
+   long            n0, nA;
+   int             i, j, n;
+
+   // 1) Pre-built batch of MF updates
+
+   pub = ::mddPub_Initialize();
+   ::mddWire_SetProtocol( pub, mddProto_MF );
+   bld = ::mddBldBuf_Alloc( K );
+   fdb = new rtFIELD[nFld];
+   ::memset( fdb, 0, nFld * sizeof( rtFIELD ) );
+   for ( j=0; j<nFld; j++ ) {
+      fdb[j]._fid         = j+1;
+      fdb[j]._type        = rtFld_double;
+      fdb[j]._val._r64    = 100.0 + j;
+   }
+   fl._flds   = (mddField *)fdb;
+   fl._nFld   = nFld;
+   fl._nAlloc = nFld;
+   for ( i=0; i<nMsg; i++ ) {
+      ::memset( &h, 0, sizeof( h ) );
+      h._mt       = mddMt_update;
+      h._dt       = mddDt_FieldList;
+      h._iTag     = id;
+      h._svc._data = (char *)"BENCH";
+      h._svc._dLen = 5;
+      h._tkr._data = (char *)"TKR";
+      h._tkr._dLen = 3;
+      ::mddPub_AddFieldList( pub, fl );
+      b    = ::mddPub_BuildMsg( pub, h, &bld );
+      msg += std::string( b._data, b._dLen );
+   }
+
+   // 2) Push batch; Drain; Count allocations
+
+   tDrain = 0.0;
+   nA     = 0;
+   for ( n=0; n<nItr; n++ ) {
+      ch.in().Push( (char *)msg.data(), msg.length() );
+      n0      = _nAlloc;
+      _bCount = true;
+      d0      = ::rtEdge_TimeNs();
+      ch.Drain();
+      tDrain += ( ::rtEdge_TimeNs() - d0 );
+      _bCount = false;
+      nA     += ( _nAlloc - n0 );
+   }
+
+   // 3) Dump : NumMsg,NumFld,tDrain,MsgPerSec,AllocPerMsg
+
+   n = nMsg * nItr;
+   printf( "%d,%d,", nMsg, nFld );
+   printf( "%.3f,", 1000.0 * tDrain / nItr );
+   printf( "%.0f,", tDrain ? n / tDrain : 0.0 );
+   printf( "%.3f\n", n ? (double)nA / n : 0.0 );
+
+   // 4) Clean up
+
+   delete[] fdb;
+   ::mddBldBuf_Free( bld );
+   ::mddPub_Destroy( pub );
+}
+
+
+//////////////////////////
+// main()
+//////////////////////////
+int main( int argc, char **argv )
+{
+   std::string s;
+   rtEdgeAttr  attr;
+   AllocChan  *ch;
+   bool        aOK;
+   int         i, id, nFld, nMsg, nItr, lvl;
+
+   /////////////////////
+   // Quickie checks
+   /////////////////////
+   if ( argc > 1 && !::strcmp( argv[1], "--version" ) ) {
+      printf( "%s\n", AllocPerfID() );
+      return 0;
+   }
+   nFld = 10;
+   nMsg = 100;
+   nItr = 1000;
+   lvl  = 0;
+   if ( argc > 1 && !::strcmp( argv[1], "--config" ) ) {
+      s  = "Usage: %s \\ \n";
+      s += "       [ -f <Num fields per update> ] \\ \n";
+      s += "       [ -m <Num messages per read> ] \\ \n";
+      s += "       [ -i <Num reads> ] \\ \n";
+      s += "       [ -l <Log level; /dev/null> ] \\ \n";
+      printf( s.data(), argv[0] );
+      printf( "   Defaults:\n" );
+      printf( "      -f : %d\n", nFld );
+      printf( "      -m : %d\n", nMsg );
+      printf( "      -i : %d\n", nItr );
+      printf( "      -l : %d\n", lvl );
+      return 0;
+   }
+
+   /////////////////////
+   // cmd-line args
+   /////////////////////
+   for ( i=1; i<argc; i++ ) {
+      aOK = ( i+1 < argc );
+      if ( !aOK )
+         break; // for-i
+      if ( !::strcmp( argv[i], "-f" ) )
+         nFld = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-m" ) )
+         nMsg = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-i" ) )
+         nItr = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-l" ) )
+         lvl = atoi( argv[++i] );
+   }
+   nFld = WithinRange( 1, nFld, K );
+   nMsg = WithinRange( 1, nMsg, K );
+   nItr = gmax( 1, nItr );
+
+   /////////////////////
+   // Unconnected channel; 1 subscribed record
+   /////////////////////
+   ::memset( &attr, 0, sizeof( attr ) );
+   attr._pSvrHosts = "localhost:9998";
+   attr._pUsername = "AllocPerf";
+   attr._dataCbk   = _OnData;
+   Socket::_log    = new Logger( "/dev/null", lvl );
+
+   ch              = new AllocChan( attr );
+   id              = ch->Subscribe( "BENCH", "TKR", (void *)0 );
+   printf( "NumMsg,NumFld,tDrain-ms,MsgPerSec,AllocPerMsg\n" );
+   RunIt( *ch, id, nFld, nMsg, nItr );
+   printf( "Done!!\n" );
+   return 0;
+} // main()
@@ -0,0 +1,171 @@
+/******************************************************************************
+*
+*  ConflatePerf.cpp
+*     EventPump conflation micro-benchmark : Dispatch rate vs. dirty set size
+*
+*  REVISION HISTORY:
+*     17 OCT 2026 jcs  Created.
+*
+*  (c) 1994-2026, Gatea Ltd.
+******************************************************************************/
+#include <EDG_Internal.h>
+
+using namespace RTEDGE_PRIVATE;
+
+
+/////////////////////////////////////
+// Version
+/////////////////////////////////////
+const char *ConflatePerfID()
+{
+   static std::string s;
+   const char   *sccsid;
+
+   // Once
+
+   if ( !s.length() ) {
+      char bp[K], *cp;
+
+      cp  = bp;
+      cp += sprintf( cp, "@(#)ConflatePerf Build %s ", _MDD_LIB_BLD );
+      cp += sprintf( cp, "%s %s Gatea Ltd.\n", __DATE__, __TIME__ );
+      cp += sprintf( cp, "%s", ::rtEdge_Version() );
+      s   = bp;
+   }
+   sccsid = s.data();
+   return sccsid+4;
+}
+
+typedef std::vector<Record *> Records;
+
+
+////////////////////////////////
+// Main Functions
+////////////////////////////////
+static void RunIt( int nDirty, int nFld, int nItr )
+{
+   EventPump    q;
+   Records      rdb;
+   Update       u;
+   rtFIELD     *fdb, fUpd[K];
+   mddFieldList fl;
+   char         tkr[K];
+   double       d0, d1, d2, tAdd, tDrain;
+   int          i, j, n, nUpd;
+
+   // 1) Records w/ initial image
+
+   fdb      = new rtFIELD[nFld];
+   fl._flds = (mddField *)fdb;
+   fl._nFld = nFld;
+   fl._nAlloc = nFld;
+   ::memset( fdb, 0, nFld * sizeof( rtFIELD ) );
+   for ( j=0; j<nFld; j++ ) {
+      fdb[j]._fid  = j+1;
+      fdb[j]._type = rtFld_double;
+   }
+   for ( i=0; i<nDirty; i++ ) {
+      sprintf( tkr, "TKR%07d", i );
+      rdb.push_back( new Record( "BENCH", tkr, i ) );
+      rdb[i]->Cache( fl );
+      rdb[i]->GetUpds( fUpd );
+   }
+
+   // 2) Dirty all; Drain all
+
+   tAdd   = 0.0;
+   tDrain = 0.0;
+   nUpd   = 0;
+   for ( n=0; n<nItr; n++ ) {
+      d0 = ::rtEdge_TimeNs();
+      for ( i=0; i<nDirty; i++ ) {
+         for ( j=0; j<nFld; fdb[j]._val._r64 = n+j, j++ );
+         ::memset( &u, 0, sizeof( u ) );
+         u._mt  = EVT_UPD;
+         u._rec = rdb[i];
+         u._rec->Cache( fl );
+         q.Add( u );
+      }
+      d1 = ::rtEdge_TimeNs();
+      for ( ; q.GetOneUpd( u ); nUpd++ )
+         u._rec->GetUpds( fUpd );
+      d2      = ::rtEdge_TimeNs();
+      tAdd   += ( d1 - d0 );
+      tDrain += ( d2 - d1 );
+   }
+
+   // 3) Dump : NumDirty,NumFld,tAdd,tDrain,UpdPerSec
+
+   printf( "%d,%d,", nDirty, nFld );
+   printf( "%.3f,%.3f,", 1000.0 * tAdd / nItr, 1000.0 * tDrain / nItr );
+   printf( "%.0f\n", tDrain ? nUpd / tDrain : 0.0 );
+
+   // 4) Clean up
+
+   for ( i=0; i<nDirty; delete rdb[i++] );
+   delete[] fdb;
+}
+
+
+//////////////////////////
+// main()
+//////////////////////////
+int main( int argc, char **argv )
+{
+   std::string s;
+   bool        aOK;
+   int         i, nMax, nFld, nItr, nDirty;
+
+   /////////////////////
+   // Quickie checks
+   /////////////////////
+   if ( argc > 1 && !::strcmp( argv[1], "--version" ) ) {
+      printf( "%s\n", ConflatePerfID() );
+      return 0;
+   }
+   nMax = 100000;
+   nFld = 10;
+   nItr = 5;
+   if ( argc > 1 && !::strcmp( argv[1], "--config" ) ) {
+      s  = "Usage: %s \\ \n";
+      s += "       [ -n <Max dirty set size> ] \\ \n";
+      s += "       [ -f <Num fields per update> ] \\ \n";
+      s += "       [ -i <Num iterations per size> ] \\ \n";
+      printf( s.data(), argv[0] );
+      printf( "   Defaults:\n" );
+      printf( "      -n : %d\n", nMax );
+      printf( "      -f : %d\n", nFld );
+      printf( "      -i : %d\n", nItr );
+      return 0;
+   }
+
+   /////////////////////
+   // cmd-line args
+   /////////////////////
+   for ( i=1; i<argc; i++ ) {
+      aOK = ( i+1 < argc );
+      if ( !aOK )
+         break; // for-i
+      if ( !::strcmp( argv[i], "-n" ) )
+         nMax = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-f" ) )
+         nFld = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-i" ) )
+         nItr = atoi( argv[++i] );
+   }
+   nFld = WithinRange( 1, nFld, K );
+   nItr = gmax( 1, nItr );
+
+   /////////////////////
+   // Dirty set : 1K, 5K, 10K, 50K, ... nMax
+   /////////////////////
+   printf( "NumDirty,NumFld,tAdd-ms,tDrain-ms,DrainUpdPerSec\n" );
+   for ( nDirty=K; nDirty<nMax; nDirty*=10 ) {
+      RunIt( nDirty, nFld, nItr );
+      if ( 5*nDirty < nMax )
+         RunIt( 5*nDirty, nFld, nItr );
+   }
+   RunIt( nMax, nFld, nItr );
+   printf( "Done!!\n" );
+   return 0;
+} // main()
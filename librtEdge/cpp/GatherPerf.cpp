@@ -0,0 +1,273 @@
+/******************************************************************************
+*
+*  GatherPerf.cpp
+*     Publish rate / bytes copied : Normal vs. Circular vs. writev() buffer
+*
+*  REVISION HISTORY:
+*     17 OCT 2026 jcs  Created.
+*
+*  (c) 1994-2026, Gatea Ltd.
+******************************************************************************/
+#include <EDG_Internal.h>
+#include <sys/resource.h>
+
+using namespace RTEDGE_PRIVATE;
+
+static const char *_svc = "GATHER";
+
+
+/////////////////////////////////////
+// Version
+/////////////////////////////////////
+const char *GatherPerfID()
+{
+   static std::string s;
+   const char   *sccsid;
+
+   // Once
+
+   if ( !s.length() ) {
+      char bp[K], *cp;
+
+      cp  = bp;
+      cp += sprintf( cp, "@(#)GatherPerf Build %s ", _MDD_LIB_BLD );
+      cp += sprintf( cp, "%s %s Gatea Ltd.\n", __DATE__, __TIME__ );
+      cp += sprintf( cp, "%s", ::rtEdge_Version() );
+      s   = bp;
+   }
+   sccsid = s.data();
+   return sccsid+4;
+}
+
+
+////////////////////////////////
+//
+//       c l a s s   S i n k
+//
+////////////////////////////////
+class Sink
+{
+public:
+   int           _lFd;
+   int           _fd;
+   volatile long _nByte;
+
+   // Constructor / Destructor
+public:
+   Sink( int port ) :
+      _lFd( ::socket( AF_INET, SOCK_STREAM, 0 ) ),
+      _fd( 0 ),
+      _nByte( 0 )
+   {
+      struct sockaddr_in a;
+      int                val;
+
+      val = 1;
+      ::setsockopt( _lFd, SOL_SOCKET, SO_REUSEADDR, (char *)&val, sizeof( val ) );
+      ::memset( &a, 0, sizeof( a ) );
+      a.sin_family      = AF_INET;
+      a.sin_port        = htons( port );
+      a.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+      ::bind( _lFd, (struct sockaddr *)&a, sizeof( a ) );
+      ::listen( _lFd, 1 );
+   }
+
+   ~Sink()
+   {
+      if ( _fd > 0 )
+         CLOSE( _fd );
+      CLOSE( _lFd );
+   }
+
+   // Operations
+
+   /*
+    * Accept 1 publisher; Drain it
+    */
+   void Drain()
+   {
+      struct pollfd pfd;
+      char          buf[64*K];
+      int           nb;
+
+      pfd.fd     = _fd ? _fd : _lFd;
+      pfd.events = POLLIN;
+      if ( ::poll( &pfd, 1, 100 ) <= 0 )
+         return;
+      if ( !_fd ) {
+         _fd = ::accept( _lFd, (struct sockaddr *)0, (socklen_t *)0 );
+         _fd = gmax( _fd, 0 );
+         return;
+      }
+      if ( (nb=::recv( _fd, buf, sizeof( buf ), 0 )) > 0 )
+         ATOMIC_ADD( &_nByte, nb );
+   }
+
+}; // class Sink
+
+
+////////////////////////////////
+// Helpers
+////////////////////////////////
+static void _SinkThr( void *arg )
+{
+   Sink *s = (Sink *)arg;
+
+   s->Drain();
+}
+
+static double _CPU()
+{
+   struct rusage ru;
+   double        dc;
+
+   ::getrusage( RUSAGE_SELF, &ru );
+   dc  = ru.ru_utime.tv_sec + ( 0.000001 * ru.ru_utime.tv_usec );
+   dc += ru.ru_stime.tv_sec + ( 0.000001 * ru.ru_stime.tv_usec );
+   return dc;
+}
+
+
+////////////////////////////////
+// Main Functions
+////////////////////////////////
+static void RunIt( const char *ty, int port, int nMsg, int nFld, int bufIO )
+{
+   rtEdge_Context  pub;
+   rtEdgePubAttr   pa;
+   rtEdgeChanStats st;
+   rtEdgeData      d;
+   Thread_Context  thr;
+   Sink            sink( port );
+   vector<rtFIELD> flds( nFld );
+   char            hPub[K], tkr[K];
+   double          d0, dc, dRun;
+   long            b0;
+   int             i, n;
+
+   // 1) Sink
+
+   thr = ::OS_StartThread( _SinkThr, &sink );
+
+   // 2) Publisher : Normal, Circular or Gather
+
+   ::memset( &pa, 0, sizeof( pa ) );
+   ::memset( &st, 0, sizeof( st ) );
+   sprintf( hPub, "localhost:%d", port );
+   pa._pSvrHosts       = hPub;
+   pa._pPubName        = _svc;
+   pa._bCircularBuffer = !::strcmp( ty, "Circular" ) ? 1 : 0;
+   pub                 = ::rtEdge_PubInit( pa );
+   ::rtEdge_SetStats( pub, &st );
+   ::rtEdge_ioctl( pub, ioctl_binary, (void *)1 );
+   ::rtEdge_ioctl( pub, ioctl_setBufferedIO, (void *)&bufIO );
+   if ( !::strcmp( ty, "Gather" ) )
+      ::rtEdge_ioctl( pub, ioctl_gatherIO, (void *)1 );
+   ::rtEdge_PubStart( pub );
+   for ( i=0; i<50 && !sink._fd; i++, ::rtEdge_Sleep( 0.01 ) );
+   ::rtEdge_Sleep( 0.1 );
+
+   // 3) Publish as fast as we can; Wait for sink to drain
+
+   for ( i=0; i<nFld; i++ ) {
+      flds[i]._fid  = i+1;
+      flds[i]._type = rtFld_double;
+   }
+   ::memset( &d, 0, sizeof( d ) );
+   d._pSvc = _svc;
+   d._flds = flds.data();
+   d._nFld = nFld;
+   d._ty   = edg_update;
+   st._nByte = 0;
+   b0        = sink._nByte;
+   dc        = _CPU();
+   d0        = ::rtEdge_TimeNs();
+   for ( n=0; n<nMsg; n++ ) {
+      i       = n % 100;
+      sprintf( tkr, "TKR%03d", i );
+      flds[0]._val._r64 = 100.0 + ( 0.01 * n );
+      d._pTkr = tkr;
+      d._arg  = (void *)(size_t)(i+1);
+      ::rtEdge_Publish( pub, d );
+   }
+   dRun = ::rtEdge_TimeNs() - d0;
+   dc   = _CPU() - dc;
+   for ( i=0; i<500 && ( sink._nByte-b0 < (long)st._nByte ); i++ )
+      ::rtEdge_Sleep( 0.01 );
+
+   // 4) Dump : Buffer,NumMsg,NumByte,NumWrCall,NumCopy,CopyPerByte,MsgPerSec,CPU-ms
+
+   printf( "%s,%d,%ld,%ld,", ty, nMsg, st._nByte, st._nWrCall );
+   printf( "%ld,", st._nOutCopy );
+   printf( "%.3f,", st._nByte ? (double)st._nOutCopy / st._nByte : 0.0 );
+   printf( "%.0f,", dRun ? nMsg / dRun : 0.0 );
+   printf( "%.1f\n", 1000.0 * dc );
+   ::rtEdge_PubDestroy( pub );
+   ::OS_StopThread( thr );
+}
+
+
+//////////////////////////
+// main()
+//////////////////////////
+int main( int argc, char **argv )
+{
+   std::string s;
+   bool        aOK;
+   int         i, port, nMsg, nFld, bufIO;
+
+   /////////////////////
+   // Quickie checks
+   /////////////////////
+   if ( argc > 1 && !::strcmp( argv[1], "--version" ) ) {
+      printf( "%s\n", GatherPerfID() );
+      return 0;
+   }
+   port  = 21200;
+   nMsg  = 1000000;
+   nFld  = 10;
+   bufIO = 0;
+   if ( argc > 1 && !::strcmp( argv[1], "--config" ) ) {
+      s  = "Usage: %s \\ \n";
+      s += "       [ -p <Sink TCP port> ] \\ \n";
+      s += "       [ -n <Num messages> ] \\ \n";
+      s += "       [ -f <Num fields per message> ] \\ \n";
+      s += "       [ -b <ioctl_setBufferedIO bytes; 0 = write per msg> ] \\ \n";
+      printf( s.data(), argv[0] );
+      printf( "   Defaults:\n" );
+      printf( "      -p : %d\n", port );
+      printf( "      -n : %d\n", nMsg );
+      printf( "      -f : %d\n", nFld );
+      printf( "      -b : %d\n", bufIO );
+      return 0;
+   }
+
+   /////////////////////
+   // cmd-line args
+   /////////////////////
+   for ( i=1; i<argc; i++ ) {
+      aOK = ( i+1 < argc );
+      if ( !aOK )
+         break; // for-i
+      if ( !::strcmp( argv[i], "-p" ) )
+         port = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-n" ) )
+         nMsg = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-f" ) )
+         nFld = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-b" ) )
+         bufIO = atoi( argv[++i] );
+   }
+   nFld  = WithinRange( 1, nFld, K );
+   bufIO = gmax( 0, bufIO );
+
+   /////////////////////
+   // Normal, Circular, Gather
+   /////////////////////
+   printf( "Buffer,NumMsg,NumByte,NumWrCall,NumCopy,CopyPerByte,MsgPerSec,CPU-ms\n" );
+   RunIt( "Normal",   port,   nMsg, nFld, bufIO );
+   RunIt( "Circular", port+1, nMsg, nFld, bufIO );
+   RunIt( "Gather",   port+2, nMsg, nFld, bufIO );
+   printf( "Done!!\n" );
+   return 0;
+} // main()
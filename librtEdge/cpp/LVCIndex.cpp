@@ -0,0 +1,219 @@
+/******************************************************************************
+*
+*  LVCIndex.cpp
+*     Convert LVC_SIG_005 file to LVC_SIG_006 w/ on-disk hash index
+*
+*  REVISION HISTORY:
+*     17 OCT 2026 jcs  Created.
+*
+*  (c) 1994-2026, Gatea Ltd.
+******************************************************************************/
+#include <EDG_Internal.h>
+#include <EDG_GLlvcDb.h>
+
+using namespace RTEDGE_PRIVATE;
+
+
+/////////////////////////////////////
+// Version
+/////////////////////////////////////
+const char *LVCIndexID()
+{
+   static std::string s;
+   const char   *sccsid;
+
+   // Once
+
+   if ( !s.length() ) {
+      char bp[K], *cp;
+
+      cp  = bp;
+      cp += sprintf( cp, "@(#)LVCIndex Build %s ", _MDD_LIB_BLD );
+      cp += sprintf( cp, "%s %s Gatea Ltd.\n", __DATE__, __TIME__ );
+      cp += sprintf( cp, "%s", ::rtEdge_Version() );
+      s   = bp;
+   }
+   sccsid = s.data();
+   return sccsid+4;
+}
+
+typedef std::vector<std::string> Keys;
+
+
+////////////////////////////////
+// Main Functions
+////////////////////////////////
+static int Convert( char *src, char *dst, int xSlot, Keys &kdb )
+{
+   LVCDef       ld( src, false, 0 );
+   GLlvcDb     &lvc = ld.lvc();
+   LVCOffsets  &rdb = lvc.recOffs();
+   GLmmap      *out;
+   GLlvcDbHdr4 *h4;
+   GLlvcDbItem *rec;
+   LVCint      *sp;
+   char        *bp, *op;
+   u_int64_t    fSz;
+   int          i, nr, nFld, nSlot, sOff, oldOff, newOff, dOff, off, slot;
+
+   // Pre-condition
+
+   if ( !lvc.isValid() || !lvc.IsBinary() || lvc.slots() ) {
+      printf( "%s : Not a %s file\n", src, LVC_SIG_005 );
+      return 0;
+   }
+
+   // 1) Size : Slots >= xSlot * NumRec; Power of 2
+
+   bp     = lvc.data();
+   nr     = (int)rdb.size();
+   nFld   = lvc.db()._nFlds;
+   for ( nSlot=K; nSlot<xSlot*nr; nSlot<<=1 );
+   oldOff = sizeof( GLlvcDbHdr3 ) + ( nFld * sizeof( GLlvcFldDef ) );
+   sOff   = sizeof( GLlvcDbHdr4 ) + ( nFld * sizeof( GLlvcFldDef ) );
+   newOff = sOff + ( nSlot * sizeof( LVCint ) );
+   dOff   = newOff - oldOff;
+   fSz    = lvc.db()._fileSiz + dOff;
+
+   // 2) Header; Schema; Records shifted by dOff
+
+   out = new GLmmap( dst, fSz );
+   if ( !out->isValid() ) {
+      printf( "Can not create %s\n", dst );
+      delete out;
+      return 0;
+   }
+   op = out->data();
+   h4 = (GLlvcDbHdr4 *)op;
+   ::memcpy( op, bp, sizeof( GLlvcDbHdr3 ) );
+   ::memcpy( op+sizeof( GLlvcDbHdr4 ), lvc.fdb(), nFld * sizeof( GLlvcFldDef ) );
+   ::memcpy( op+newOff, bp+oldOff, lvc.db()._fileSiz - oldOff );
+   ::strcpy( h4->_signature, LVC_SIG_006 );
+   h4->_fileSiz  = fSz;
+   h4->_freeIdx += dOff;
+   h4->_hdrSiz   = sizeof( GLlvcDbHdr4 );
+
+   // 3) Index
+
+   GLlvcIdxHdr &ix = h4->_idx;
+
+   sp = (LVCint *)( op+sOff );
+   for ( i=0; i<nr; i++ ) {
+      off  = rdb[i] + dOff;
+      rec  = (GLlvcDbItem *)( op+off );
+      slot = GLlvcDb::FindSlot( op, sp, nSlot, (int)fSz, rec->_svc, rec->_tkr );
+      if ( slot != -1 )
+         sp[slot] = off;
+      kdb.push_back( std::string( rec->_svc ) + "|" + rec->_tkr );
+   }
+   ix._nSlot   = nSlot;
+   ix._slotOff = sOff;
+   ix._nRec    = nr;
+   ix._freeIdx = h4->_freeIdx;
+   delete out;
+   return nr;
+}
+
+static void OpenIt( char *file, Keys &kdb, int nLook )
+{
+   LVC_Context cxt;
+   LVCData     d;
+   std::string s;
+   double      d0, d1, d2;
+   size_t      ix;
+   int         i, nr;
+
+   // 1) Open : Record map built here for LVC_SIG_005
+
+   d0  = ::rtEdge_TimeNs();
+   cxt = ::LVC_Initialize( file );
+   d1  = ::rtEdge_TimeNs();
+
+   // 2) Lookups
+
+   for ( i=0; i<nLook; i++ ) {
+      ix = ( i * 7919 ) % kdb.size();
+      s  = kdb[ix];
+      ix = s.find( '|' );
+      s[ix] = '\0';
+      d  = ::LVC_Snapshot( cxt, s.data(), s.data()+ix+1 );
+      ::LVC_Free( &d );
+   }
+   d2 = ::rtEdge_TimeNs();
+   nr = (int)kdb.size();
+
+   // 3) Dump : File,NumRec,tOpen-ms,tLookup-us
+
+   printf( "%s,%d,", file, nr );
+   printf( "%.3f,", 1000.0 * ( d1-d0 ) );
+   printf( "%.3f\n", nLook ? 1.0E6 * ( d2-d1 ) / nLook : 0.0 );
+   ::LVC_Destroy( cxt );
+}
+
+
+//////////////////////////
+// main()
+//////////////////////////
+int main( int argc, char **argv )
+{
+   std::string s;
+   Keys        kdb;
+   const char *src, *dst;
+   bool        aOK;
+   int         i, xSlot, nLook;
+
+   /////////////////////
+   // Quickie checks
+   /////////////////////
+   if ( argc > 1 && !::strcmp( argv[1], "--version" ) ) {
+      printf( "%s\n", LVCIndexID() );
+      return 0;
+   }
+   src   = "./cache.lvc";
+   dst   = "./cache.idx.lvc";
+   xSlot = 2;
+   nLook = 10000;
+   if ( argc > 1 && !::strcmp( argv[1], "--config" ) ) {
+      s  = "Usage: %s \\ \n";
+      s += "       [ -db <Source LVC file; LVC_SIG_005> ] \\ \n";
+      s += "       [ -o  <Destination LVC file; LVC_SIG_006> ] \\ \n";
+      s += "       [ -x  <Index slots per record> ] \\ \n";
+      s += "       [ -n  <Num lookups to time> ] \\ \n";
+      printf( s.data(), argv[0] );
+      printf( "   Defaults:\n" );
+      printf( "      -db : %s\n", src );
+      printf( "      -o  : %s\n", dst );
+      printf( "      -x  : %d\n", xSlot );
+      printf( "      -n  : %d\n", nLook );
+      return 0;
+   }
+
+   /////////////////////
+   // cmd-line args
+   /////////////////////
+   for ( i=1; i<argc; i++ ) {
+      aOK = ( i+1 < argc );
+      if ( !aOK )
+         break; // for-i
+      if ( !::strcmp( argv[i], "-db" ) )
+         src = argv[++i];
+      else if ( !::strcmp( argv[i], "-o" ) )
+         dst = argv[++i];
+      else if ( !::strcmp( argv[i], "-x" ) )
+         xSlot = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-n" ) )
+         nLook = atoi( argv[++i] );
+   }
+   xSlot = WithinRange( 2, xSlot, 16 );
+
+   /////////////////////
+   // Convert; Time open + lookup on both
+   /////////////////////
+   if ( !Convert( (char *)src, (char *)dst, xSlot, kdb ) )
+      return 0;
+   printf( "File,NumRec,tOpen-ms,tLookup-us\n" );
+   OpenIt( (char *)src, kdb, nLook );
+   OpenIt( (char *)dst, kdb, nLook );
+   printf( "Done!!\n" );
+   return 0;
+} // main()
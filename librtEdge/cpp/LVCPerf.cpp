@@ -6,8 +6,9 @@
 *  REVISION HISTORY:
 *     27 JUN 2024 jcs  Created.
 *     24 JAN 2025 jcs  Build 75: swig
+*     17 OCT 2026 jcs  Build 80: -t : SnapAll() thread scaling; -a : Arena; -d : SnapDelta()
 *
-*  (c) 1994-2025, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <librtEdge.h>
 
@@ -303,6 +304,83 @@ static TestStat *RunIt( LVC &lvc, TestStat *st )
 
 } // RunIt()
 
+static void ScaleIt( LVC &lvc, int nThr, double &t1 )
+{
+   LVCAll la( lvc, lvc.GetSchema() );
+   double d0, d1, tLib;
+
+   // NumThreads,tSnap-C,tSnap-C#,NumTkr,Speedup
+
+   lvc.ClearFilter();
+   lvc.SetSnapThreads( nThr );
+   d0   = lvc.TimeNs();
+   lvc.ViewAll_safe( la );
+   d1   = lvc.TimeNs();
+   tLib = la.dSnap();
+   t1   = ( nThr == 1 ) ? tLib : t1;
+   printf( "%d,", nThr );
+   printf( "%d,", (int)( 1000.0 * tLib ) );
+   printf( "%d,", (int)( 1000.0 * ( d1 - d0 ) ) );
+   printf( "%d,", la.Size() );
+   printf( "%.2f\n", tLib ? t1 / tLib : 0.0 );
+}
+
+static void ArenaIt( LVC &lvc, bool bArena, int nItr )
+{
+   LVCAll la( lvc, lvc.GetSchema() );
+   double d0, d1, d2, tSnap, tFree;
+   int    i, nTkr;
+
+   // Alloc,tSnap-C#,tFree,NumTkr : Average of nItr SnapAll() / FreeAll()
+
+   lvc.ClearFilter();
+   lvc.SetSnapThreads( 1 );
+   lvc.SetArena( bArena );
+   tSnap = 0.0;
+   tFree = 0.0;
+   nTkr  = 0;
+   for ( i=0; i<nItr; i++ ) {
+      d0     = lvc.TimeNs();
+      lvc.ViewAll_safe( la );
+      d1     = lvc.TimeNs();
+      nTkr   = la.Size();
+      la.reset();
+      d2     = lvc.TimeNs();
+      tSnap += ( d1 - d0 );
+      tFree += ( d2 - d1 );
+   }
+   printf( "%s,", bArena ? "Arena" : "PerRecord" );
+   printf( "%.3f,", 1000.0 * tSnap / nItr );
+   printf( "%.3f,", 1000.0 * tFree / nItr );
+   printf( "%d\n", nTkr );
+   lvc.SetArena( false );
+}
+
+static void DeltaIt( LVC &lvc, int nPoll )
+{
+   LVCAll la( lvc, lvc.GetSchema() );
+   double d0, d1;
+   int    i;
+
+   // Poll,tSnap-C,tSnap-C#,NumTkr : 1st is SnapAll(); Rest SnapDelta()
+
+   lvc.ClearFilter();
+   for ( i=0; i<=nPoll; i++ ) {
+      d0 = lvc.TimeNs();
+      if ( i )
+         lvc.SnapDelta_safe( la );
+      else
+         lvc.SnapAll_safe( la );
+      d1 = lvc.TimeNs();
+      printf( "%d,", i );
+      printf( "%.3f,", 1000.0 * la.dSnap() );
+      printf( "%.3f,", 1000.0 * ( d1 - d0 ) );
+      printf( "%d\n", la.Size() );
+      if ( i < nPoll )
+         lvc.Sleep( 0.25 );
+   }
+}
+
 
 //////////////////////////
 // main()
@@ -313,7 +391,9 @@ int main( int argc, char **argv )
    TestCfg     cfg;
    bool        aOK;
    char       *tok;
+   double      t1;
    size_t      i, j, k;
+   int         n, nThr, nArena, nPoll;
 
    /////////////////////
    // Quickie checks
@@ -322,17 +402,26 @@ int main( int argc, char **argv )
       printf( "%s\n", LVCPerfID() );
       return 0;
    }
-   svr = "./cache.lvc";
+   svr  = "./cache.lvc";
+   nThr   = 1;
+   nArena = 0;
+   nPoll  = 0;
    if ( ( argc < 2 ) || !::strcmp( argv[1], "--config" ) ) {
       s  = "Usage: %s \\ \n";
       s += "       [ -db <LVC d/b file> ] \\ \n";
       s += "       [ -s  <CSV Service List> ] \\ \n";
       s += "       [ -f  <CSV Field ID List> ] \\ \n";
+      s += "       [ -t  <Max SnapAll() threads> ] \\ \n";
+      s += "       [ -a  <Num SnapAll() / FreeAll() per Arena test> ] \\ \n";
+      s += "       [ -d  <Num SnapDelta() polls every 250 ms> ] \\ \n";
       printf( s.data(), argv[0] );
       printf( "   Defaults:\n" );
       printf( "      -db : %s\n", svr.data() );
       printf( "      -s  : <empty>\n" );
       printf( "      -f  : <empty>\n" );
+      printf( "      -t  : %d\n", nThr );
+      printf( "      -a  : %d\n", nArena );
+      printf( "      -d  : %d\n", nPoll );
       return 0;
    }
 
@@ -353,6 +442,12 @@ int main( int argc, char **argv )
       }
       else if ( !::strcmp( argv[i], "-f" ) )
          cfg.flds = argv[++i];
+      else if ( !::strcmp( argv[i], "-t" ) )
+         nThr = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-a" ) )
+         nArena = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-d" ) )
+         nPoll = atoi( argv[++i] );
    }
    /*
     * 1) Create LVC; Get Field List from Schema
@@ -390,9 +485,28 @@ int main( int argc, char **argv )
       }
    }
    /*
-    * 3) Clean-up
+    * 3) Dump; SnapAll() thread scaling : 1, 2, 4, ... nThr; Arena; Delta
     */
    for ( i=0; i<sdb.size(); printf( sdb[i]->Dump().data() ), i++ );
+   if ( nThr > 1 ) {
+      printf( "NumThreads,tSnap-C,tSnap-C#,NumTkr,Speedup\n" );
+      t1 = 0.0;
+      for ( n=1; n<nThr; n*=2 )
+         ScaleIt( lvc, n, t1 );
+      ScaleIt( lvc, nThr, t1 );
+   }
+   if ( nArena > 0 ) {
+      printf( "Alloc,tSnap-C#,tFree,NumTkr\n" );
+      ArenaIt( lvc, false, nArena );
+      ArenaIt( lvc, true, nArena );
+   }
+   if ( nPoll > 0 ) {
+      printf( "Poll,tSnap-C,tSnap-C#,NumTkr\n" );
+      DeltaIt( lvc, nPoll );
+   }
+   /*
+    * 4) Clean-up
+    */
    for ( i=0; i<sdb.size(); delete sdb[i], i++ );
    sdb.clear();
    printf( "Done!!\n" );
@@ -0,0 +1,346 @@
+/******************************************************************************
+*
+*  LVCStress.cpp
+*     LVC concurrent read / write stress test : Mutex vs. Lock-free reads
+*
+*  REVISION HISTORY:
+*     17 OCT 2026 jcs  Created.
+*
+*  (c) 1994-2026, Gatea Ltd.
+******************************************************************************/
+#include <EDG_Internal.h>
+#include <EDG_GLlvcDb.h>
+#include <fcntl.h>
+
+using namespace RTEDGE_PRIVATE;
+
+
+/////////////////////////////////////
+// Version
+/////////////////////////////////////
+const char *LVCStressID()
+{
+   static std::string s;
+   const char   *sccsid;
+
+   // Once
+
+   if ( !s.length() ) {
+      char bp[K], *cp;
+
+      cp  = bp;
+      cp += sprintf( cp, "@(#)LVCStress Build %s ", _MDD_LIB_BLD );
+      cp += sprintf( cp, "%s %s Gatea Ltd.\n", __DATE__, __TIME__ );
+      cp += sprintf( cp, "%s", ::rtEdge_Version() );
+      s   = bp;
+   }
+   sccsid = s.data();
+   return sccsid+4;
+}
+
+// Collections
+
+typedef std::vector<GLlvcDbItem *> LiveRecs;
+typedef std::vector<char *>        Strings;
+typedef std::vector<Thread *>      Threads;
+
+
+/////////////////////////////////////
+//
+//    c l a s s   L V C W r i t e r
+//
+/////////////////////////////////////
+class LVCWriter
+{
+public:
+	LVCDef      _def;
+	GLmmap     *_map;
+	LiveRecs    _recs;
+	Strings     _svcs;
+	Strings     _tkrs;
+	int         _fd;
+	int         _nxt;
+	double      _k;
+	long        _nWrite;
+
+	// Constructor / Destructor
+public:
+	LVCWriter( char *file ) :
+	   _def( file, false, 0 ),
+	   _map( (GLmmap *)0 ),
+	   _fd( ::open( file, O_RDWR ) ),
+	   _nxt( 0 ),
+	   _k( 0.0 ),
+	   _nWrite( 0 )
+	{
+	   GLlvcDb         &lvc = _def.lvc();
+	   GLlvcDbItem     *rec;
+	   u_int64_t        len;
+	   int              i, off;
+
+	   /*
+	    * Stand-in for the LVC server : Our own RW mapping of the file
+	    */
+	   if ( !lvc.isValid() || ( _fd == -1 ) )
+	      return;
+	   len  = lvc.db()._fileSiz;
+	   _map = new GLmmap( _fd, len );
+	   if ( !_map->isValid() )
+	      return;
+	   for ( i=0; i<lvc.NumSlots(); i++ ) {
+	      if ( !(off=lvc.RecOffAt( i )) )
+	         continue; // for-i
+	      rec = (GLlvcDbItem *)( _map->data() + off );
+	      _recs.push_back( rec );
+	      _svcs.push_back( ::strdup( rec->_svc ) );
+	      _tkrs.push_back( ::strdup( rec->_tkr ) );
+	   }
+	}
+
+	~LVCWriter()
+	{
+	   size_t i;
+
+	   for ( i=0; i<_svcs.size(); ::free( _svcs[i++] ) );
+	   for ( i=0; i<_tkrs.size(); ::free( _tkrs[i++] ) );
+	   if ( _map )
+	      delete _map;
+	   if ( _fd != -1 )
+	      ::close( _fd );
+	}
+
+	// Access
+
+	bool IsValid() { return( _recs.size() != 0 ); }
+
+	// Operations
+
+	/*
+	 * One record, round-robin : All double fields to same value; then
+	 * time-stamp and update count, as the LVC server does.
+	 */
+	void WriteOne()
+	{
+	   GLlvcDb        &lvc = _def.lvc();
+	   GLlvcFldDef    *fdb = lvc.fdb();
+	   GLlvcDbItem    *rec;
+	   GLlvcFldHdr    *h;
+	   LVCint         *ip;
+	   struct timeval  tv;
+	   char           *dp, *fp;
+	   int             i, nf, fOff;
+
+	   rec  = _recs[_nxt++ % _recs.size()];
+	   nf   = rec->_nFld;
+	   ip   = (LVCint *)( (char *)rec + sizeof( GLlvcDbItem ) );
+	   dp   = (char *)rec + sizeof( GLlvcDbItem ) + ( nf * sizeof( LVCint ) );
+	   _k  += 1.0;
+	   for ( i=0,fOff=0; i<nf; i++ ) {
+	      fp = dp + fOff;
+	      h  = (GLlvcFldHdr *)fp;
+	      fp += lvc._uSz();
+	      if ( lvc.IsBinary() && ( h->_type == (u_char)mddFld_double ) )
+	         ::memcpy( fp, &_k, sizeof( _k ) );
+	      fOff += fdb[ip[i]]._len;
+	   }
+	   tv            = Logger::tvNow();
+	   rec->_tUpd    = tv.tv_sec;
+	   rec->_tUpdUs  = tv.tv_usec;
+	   rec->_nUpd   += 1;
+	   _nWrite      += 1;
+	}
+
+}; // class LVCWriter
+
+
+/////////////////////////////////////
+//
+//    c l a s s   L V C R e a d e r
+//
+/////////////////////////////////////
+class LVCReader
+{
+public:
+	LVC_Context _cxt;
+	LVCWriter  &_wr;
+	int         _seed;
+	long        _nRead;
+	long        _nTorn;
+
+	// Constructor
+public:
+	LVCReader( LVC_Context cxt, LVCWriter &wr, int seed ) :
+	   _cxt( cxt ),
+	   _wr( wr ),
+	   _seed( seed ),
+	   _nRead( 0 ),
+	   _nTorn( 0 )
+	{ ; }
+
+	// Operations
+
+	/*
+	 * Random record : Torn if double fields disagree
+	 */
+	void ReadOne()
+	{
+	   LVCData d;
+	   double  r0;
+	   bool    bTorn, b0;
+	   int     i, ix;
+
+	   _seed = ( _seed * 1103515245 ) + 12345;
+	   ix    = ( _seed & 0x7fffffff ) % _wr._svcs.size();
+	   d     = ::LVC_Snapshot( _cxt, _wr._svcs[ix], _wr._tkrs[ix] );
+	   r0    = 0.0;
+	   bTorn = ( d._pErr != (const char *)0 );
+	   for ( i=0,b0=false; !bTorn && i<d._nFld; i++ ) {
+	      if ( d._flds[i]._type != rtFld_double )
+	         continue; // for-i
+	      if ( b0 )
+	         bTorn = ( d._flds[i]._val._r64 != r0 );
+	      r0 = d._flds[i]._val._r64;
+	      b0 = true;
+	   }
+	   _nTorn += bTorn ? 1 : 0;
+	   _nRead += 1;
+	   ::LVC_Free( &d );
+	}
+
+}; // class LVCReader
+
+
+////////////////////////////////
+// Thread Functions
+////////////////////////////////
+static void EDGAPI _WriteThr( void *arg )
+{
+   ((LVCWriter *)arg)->WriteOne();
+}
+
+static void EDGAPI _ReadThr( void *arg )
+{
+   ((LVCReader *)arg)->ReadOne();
+}
+
+
+////////////////////////////////
+// Main Functions
+////////////////////////////////
+static void RunIt( char *file, LVCWriter &wr, bool bLockFree, int nRdr, double tRun )
+{
+   LVC_Context                 cxt;
+   std::vector<LVCReader *>    rdrs;
+   Threads                     thrs;
+   Thread                     *wThr;
+   long                        nRead, nTorn, nW0;
+   double                      d0, dRun;
+   int                         i;
+
+   // 1) LVC; Writer + Readers
+
+   cxt = ::LVC_Initialize( file );
+   ::LVC_SetLockFree( cxt, bLockFree ? 1 : 0 );
+   nW0  = wr._nWrite;
+   wThr = new Thread( _WriteThr, &wr );
+   for ( i=0; i<nRdr; i++ ) {
+      rdrs.push_back( new LVCReader( cxt, wr, i+1 ) );
+      thrs.push_back( new Thread( _ReadThr, rdrs[i] ) );
+   }
+   d0 = ::rtEdge_TimeNs();
+   wThr->Start();
+   for ( i=0; i<nRdr; thrs[i++]->Start() );
+   ::rtEdge_Sleep( tRun );
+   for ( i=0; i<nRdr; thrs[i++]->Stop() );
+   wThr->Stop();
+   dRun = ::rtEdge_TimeNs() - d0;
+
+   // 2) Dump : Mode,Readers,Reads,ReadsPerSec,Writes,Torn
+
+   for ( i=0,nRead=0,nTorn=0; i<nRdr; i++ ) {
+      nRead += rdrs[i]->_nRead;
+      nTorn += rdrs[i]->_nTorn;
+   }
+   printf( "%s,%d,", bLockFree ? "LockFree" : "Mutex", nRdr );
+   printf( "%ld,%.0f,", nRead, dRun ? nRead / dRun : 0.0 );
+   printf( "%ld,%ld\n", wr._nWrite - nW0, nTorn );
+
+   // 3) Clean up
+
+   for ( i=0; i<nRdr; i++ ) {
+      delete thrs[i];
+      delete rdrs[i];
+   }
+   delete wThr;
+   ::LVC_Destroy( cxt );
+}
+
+
+//////////////////////////
+// main()
+//////////////////////////
+int main( int argc, char **argv )
+{
+   std::string s;
+   LVCWriter  *wr;
+   const char *db;
+   bool        aOK;
+   double      tRun;
+   int         i, nRdr;
+
+   /////////////////////
+   // Quickie checks
+   /////////////////////
+   if ( argc > 1 && !::strcmp( argv[1], "--version" ) ) {
+      printf( "%s\n", LVCStressID() );
+      return 0;
+   }
+   db   = "./stress.lvc";
+   nRdr = 4;
+   tRun = 5.0;
+   if ( argc > 1 && !::strcmp( argv[1], "--config" ) ) {
+      s  = "Usage: %s \\ \n";
+      s += "       [ -db <Scratch copy of binary LVC file; Overwritten> ] \\ \n";
+      s += "       [ -r  <Num reader threads> ] \\ \n";
+      s += "       [ -s  <Seconds per mode> ] \\ \n";
+      printf( s.data(), argv[0] );
+      printf( "   Defaults:\n" );
+      printf( "      -db : %s\n", db );
+      printf( "      -r  : %d\n", nRdr );
+      printf( "      -s  : %.1f\n", tRun );
+      return 0;
+   }
+
+   /////////////////////
+   // cmd-line args
+   /////////////////////
+   for ( i=1; i<argc; i++ ) {
+      aOK = ( i+1 < argc );
+      if ( !aOK )
+         break; // for-i
+      if ( !::strcmp( argv[i], "-db" ) )
+         db = argv[++i];
+      else if ( !::strcmp( argv[i], "-r" ) )
+         nRdr = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-s" ) )
+         tRun = atof( argv[++i] );
+   }
+   nRdr = WithinRange( 1, nRdr, K );
+   tRun = gmax( 0.1, tRun );
+
+   /////////////////////
+   // Writer stand-in; Mutex then Lock-free
+   /////////////////////
+   wr = new LVCWriter( (char *)db );
+   if ( !wr->IsValid() ) {
+      printf( "Invalid LVC file %s\n", db );
+      delete wr;
+      return 0;
+   }
+   printf( "Mode,Readers,Reads,ReadsPerSec,Writes,Torn\n" );
+   RunIt( (char *)db, *wr, false, nRdr, tRun );
+   RunIt( (char *)db, *wr, true,  nRdr, tRun );
+   delete wr;
+   printf( "Done!!\n" );
+   return 0;
+} // main()
@@ -19,6 +19,7 @@
 *     18 MAR 2024 jcs  Build 70: mddFld_real
 *     15 MAY 2024 jcs  Build 71: SeqNum / logUpd; LOG; KOList
 *      7 MAR 2026 jcs  Build 78: MyConfig; -tease
+*     17 OCT 2026 jcs  Build 80: -bench : PublishBatch() vs. Publish()
 *
 *  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
@@ -235,6 +236,8 @@ public:
    bool   _bPack;
    bool   _tease;
    int    _qTxKb;
+   int    _nBench;
+   int    _nRound;
    KOList _KO;
 
    ////////////////////////////////
@@ -259,6 +262,8 @@ public:
       _bPack( true ),
       _tease( false ),
       _qTxKb( K ),
+      _nBench( 0 ),
+      _nRound( 100 ),
       _KO()  
    { ; }
 
@@ -382,6 +387,55 @@ public:
       return nt;
    }
 
+   /*
+    * Broadcast nTkr tickers x nRnd rounds : Publish(), then PublishBatch()
+    */
+   void Bench( int nTkr, int nRnd )
+   {
+      vector<rtEdgeData> ddb( nTkr );
+      vector<string>     tkrs( nTkr );
+      rtFIELD            flds[3];
+      char               tkr[K];
+      double             d0, dSngl, dBtch;
+      int                i, r, nMsg;
+
+      // 1) Fields shared across tickers
+
+      ::memset( flds, 0, sizeof( flds ) );
+      for ( i=0; i<3; i++ ) {
+         flds[i]._fid      = 6+i;
+         flds[i]._type     = rtFld_double;
+         flds[i]._val._r64 = M_PI * ( i+1 );
+      }
+      for ( i=0; i<nTkr; i++ ) {
+         sprintf( tkr, "BENCH%05d", i );
+         tkrs[i] = tkr;
+         ::memset( &ddb[i], 0, sizeof( rtEdgeData ) );
+         ddb[i]._pSvc = pPubName();
+         ddb[i]._pTkr = tkrs[i].data();
+         ddb[i]._arg  = (VOID_PTR)(i+1);
+         ddb[i]._ty   = edg_update;
+         ddb[i]._flds = flds;
+         ddb[i]._nFld = 3;
+      }
+
+      // 2) Single, then batch
+
+      nMsg = nTkr * nRnd;
+      d0   = TimeNs();
+      for ( r=0; r<nRnd; r++ ) {
+         for ( i=0; i<nTkr; Publish( ddb[i++] ) );
+      }
+      dSngl = TimeNs() - d0;
+      d0    = TimeNs();
+      for ( r=0; r<nRnd; r++ )
+         PublishBatch( ddb.data(), nTkr );
+      dBtch = TimeNs() - d0;
+      LOG( "BENCH %d tkrs x %d rounds\n", nTkr, nRnd );
+      LOG( "   Publish()      : %.0f msgs/sec\n", dSngl ? nMsg / dSngl : 0.0 );
+      LOG( "   PublishBatch() : %.0f msgs/sec\n", dBtch ? nMsg / dBtch : 0.0 );
+   }
+
    size_t PubTkr( Watch &w )
    {
       MyConfig &c = _cfg;
@@ -714,6 +768,8 @@ int main( int argc, char **argv )
       s += "  [ -logUpd  <true log updates> ] \\ \n";
       s += "  [ -txQ     <TX queue size in Kb> ] \\ \n";
       s += "  [ -ko      <KO List Filename> ] \\ \n";
+      s += "  [ -bench   <Num tickers to broadcast; Benchmark, then exit> ] \\ \n";
+      s += "  [ -rounds  <-bench : Num rounds> ] \\ \n";
       printf( s.data(), argv[0] );
       printf( "   Defaults:\n" );
       printf( "      -h       : %s\n", c.svr() );
@@ -734,6 +790,8 @@ int main( int argc, char **argv )
       printf( "      -txQ     : %dK\n", c._qTxKb );
       printf( "      -ko      : <empty>\n" );
       printf( "      -tease   : %s\n", c._tease ? "YES" : "NO" );
+      printf( "      -bench   : %d\n", c._nBench );
+      printf( "      -rounds  : %d\n", c._nRound );
       return 0;
    }
 
@@ -801,6 +859,10 @@ int main( int argc, char **argv )
       }
       else if ( !::strcmp( argv[i], "-tease" ) )
          c._tease = _IsTrue( argv[++i] );
+      else if ( !::strcmp( argv[i], "-bench" ) )
+         c._nBench = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-rounds" ) )
+         c._nRound = atoi( argv[++i] );
    }
 
    MyChannels pubs;
@@ -851,9 +913,16 @@ int main( int argc, char **argv )
 #ifdef TODO_PERMS_BUT_NOT_NOW
       pubs[i]->SetPerms( true );
 #endif // TODO_PERMS_BUT_NOT_NOW
-      LOG( "%s@%s\n", pubs[i]->pPubName(), pubs[i]->Start( sSvr ) );
+      LOG( "%s@%s\n", pubs[i]->pPubName(), pubs[i]->Start( sSvr, !c._nBench ) );
 //      pubs[i]->SetMDDirectMon( "./MDDirectMon.stats", "Pub", "Pub" );
    }
+   if ( c._nBench ) {
+      c._nRound = gmax( 1, c._nRound );
+      pub->Sleep( 1.0 );
+      pub->Bench( c._nBench, c._nRound );
+      for ( i=0; i<nPub; pubs[i++]->Stop() );
+      return 1;
+   }
    LOG( "Running for %.1fs; Publish every %.1fs\n", c._tRun, c._tPub );
    for ( d0=dn=pub->TimeNs(); ( dn-d0 ) < c._tRun; ) {
       for ( i=0; i<nPub; pubs[i++]->Sleep( c._tPub ) );
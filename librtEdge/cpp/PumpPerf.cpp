@@ -0,0 +1,262 @@
+/******************************************************************************
+*
+*  PumpPerf.cpp
+*     Pump dispatch latency / CPU : poll() vs. epoll() across many channels
+*
+*  REVISION HISTORY:
+*     17 OCT 2026 jcs  Created.
+*
+*  (c) 1994-2026, Gatea Ltd.
+******************************************************************************/
+#include <EDG_Internal.h>
+#include <algorithm>
+#include <sys/resource.h>
+
+using namespace RTEDGE_PRIVATE;
+
+
+/////////////////////////////////////
+// Version
+/////////////////////////////////////
+const char *PumpPerfID()
+{
+   static std::string s;
+   const char   *sccsid;
+
+   // Once
+
+   if ( !s.length() ) {
+      char bp[K], *cp;
+
+      cp  = bp;
+      cp += sprintf( cp, "@(#)PumpPerf Build %s ", _MDD_LIB_BLD );
+      cp += sprintf( cp, "%s %s Gatea Ltd.\n", __DATE__, __TIME__ );
+      cp += sprintf( cp, "%s", ::rtEdge_Version() );
+      s   = bp;
+   }
+   sccsid = s.data();
+   return sccsid+4;
+}
+
+
+////////////////////////////////
+//
+//     c l a s s   P e r f S o c k
+//
+////////////////////////////////
+typedef std::vector<double> Latency;
+
+class PerfSock : public Socket
+{
+private:
+   int     _wrFd;
+   Latency _lat;
+
+   // Constructor
+public:
+   PerfSock( char *pHosts ) :
+      Socket( pHosts ),
+      _wrFd( 0 ),
+      _lat()
+   {
+      int fds[2];
+
+      if ( !::socketpair( AF_UNIX, SOCK_DGRAM, 0, fds ) ) {
+         _fd   = fds[0];
+         _wrFd = fds[1];
+         ::fcntl( _fd, F_SETFL, O_NONBLOCK );
+      }
+   }
+
+   ~PerfSock()
+   {
+      if ( _wrFd > 0 )
+         CLOSE( _wrFd );
+   }
+
+   // Access
+
+   Latency &lat() { return _lat; }
+
+   // Operations
+
+   void Send()
+   {
+      double d0;
+
+      d0 = ::rtEdge_TimeNs();
+      ::send( _wrFd, (char *)&d0, sizeof( d0 ), 0 );
+   }
+
+   // Socket Interface
+public:
+   virtual void ConnCbk( const char *, bool ) { ; }
+
+protected:
+   virtual void OnRead()
+   {
+      double d0;
+
+      for ( ; ::recv( _fd, (char *)&d0, sizeof( d0 ), 0 ) > 0; )
+         _lat.push_back( ::rtEdge_TimeNs() - d0 );
+   }
+
+}; // class PerfSock
+
+
+////////////////////////////////
+// Helpers
+////////////////////////////////
+static double _CPU()
+{
+   struct rusage ru;
+   double        dc;
+
+   ::getrusage( RUSAGE_SELF, &ru );
+   dc  = ru.ru_utime.tv_sec + ( 0.000001 * ru.ru_utime.tv_usec );
+   dc += ru.ru_stime.tv_sec + ( 0.000001 * ru.ru_stime.tv_usec );
+   return dc;
+}
+
+static double _Pct( Latency &v, double pct )
+{
+   size_t ix;
+
+   if ( !v.size() )
+      return 0.0;
+   ix = (size_t)( pct * ( v.size() - 1 ) );
+   return 1000000.0 * v[ix];
+}
+
+
+////////////////////////////////
+// Main Functions
+////////////////////////////////
+static void RunIt( bool bEPoll, int nIdle, int nHot, int nMsg, double tGap )
+{
+   Thread               *thr;
+   std::vector<PerfSock *> sox;
+   Latency               all;
+   PerfSock             *s;
+   char                  hosts[K];
+   double                d0, dc, dRun;
+   int                   i, n;
+
+   // 1) Hot channels first; All share one Pump; Let Pump pick them up
+
+   Pump::_bEPoll = bEPoll;
+   thr           = new Thread();
+   thr->Start();
+   for ( i=0; i<nHot+nIdle; i++ ) {
+      safe_strcpy( hosts, "localhost:1" );
+      s = new PerfSock( hosts );
+      if ( s->fd() <= 0 ) {
+         delete s;
+         break; // for-i
+      }
+      sox.push_back( s );
+      thr->pump().Add( s );
+   }
+   nHot  = gmin( nHot, (int)sox.size() );
+   nIdle = (int)sox.size() - nHot;
+   ::rtEdge_Sleep( 0.25 );
+
+   // 2) Drive hot channels; Allow Pump to drain
+
+   dc = _CPU();
+   d0 = ::rtEdge_TimeNs();
+   for ( n=0; n<nMsg; ::rtEdge_Sleep( tGap ) ) {
+      for ( i=0; i<nHot && n<nMsg; sox[i++]->Send(), n++ );
+   }
+   ::rtEdge_Sleep( 0.25 );
+   dRun = ::rtEdge_TimeNs() - d0;
+   dc   = _CPU() - dc;
+
+   // 3) Stop Pump before touching Latency
+
+   thr->Stop();
+   for ( i=0; i<nHot; i++ ) {
+      Latency &lat = sox[i]->lat();
+
+      all.insert( all.end(), lat.begin(), lat.end() );
+   }
+   std::sort( all.begin(), all.end() );
+
+   // 4) Dump : Backend,NumIdle,NumHot,NumMsg,p50-us,p99-us,p999-us,CPU-pct
+
+   printf( "%s,%d,%d,", bEPoll ? "epoll" : "poll", nIdle, nHot );
+   printf( "%ld,", (long)all.size() );
+   printf( "%.1f,", _Pct( all, 0.50 ) );
+   printf( "%.1f,", _Pct( all, 0.99 ) );
+   printf( "%.1f,", _Pct( all, 0.999 ) );
+   printf( "%.1f\n", dRun ? 100.0 * dc / dRun : 0.0 );
+   delete thr; // Pump deletes PerfSock's
+}
+
+
+//////////////////////////
+// main()
+//////////////////////////
+int main( int argc, char **argv )
+{
+   std::string s;
+   bool        aOK;
+   int         i, nIdle, nHot, nMsg;
+   double      tGap;
+
+   /////////////////////
+   // Quickie checks
+   /////////////////////
+   if ( argc > 1 && !::strcmp( argv[1], "--version" ) ) {
+      printf( "%s\n", PumpPerfID() );
+      return 0;
+   }
+   nIdle = 500;
+   nHot  = 4;
+   nMsg  = 20000;
+   tGap  = 0.0001;
+   if ( argc > 1 && !::strcmp( argv[1], "--config" ) ) {
+      s  = "Usage: %s \\ \n";
+      s += "       [ -i <Num idle channels> ] \\ \n";
+      s += "       [ -h <Num hot channels> ] \\ \n";
+      s += "       [ -n <Num messages> ] \\ \n";
+      s += "       [ -g <Gap between bursts in seconds> ] \\ \n";
+      printf( s.data(), argv[0] );
+      printf( "   Defaults:\n" );
+      printf( "      -i : %d\n", nIdle );
+      printf( "      -h : %d\n", nHot );
+      printf( "      -n : %d\n", nMsg );
+      printf( "      -g : %.4f\n", tGap );
+      return 0;
+   }
+
+   /////////////////////
+   // cmd-line args
+   /////////////////////
+   for ( i=1; i<argc; i++ ) {
+      aOK = ( i+1 < argc );
+      if ( !aOK )
+         break; // for-i
+      if ( !::strcmp( argv[i], "-i" ) )
+         nIdle = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-h" ) )
+         nHot = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-n" ) )
+         nMsg = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-g" ) )
+         tGap = atof( argv[++i] );
+   }
+   nIdle = gmax( 0, nIdle );
+   nHot  = WithinRange( 1, nHot, K );
+
+   /////////////////////
+   // poll(), then epoll()
+   /////////////////////
+   printf( "Backend,NumIdle,NumHot,NumMsg,p50-us,p99-us,p999-us,CPU-pct\n" );
+   RunIt( false, nIdle, nHot, nMsg, tGap );
+#if defined(linux)
+   RunIt( true, nIdle, nHot, nMsg, tGap );
+#endif // defined(linux)
+   printf( "Done!!\n" );
+   return 0;
+} // main()
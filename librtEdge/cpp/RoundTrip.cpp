@@ -5,12 +5,14 @@
 *  REVISION HISTORY:
 *     17 FEB 2016 jcs  Created (from Publish.cpp).
 *     31 JAN 2025 jcs  Build 75: Binary always; args
+*     17 OCT 2026 jcs  Build 80: -b / -bp / -c; Summary()
 *
-*  (c) 1994-2025, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <librtEdge.h>
 #include <math.h>
 #include <stdarg.h>
+#include <algorithm>
 
 #define _TIME_FID  6
 #define _MIKE      1000000.0
@@ -24,8 +26,36 @@ using namespace RTEDGE;
 //     M y S u b
 //
 ////////////////////////
+typedef std::vector<int> Latency;
+
 class MySub : public SubChannel
 {
+private:
+   Latency _lat;
+   Mutex   _latMtx;
+
+   ////////////////////////////////
+   // Operations
+   ////////////////////////////////
+public:
+   void Summary()
+   {
+      Locker  lck( _latMtx );
+      Latency v( _lat );
+      size_t  n;
+
+      // RT-SUMMARY,NumMsg,p50-us,p99-us,p999-us
+
+      std::sort( v.begin(), v.end() );
+      if ( !(n=v.size()) )
+         return;
+      _fprintf( "RT-SUMMARY,NumMsg,p50-us,p99-us,p999-us" );
+      _fprintf( "RT-SUMMARY,%ld,%d,%d,%d", (long)n,
+                v[(size_t)( 0.500 * (n-1) )], 
+                v[(size_t)( 0.990 * (n-1) )], 
+                v[(size_t)( 0.999 * (n-1) )] );
+   }
+
    ////////////////////////////////
    // Asynchronous Notifications
    ////////////////////////////////
@@ -61,6 +91,11 @@ public:
          age = (int)( ( d1-d0 ) * _MIKE );
 //         _fprintf( "PUB %.6f; Latency(uS) = %d", D0, age );
          _fprintf( "RT,,%.6f,,,%.6f,,%d", D0, D1, age );
+         {
+            Locker lck( _latMtx );
+
+            _lat.push_back( age );
+         }
       }
    }
 
@@ -279,8 +314,8 @@ int main( int argc, char **argv )
    MySub       sub;
    const char *svrP, *svc, *svrS, *usr, *pf;
    std::string s, ss;
-   bool        bCfg, bFast, aOK;
-   int         i;
+   bool        bCfg, bFast, bSpin, aOK;
+   int         i, cpu, bpUs;
 
    // Quickie check
 
@@ -297,6 +332,9 @@ int main( int argc, char **argv )
    svc   = "round.trip";
    usr   = argv[0];
    bFast = false;
+   bSpin = false;
+   cpu   = -1;
+   bpUs  = 0;
    bCfg  = ( argc < 2 ) || ( argc > 1 && !::strcmp( argv[1], "--config" ) );
    if ( bCfg ) { 
       s  = "Usage: %s \\ \n";
@@ -305,6 +343,9 @@ int main( int argc, char **argv )
       s += "       [ -s  <Service Name>> ] \\ \n";
       s += "       [ -u  <Username> ] \\ \n";
       s += "       [ -f  <true for low latency> ] \\ \n";
+      s += "       [ -b  <true for busy-poll receive> ] \\ \n";
+      s += "       [ -bp <SO_BUSY_POLL microseconds> ] \\ \n";
+      s += "       [ -c  <Subscriber CPU core> ] \\ \n";
       printf( s.data(), argv[0] );
       printf( "   Defaults:\n" );
       printf( "      -p       : %s\n", svrP );
@@ -312,6 +353,9 @@ int main( int argc, char **argv )
       printf( "      -s       : %s\n", svc );
       printf( "      -u       : %s\n", usr );
       printf( "      -f       : %s\n", bFast ? "true" : "false" );
+      printf( "      -b       : %s\n", bSpin ? "true" : "false" );
+      printf( "      -bp      : %d\n", bpUs );
+      printf( "      -c       : %d\n", cpu );
       return 0;
    }
    for ( i=1; i<argc; i++ ) {
@@ -331,6 +375,12 @@ int main( int argc, char **argv )
          usr = argv[++i];
       else if ( !::strcmp( argv[i], "-f" ) )
          bFast = _IsTrue( argv[++i] );
+      else if ( !::strcmp( argv[i], "-b" ) )
+         bSpin = _IsTrue( argv[++i] );
+      else if ( !::strcmp( argv[i], "-bp" ) )
+         bpUs = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-c" ) )
+         cpu = atoi( argv[++i] );
    }
 
    ///////////////////////////
@@ -347,6 +397,10 @@ int main( int argc, char **argv )
    sub._fprintf( "RT,,Publish,Wire-Pub,Wire-Sub,OnData,,RT," );
    sub._fprintf( "BINARY %sFAST %s", pf, sub.Start( svrS, usr ) );
    sub.SetLowLatency( bFast );
+   if ( cpu >= 0 )
+      sub.SetThreadProcessor( cpu );
+   sub.SetBusyPoll( bSpin, bpUs );
+   sub._fprintf( "BUSY-POLL %s; SO_BUSY_POLL=%d; CPU=%d", bSpin ? "ON" : "OFF", bpUs, cpu );
    sub.Subscribe( svc, "LATENCY", NULL );
    sub._fprintf( "Hit <ENTER> to quit ..." ); getchar();
 
@@ -355,6 +409,7 @@ int main( int argc, char **argv )
    sub._fprintf( "Cleaning up ..." ); ::fflush( stdout );
    pub.Stop();
    sub.Stop();
+   sub.Summary();
    sub._fprintf( "Done!!" );
    return 1;
 }
@@ -22,6 +22,7 @@
 *      3 MAR 2025 jcs  Build 75: MySubscribe()
 *      1 APR 2025 jcs  Build 76: Formatted _DumpRow()
 *     13 FEB 2026 jcs  Build 78: -level2
+*     17 OCT 2026 jcs  Build 80: -tb
 *
 *  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
@@ -848,7 +849,7 @@ int main( int argc, char **argv )
    Renko      &r = ch._Renko;
    const char *pc;
    FILE       *fp;
-   const char *pt, *svr, *usr, *svc, *tkr, *t0, *t1, *tf, *r0, *r1, *r2;
+   const char *pt, *svr, *usr, *svc, *tkr, *t0, *t1, *tf, *tb, *r0, *r1, *r2;
    char       *cp, *rp, sTkr[K];
    bool        bCfg, aOK, bBin, bStr, bVec, bChn, bTape, bQry, bPort;
    string      s;
@@ -890,6 +891,7 @@ int main( int argc, char **argv )
    t1    = NULL;
    ti    = 0;
    tf    = NULL;
+   tb    = NULL;
    s0    = 0;
    sn    = 0;
    tRun  = 0;
@@ -910,6 +912,7 @@ int main( int argc, char **argv )
       s += "   -t1 <TapeSliceEndTime> \\ \n";
       s += "   -ti <TapeSlice Sample Interval> \\ \n";
       s += "   -tf <CSV TapeSlice Sample Fields> \\ \n";
+      s += "   -tb <TapeSlice Bar Volume Field; 0 for none> \\ \n";
       s += "   -s0 <TapeSlice Start Offset> \\ \n";
       s += "   -sn <TapeSlice NumMsg> \\ \n";
       s += "   -r  <AppRunTime> \\ \n";
@@ -940,6 +943,7 @@ int main( int argc, char **argv )
       printf( "   -t1      : <empty>\n" );
       printf( "   -ti      : %d\n", ti );
       printf( "   -tf      : <empty>\n" );
+      printf( "   -tb      : <empty>\n" );
       printf( "   -s0      : %ld\n", s0 );
       printf( "   -sn      : %d\n", sn );
       printf( "   -r       : %d\n", tRun );
@@ -986,6 +990,8 @@ int main( int argc, char **argv )
          ti  = atoi( argv[++i] );
       else if ( !::strcmp( argv[i], "-tf" ) )
          tf  = argv[++i];
+      else if ( !::strcmp( argv[i], "-tb" ) )
+         tb  = argv[++i];
       else if ( !::strcmp( argv[i], "-s0" ) )
          s0  = atol( argv[++i] );
       else if ( !::strcmp( argv[i], "-sn" ) )
@@ -1130,7 +1136,7 @@ int main( int argc, char **argv )
    if ( ch.IsTape() ) {
       if ( t0 && t1 ) {
          if ( ti && tf )
-            ch.PumpTapeSliceSample( t0, t1, ti, tf );
+            ch.PumpTapeSliceSample( t0, t1, ti, tf, tb != NULL, tb );
          else 
             ch.PumpTapeSlice( t0, t1 );
       }
@@ -0,0 +1,216 @@
+/******************************************************************************
+*
+*  TapeExport.cpp
+*     Export tape slice to memory-mappable columnar file; Scan columns
+*
+*  REVISION HISTORY:
+*     17 OCT 2026 jcs  Created.
+*
+*  (c) 1994-2026, Gatea Ltd.
+******************************************************************************/
+#include <EDG_Internal.h>
+
+using namespace RTEDGE_PRIVATE;
+
+static const char *_colTy[] = { "Time", "Ticker", "int64", "double", "string" };
+
+
+/////////////////////////////////////
+// Version
+/////////////////////////////////////
+const char *TapeExportID()
+{
+   static std::string s;
+   const char   *sccsid;
+
+   // Once
+
+   if ( !s.length() ) {
+      char bp[K], *cp;
+
+      cp  = bp;
+      cp += sprintf( cp, "@(#)TapeExport Build %s ", _MDD_LIB_BLD );
+      cp += sprintf( cp, "%s %s Gatea Ltd.\n", __DATE__, __TIME__ );
+      cp += sprintf( cp, "%s", ::rtEdge_Version() );
+      s   = bp;
+   }
+   sccsid = s.data();
+   return sccsid+4;
+}
+
+
+////////////////////////////////
+// Main Functions
+////////////////////////////////
+static u_int64_t Export( const char *tape,
+                         const char *out,
+                         const char *t0,
+                         const char *t1,
+                         const char *tkrs,
+                         const char *flds )
+{
+   rtEdge_Context cxt;
+   rtEdgeAttr     attr;
+   u_int64_t      nRow;
+   double         d0, dRun;
+
+   // 1) Tape channel; rtEdge_Start() loads tape
+
+   ::memset( &attr, 0, sizeof( attr ) );
+   attr._pSvrHosts = tape;
+   attr._pUsername = "TapeExport";
+   attr._bTape     = 1;
+   cxt             = ::rtEdge_Initialize( attr );
+   ::rtEdge_Start( cxt );
+
+   // 2) Export : Synchronous
+
+   d0   = ::rtEdge_TimeNs();
+   nRow = ::rtEdge_TapeExport( cxt, out, t0, t1, tkrs, flds );
+   dRun = ::rtEdge_TimeNs() - d0;
+   ::rtEdge_Destroy( cxt );
+
+   // 3) Dump : File,NumRow,Export-ms,RowPerSec
+
+   printf( "File,NumRow,Export-ms,RowPerSec\n" );
+   printf( "%s,%ld,", out, (long)nRow );
+   printf( "%.3f,", 1000.0 * dRun );
+   printf( "%.0f\n", dRun ? nRow / dRun : 0.0 );
+   return nRow;
+}
+
+static void Scan( const char *out )
+{
+   rtBuf64      vw;
+   rtColFooter *ftr;
+   rtColumn    *cols;
+   u_char      *set;
+   u_int64_t   *cells, r, nSet;
+   double       d0, dRun, sum;
+   int          c;
+
+   // 1) Map; Footer is last bytes
+
+   vw = ::rtEdge_MapFile( (char *)out, 0 );
+   if ( vw._dLen < sizeof( rtColFooter ) ) {
+      printf( "Can not map %s\n", out );
+      return;
+   }
+   ftr = (rtColFooter *)( vw._data + vw._dLen - sizeof( rtColFooter ) );
+   if ( ::strcmp( ftr->_signature, COL_EXP_SIG ) ) {
+      printf( "Invalid signature in %s\n", out );
+      ::rtEdge_UnmapFile( vw );
+      return;
+   }
+   printf( "NumByte,NumRow,NumCol,NumTkr\n" );
+   printf( "%ld,%ld,", (long)vw._dLen, (long)ftr->_nRow );
+   printf( "%d,%d\n", ftr->_nCol, ftr->_nTkr );
+
+   // 2) Scan each column in place : No parsing
+
+   cols = (rtColumn *)( vw._data + ftr->_colOff );
+   printf( "Column,FID,Type,NumSet,Sum,Scan-ms\n" );
+   for ( c=0; c<ftr->_nCol; c++ ) {
+      rtColumn &col = cols[c];
+
+      cells = (u_int64_t *)( vw._data + col._off );
+      set   = (u_char *)( vw._data + col._setOff );
+      d0    = ::rtEdge_TimeNs();
+      sum   = 0.0;
+      nSet  = 0;
+      for ( r=0; r<ftr->_nRow; r++ ) {
+         nSet += ( set[r>>3] >> ( r & 7 ) ) & 1;
+         switch( col._type ) {
+            case rtCol_time:
+            case rtCol_double:
+               sum += ((double *)cells)[r];
+               break;
+            case rtCol_tkrID:
+            case rtCol_int64:
+               sum += (double)(int64_t)cells[r];
+               break;
+            case rtCol_string:
+               break;
+         }
+      }
+      dRun = ::rtEdge_TimeNs() - d0;
+      printf( "%s,%d,", col._name, col._fid );
+      printf( "%s,", _colTy[WithinRange( 0, (int)col._type, 4 )] );
+      printf( "%ld,%.6g,", (long)nSet, sum );
+      printf( "%.3f\n", 1000.0 * dRun );
+   }
+   ::rtEdge_UnmapFile( vw );
+}
+
+
+//////////////////////////
+// main()
+//////////////////////////
+int main( int argc, char **argv )
+{
+   std::string s;
+   const char *tape, *out, *t0, *t1, *tkrs, *flds;
+   bool        aOK;
+   int         i;
+
+   /////////////////////
+   // Quickie checks
+   /////////////////////
+   if ( argc > 1 && !::strcmp( argv[1], "--version" ) ) {
+      printf( "%s\n", TapeExportID() );
+      return 0;
+   }
+   tape = "./tape.bin";
+   out  = "./tape.col";
+   t0   = (const char *)0;
+   t1   = (const char *)0;
+   tkrs = (const char *)0;
+   flds = "6,22,25";
+   if ( argc > 1 && !::strcmp( argv[1], "--config" ) ) {
+      s  = "Usage: %s \\ \n";
+      s += "       [ -t <Tape file> ] \\ \n";
+      s += "       [ -o <Output columnar file> ] \\ \n";
+      s += "       [ -t0 <Start time : YYYYMMDD HH:MM:SS or HH:MM:SS> ] \\ \n";
+      s += "       [ -t1 <End time : YYYYMMDD HH:MM:SS or HH:MM:SS> ] \\ \n";
+      s += "       [ -tkr <CSV tickers> ] \\ \n";
+      s += "       [ -f <CSV Field IDs or Names> ] \\ \n";
+      printf( s.data(), argv[0] );
+      printf( "   Defaults:\n" );
+      printf( "      -t   : %s\n", tape );
+      printf( "      -o   : %s\n", out );
+      printf( "      -t0  : <Start of tape>\n" );
+      printf( "      -t1  : <End of tape>\n" );
+      printf( "      -tkr : <All tickers>\n" );
+      printf( "      -f   : %s\n", flds );
+      return 0;
+   }
+
+   /////////////////////
+   // cmd-line args
+   /////////////////////
+   for ( i=1; i<argc; i++ ) {
+      aOK = ( i+1 < argc );
+      if ( !aOK )
+         break; // for-i
+      if ( !::strcmp( argv[i], "-t" ) )
+         tape = argv[++i];
+      else if ( !::strcmp( argv[i], "-o" ) )
+         out = argv[++i];
+      else if ( !::strcmp( argv[i], "-t0" ) )
+         t0 = argv[++i];
+      else if ( !::strcmp( argv[i], "-t1" ) )
+         t1 = argv[++i];
+      else if ( !::strcmp( argv[i], "-tkr" ) )
+         tkrs = argv[++i];
+      else if ( !::strcmp( argv[i], "-f" ) )
+         flds = argv[++i];
+   }
+
+   /////////////////////
+   // Export, then scan mapped file
+   /////////////////////
+   if ( Export( tape, out, t0, t1, tkrs, flds ) )
+      Scan( out );
+   printf( "Done!!\n" );
+   return 0;
+} // main()
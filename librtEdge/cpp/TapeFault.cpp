@@ -0,0 +1,186 @@
+/******************************************************************************
+*
+*  TapeFault.cpp
+*     Tape replay page faults : No prefetch vs. ioctl_tapePrefetch
+*
+*  REVISION HISTORY:
+*     17 OCT 2026 jcs  Created.
+*
+*  (c) 1994-2026, Gatea Ltd.
+******************************************************************************/
+#include <EDG_Internal.h>
+#include <fcntl.h>
+
+using namespace RTEDGE_PRIVATE;
+
+static volatile long _nMsg  = 0;
+static volatile int  _bDone = 0;
+
+
+/////////////////////////////////////
+// Version
+/////////////////////////////////////
+const char *TapeFaultID()
+{
+   static std::string s;
+   const char   *sccsid;
+
+   // Once
+
+   if ( !s.length() ) {
+      char bp[K], *cp;
+
+      cp  = bp;
+      cp += sprintf( cp, "@(#)TapeFault Build %s ", _MDD_LIB_BLD );
+      cp += sprintf( cp, "%s %s Gatea Ltd.\n", __DATE__, __TIME__ );
+      cp += sprintf( cp, "%s", ::rtEdge_Version() );
+      s   = bp;
+   }
+   sccsid = s.data();
+   return sccsid+4;
+}
+
+
+////////////////////////////////
+// Callbacks
+////////////////////////////////
+static void _OnData( rtEdge_Context cxt, rtEdgeData d )
+{
+   switch( d._ty ) {
+      case edg_update:
+         _nMsg++;
+         break;
+      case edg_streamDone:
+         _bDone = 1;
+         break;
+      default:
+         break;
+   }
+}
+
+
+////////////////////////////////
+// Helpers
+////////////////////////////////
+static bool _Evict( const char *tape )
+{
+   int  fd;
+   bool bOK;
+
+   // Drop tape from page cache : Next replay is cold
+
+   if ( (fd=::open( tape, O_RDONLY )) < 0 )
+      return false;
+   bOK = !::posix_fadvise( fd, 0, 0, POSIX_FADV_DONTNEED );
+   ::close( fd );
+   return bOK;
+}
+
+static bool _IsTrue( const char *p )
+{
+   return( !::strcmp( p, "YES" ) || !::strcmp( p, "true" ) );
+}
+
+
+////////////////////////////////
+// Main Functions
+////////////////////////////////
+static void RunIt( const char *tape, int ahead, bool bCold )
+{
+   rtEdge_Context  cxt;
+   rtEdgeAttr      attr;
+   rtEdgeChanStats st;
+   double          d0, dRun;
+
+   // 1) Tape channel; Cold if asked
+
+   if ( bCold )
+      _Evict( tape );
+   ::memset( &attr, 0, sizeof( attr ) );
+   ::memset( &st, 0, sizeof( st ) );
+   attr._pSvrHosts = tape;
+   attr._pUsername = "TapeFault";
+   attr._bTape     = 1;
+   attr._dataCbk   = _OnData;
+   cxt             = ::rtEdge_Initialize( attr );
+   ::rtEdge_SetStats( cxt, &st );
+   ::rtEdge_ioctl( cxt, ioctl_tapePrefetch, (void *)(size_t)ahead );
+   ::rtEdge_Start( cxt );
+
+   // 2) Pump ALL tickers; Wait for streamDone
+
+   _nMsg  = 0;
+   _bDone = 0;
+   d0     = ::rtEdge_TimeNs();
+   ::rtEdge_Subscribe( cxt, tape, "*", (void *)0 );
+   for ( ; !_bDone; ::rtEdge_Sleep( 0.001 ) );
+   dRun = ::rtEdge_TimeNs() - d0;
+
+   // 3) Dump : Prefetch,Cold,NumMsg,tPump-ms,MinFlt,MajFlt,MsgPerSec
+
+   printf( "%d,%s,%ld,", ahead, bCold ? "YES" : "NO", _nMsg );
+   printf( "%.3f,", 1000.0 * dRun );
+   printf( "%ld,%ld,", st._nMinFlt, st._nMajFlt );
+   printf( "%.0f\n", dRun ? _nMsg / dRun : 0.0 );
+   ::rtEdge_Destroy( cxt );
+}
+
+
+//////////////////////////
+// main()
+//////////////////////////
+int main( int argc, char **argv )
+{
+   std::string s;
+   const char *tape;
+   bool        aOK, bCold;
+   int         i, ahead;
+
+   /////////////////////
+   // Quickie checks
+   /////////////////////
+   if ( argc > 1 && !::strcmp( argv[1], "--version" ) ) {
+      printf( "%s\n", TapeFaultID() );
+      return 0;
+   }
+   tape  = "./tape.bin";
+   ahead = 64*K*K;
+   bCold = true;
+   if ( argc > 1 && !::strcmp( argv[1], "--config" ) ) {
+      s  = "Usage: %s \\ \n";
+      s += "       [ -t <Tape file> ] \\ \n";
+      s += "       [ -pf <Prefetch bytes ahead of reader> ] \\ \n";
+      s += "       [ -cold <YES to evict tape from page cache before each run> ] \\ \n";
+      printf( s.data(), argv[0] );
+      printf( "   Defaults:\n" );
+      printf( "      -t    : %s\n", tape );
+      printf( "      -pf   : %d\n", ahead );
+      printf( "      -cold : %s\n", bCold ? "YES" : "NO" );
+      return 0;
+   }
+
+   /////////////////////
+   // cmd-line args
+   /////////////////////
+   for ( i=1; i<argc; i++ ) {
+      aOK = ( i+1 < argc );
+      if ( !aOK )
+         break; // for-i
+      if ( !::strcmp( argv[i], "-t" ) )
+         tape = argv[++i];
+      else if ( !::strcmp( argv[i], "-pf" ) )
+         ahead = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-cold" ) )
+         bCold = _IsTrue( argv[++i] );
+   }
+   ahead = gmax( 0, ahead );
+
+   /////////////////////
+   // No prefetch, then prefetch
+   /////////////////////
+   printf( "Prefetch,Cold,NumMsg,tPump-ms,MinFlt,MajFlt,MsgPerSec\n" );
+   RunIt( tape, 0, bCold );
+   RunIt( tape, ahead, bCold );
+   printf( "Done!!\n" );
+   return 0;
+} // main()
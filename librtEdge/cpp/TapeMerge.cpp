@@ -0,0 +1,137 @@
+/******************************************************************************
+*
+*  TapeMerge.cpp
+*     Merged replay of many tapes : Time order and throughput
+*
+*  REVISION HISTORY:
+*     17 OCT 2026 jcs  Created.
+*
+*  (c) 1994-2026, Gatea Ltd.
+******************************************************************************/
+#include <EDG_Internal.h>
+
+using namespace RTEDGE_PRIVATE;
+
+static volatile long _nMsg  = 0;
+static volatile long _nOOO  = 0;
+static volatile int  _bDone = 0;
+static double        _tLast = 0.0;
+static int           _maxID = 0;
+
+
+/////////////////////////////////////
+// Version
+/////////////////////////////////////
+const char *TapeMergeID()
+{
+   static std::string s;
+   const char   *sccsid;
+
+   // Once
+
+   if ( !s.length() ) {
+      char bp[K], *cp;
+
+      cp  = bp;
+      cp += sprintf( cp, "@(#)TapeMerge Build %s ", _MDD_LIB_BLD );
+      cp += sprintf( cp, "%s %s Gatea Ltd.\n", __DATE__, __TIME__ );
+      cp += sprintf( cp, "%s", ::rtEdge_Version() );
+      s   = bp;
+   }
+   sccsid = s.data();
+   return sccsid+4;
+}
+
+
+////////////////////////////////
+// Callbacks
+////////////////////////////////
+static void _OnData( rtEdge_Context cxt, rtEdgeData d )
+{
+   switch( d._ty ) {
+      case edg_update:
+         _nOOO  += ( d._tMsg < _tLast ) ? 1 : 0;
+         _tLast  = d._tMsg;
+         _maxID  = gmax( _maxID, d._StreamID );
+         _nMsg++;
+         break;
+      case edg_streamDone:
+         _bDone = 1;
+         break;
+      default:
+         break;
+   }
+}
+
+
+//////////////////////////
+// main()
+//////////////////////////
+int main( int argc, char **argv )
+{
+   std::string     s;
+   rtEdge_Context  cxt;
+   rtEdgeAttr      attr;
+   const char     *tapes, *rtn;
+   bool            aOK;
+   int             i;
+   double          d0, dRun;
+
+   /////////////////////
+   // Quickie checks
+   /////////////////////
+   if ( argc > 1 && !::strcmp( argv[1], "--version" ) ) {
+      printf( "%s\n", TapeMergeID() );
+      return 0;
+   }
+   tapes = "./tape.bin";
+   if ( argc > 1 && !::strcmp( argv[1], "--config" ) ) {
+      s  = "Usage: %s \\ \n";
+      s += "       [ -t <CSV list and / or glob of tape files> ] \\ \n";
+      printf( s.data(), argv[0] );
+      printf( "   Defaults:\n" );
+      printf( "      -t : %s\n", tapes );
+      return 0;
+   }
+
+   /////////////////////
+   // cmd-line args
+   /////////////////////
+   for ( i=1; i<argc; i++ ) {
+      aOK = ( i+1 < argc );
+      if ( !aOK )
+         break; // for-i
+      if ( !::strcmp( argv[i], "-t" ) )
+         tapes = argv[++i];
+   }
+
+   /////////////////////
+   // Merged tape channel; Pump ALL tickers
+   /////////////////////
+   ::memset( &attr, 0, sizeof( attr ) );
+   attr._pSvrHosts = tapes;
+   attr._pUsername = "TapeMerge";
+   attr._bTape     = 1;
+   attr._dataCbk   = _OnData;
+   cxt             = ::rtEdge_Initialize( attr );
+   if ( ::strcmp( (rtn=::rtEdge_Start( cxt )), "OK" ) ) {
+      printf( "rtEdge_Start() : %s\n", rtn );
+      ::rtEdge_Destroy( cxt );
+      return 0;
+   }
+   d0 = ::rtEdge_TimeNs();
+   ::rtEdge_Subscribe( cxt, tapes, "*", (void *)0 );
+   for ( ; !_bDone; ::rtEdge_Sleep( 0.001 ) );
+   dRun = ::rtEdge_TimeNs() - d0;
+
+   /////////////////////
+   // Dump : NumMsg,OutOfOrder,MaxStreamID,tPump-ms,MsgPerSec
+   /////////////////////
+   printf( "NumMsg,OutOfOrder,MaxStreamID,tPump-ms,MsgPerSec\n" );
+   printf( "%ld,%ld,%d,", _nMsg, _nOOO, _maxID );
+   printf( "%.3f,", 1000.0 * dRun );
+   printf( "%.0f\n", dRun ? _nMsg / dRun : 0.0 );
+   ::rtEdge_Destroy( cxt );
+   printf( "Done!!\n" );
+   return 0;
+} // main()
@@ -0,0 +1,159 @@
+/******************************************************************************
+*
+*  TapePerf.cpp
+*     Full tape replay rate : Single- vs. multi-threaded parse
+*
+*  REVISION HISTORY:
+*     17 OCT 2026 jcs  Created.
+*
+*  (c) 1994-2026, Gatea Ltd.
+******************************************************************************/
+#include <EDG_Internal.h>
+
+using namespace RTEDGE_PRIVATE;
+
+static volatile long _nMsg  = 0;
+static volatile long _nFld  = 0;
+static volatile int  _bDone = 0;
+
+
+/////////////////////////////////////
+// Version
+/////////////////////////////////////
+const char *TapePerfID()
+{
+   static std::string s;
+   const char   *sccsid;
+
+   // Once
+
+   if ( !s.length() ) {
+      char bp[K], *cp;
+
+      cp  = bp;
+      cp += sprintf( cp, "@(#)TapePerf Build %s ", _MDD_LIB_BLD );
+      cp += sprintf( cp, "%s %s Gatea Ltd.\n", __DATE__, __TIME__ );
+      cp += sprintf( cp, "%s", ::rtEdge_Version() );
+      s   = bp;
+   }
+   sccsid = s.data();
+   return sccsid+4;
+}
+
+
+////////////////////////////////
+// Callbacks : Thread-safe
+////////////////////////////////
+static void _OnData( rtEdge_Context cxt, rtEdgeData d )
+{
+   switch( d._ty ) {
+      case edg_update:
+         ATOMIC_INC( &_nMsg );
+         ATOMIC_ADD( &_nFld, d._nFld );
+         break;
+      case edg_streamDone:
+         _bDone = 1;
+         break;
+      default:
+         break;
+   }
+}
+
+
+////////////////////////////////
+// Main Functions
+////////////////////////////////
+static void RunIt( const char *tape, int nThr, bool bOrdered )
+{
+   rtEdge_Context cxt;
+   rtEdgeAttr     attr;
+   double         d0, dRun;
+
+   // 1) Tape channel
+
+   ::memset( &attr, 0, sizeof( attr ) );
+   attr._pSvrHosts = tape;
+   attr._pUsername = "TapePerf";
+   attr._bTape     = 1;
+   attr._dataCbk   = _OnData;
+   cxt             = ::rtEdge_Initialize( attr );
+   ::rtEdge_ioctl( cxt, ioctl_tapeThreads, (void *)(size_t)nThr );
+   ::rtEdge_ioctl( cxt, ioctl_tapeOrdered, (void *)(size_t)bOrdered );
+   ::rtEdge_Start( cxt );
+
+   // 2) Pump ALL tickers; Wait for streamDone
+
+   _nMsg  = 0;
+   _nFld  = 0;
+   _bDone = 0;
+   d0     = ::rtEdge_TimeNs();
+   ::rtEdge_Subscribe( cxt, tape, "*", (void *)0 );
+   for ( ; !_bDone; ::rtEdge_Sleep( 0.001 ) );
+   dRun = ::rtEdge_TimeNs() - d0;
+
+   // 3) Dump : Threads,Ordered,NumMsg,NumFld,tPump-ms,MsgPerSec
+
+   printf( "%d,%s,", nThr, bOrdered ? "YES" : "NO" );
+   printf( "%ld,%ld,", _nMsg, _nFld );
+   printf( "%.3f,", 1000.0 * dRun );
+   printf( "%.0f\n", dRun ? _nMsg / dRun : 0.0 );
+   ::rtEdge_Destroy( cxt );
+}
+
+
+//////////////////////////
+// main()
+//////////////////////////
+int main( int argc, char **argv )
+{
+   std::string s;
+   const char *tape;
+   bool        aOK;
+   int         i, nThr, maxThr;
+
+   /////////////////////
+   // Quickie checks
+   /////////////////////
+   if ( argc > 1 && !::strcmp( argv[1], "--version" ) ) {
+      printf( "%s\n", TapePerfID() );
+      return 0;
+   }
+   tape   = "./tape.bin";
+   maxThr = 8;
+   if ( argc > 1 && !::strcmp( argv[1], "--config" ) ) {
+      s  = "Usage: %s \\ \n";
+      s += "       [ -t <Tape file> ] \\ \n";
+      s += "       [ -n <Max replay threads> ] \\ \n";
+      printf( s.data(), argv[0] );
+      printf( "   Defaults:\n" );
+      printf( "      -t : %s\n", tape );
+      printf( "      -n : %d\n", maxThr );
+      return 0;
+   }
+
+   /////////////////////
+   // cmd-line args
+   /////////////////////
+   for ( i=1; i<argc; i++ ) {
+      aOK = ( i+1 < argc );
+      if ( !aOK )
+         break; // for-i
+      if ( !::strcmp( argv[i], "-t" ) )
+         tape = argv[++i];
+      else if ( !::strcmp( argv[i], "-n" ) )
+         maxThr = atoi( argv[++i] );
+   }
+   maxThr = WithinRange( 1, maxThr, K );
+
+   /////////////////////
+   // 1, 2, 4, ... maxThr : Ordered, then unordered
+   /////////////////////
+   printf( "Threads,Ordered,NumMsg,NumFld,tPump-ms,MsgPerSec\n" );
+   RunIt( tape, 1, true );
+   for ( nThr=2; nThr<=maxThr; nThr<<=1 ) {
+      RunIt( tape, nThr, true );
+      RunIt( tape, nThr, false );
+   }
+   printf( "Done!!\n" );
+   return 0;
+} // main()
@@ -0,0 +1,189 @@
+/******************************************************************************
+*
+*  TapeTkrIdx.cpp
+*     Build per-ticker tape index (<tape>.tkr); Time 1 ticker replay
+*
+*  REVISION HISTORY:
+*     17 OCT 2026 jcs  Created.
+*
+*  (c) 1994-2026, Gatea Ltd.
+******************************************************************************/
+#include <EDG_Internal.h>
+#include <sys/stat.h>
+
+using namespace RTEDGE_PRIVATE;
+
+static volatile long _nMsg  = 0;
+static volatile int  _bDone = 0;
+
+
+/////////////////////////////////////
+// Version
+/////////////////////////////////////
+const char *TapeTkrIdxID()
+{
+   static std::string s;
+   const char   *sccsid;
+
+   // Once
+
+   if ( !s.length() ) {
+      char bp[K], *cp;
+
+      cp  = bp;
+      cp += sprintf( cp, "@(#)TapeTkrIdx Build %s ", _MDD_LIB_BLD );
+      cp += sprintf( cp, "%s %s Gatea Ltd.\n", __DATE__, __TIME__ );
+      cp += sprintf( cp, "%s", ::rtEdge_Version() );
+      s   = bp;
+   }
+   sccsid = s.data();
+   return sccsid+4;
+}
+
+
+////////////////////////////////
+// Callbacks
+////////////////////////////////
+static void _OnData( rtEdge_Context cxt, rtEdgeData d )
+{
+   switch( d._ty ) {
+      case edg_update:
+         _nMsg++;
+         break;
+      case edg_streamDone:
+         _bDone = 1;
+         break;
+      default:
+         break;
+   }
+}
+
+
+////////////////////////////////
+// Main Functions
+////////////////////////////////
+static bool Build( rtEdge_Context cxt, const char *tape )
+{
+   std::string idx;
+   struct stat sb;
+   double      d0, dRun;
+   bool        bOK;
+
+   // 1) Synchronous; Failure reason is logged
+
+   d0   = ::rtEdge_TimeNs();
+   ::rtEdge_ioctl( cxt, ioctl_tapeTickerIndex, (void *)0 );
+   dRun = ::rtEdge_TimeNs() - d0;
+
+   // 2) Dump : File,NumByte,Build-ms
+
+   idx  = tape;
+   idx += ".tkr";
+   bOK  = !::stat( idx.data(), &sb );
+   if ( !bOK ) {
+      printf( "Can not build %s\n", idx.data() );
+      return false;
+   }
+   printf( "File,NumByte,Build-ms\n" );
+   printf( "%s,%ld,", idx.data(), (long)sb.st_size );
+   printf( "%.3f\n", 1000.0 * dRun );
+   return true;
+}
+
+static void Replay( rtEdge_Context cxt,
+                    const char    *tape,
+                    const char    *svc,
+                    const char    *tkr )
+{
+   double d0, dRun;
+
+   // 1) Watch 1 ticker; Pump; Wait for streamDone
+
+   _nMsg  = 0;
+   _bDone = 0;
+   d0     = ::rtEdge_TimeNs();
+   ::rtEdge_Subscribe( cxt, svc, tkr, (void *)0 );
+   ::rtEdge_Subscribe( cxt, tape, "*", (void *)0 );
+   for ( ; !_bDone; ::rtEdge_Sleep( 0.001 ) );
+   dRun = ::rtEdge_TimeNs() - d0;
+
+   // 2) Dump : Ticker,NumMsg,tPump-ms,MsgPerSec
+
+   printf( "Ticker,NumMsg,tPump-ms,MsgPerSec\n" );
+   printf( "%s,%ld,", tkr, _nMsg );
+   printf( "%.3f,", 1000.0 * dRun );
+   printf( "%.0f\n", dRun ? _nMsg / dRun : 0.0 );
+}
+
+
+//////////////////////////
+// main()
+//////////////////////////
+int main( int argc, char **argv )
+{
+   std::string     s;
+   rtEdge_Context  cxt;
+   rtEdgeAttr      attr;
+   const char     *tape, *svc, *tkr, *rtn;
+   bool            aOK;
+   int             i;
+
+   /////////////////////
+   // Quickie checks
+   /////////////////////
+   if ( argc > 1 && !::strcmp( argv[1], "--version" ) ) {
+      printf( "%s\n", TapeTkrIdxID() );
+      return 0;
+   }
+   tape = "./tape.bin";
+   svc  = "IDN";
+   tkr  = (const char *)0;
+   if ( argc > 1 && !::strcmp( argv[1], "--config" ) ) {
+      s  = "Usage: %s \\ \n";
+      s += "       [ -t   <Tape file> ] \\ \n";
+      s += "       [ -s   <Service to replay> ] \\ \n";
+      s += "       [ -tkr <Ticker to replay> ] \\ \n";
+      printf( s.data(), argv[0] );
+      printf( "   Defaults:\n" );
+      printf( "      -t   : %s\n", tape );
+      printf( "      -s   : %s\n", svc );
+      printf( "      -tkr : <Build only>\n" );
+      return 0;
+   }
+
+   /////////////////////
+   // cmd-line args
+   /////////////////////
+   for ( i=1; i<argc; i++ ) {
+      aOK = ( i+1 < argc );
+      if ( !aOK )
+         break; // for-i
+      if ( !::strcmp( argv[i], "-t" ) )
+         tape = argv[++i];
+      else if ( !::strcmp( argv[i], "-s" ) )
+         svc = argv[++i];
+      else if ( !::strcmp( argv[i], "-tkr" ) )
+         tkr = argv[++i];
+   }
+
+   /////////////////////
+   // Tape channel; Build index, then replay 1 ticker from it
+   /////////////////////
+   ::rtEdge_Log( "stdout", 1 );
+   ::memset( &attr, 0, sizeof( attr ) );
+   attr._pSvrHosts = tape;
+   attr._pUsername = "TapeTkrIdx";
+   attr._bTape     = 1;
+   attr._dataCbk   = _OnData;
+   cxt             = ::rtEdge_Initialize( attr );
+   if ( ::strcmp( (rtn=::rtEdge_Start( cxt )), "OK" ) ) {
+      printf( "rtEdge_Start() : %s\n", rtn );
+      ::rtEdge_Destroy( cxt );
+      return 0;
+   }
+   if ( Build( cxt, tape ) && tkr )
+      Replay( cxt, tape, svc, tkr );
+   ::rtEdge_Destroy( cxt );
+   printf( "Done!!\n" );
+   return 0;
+} // main()
@@ -0,0 +1,374 @@
+/******************************************************************************
+*
+*  UdpGap.cpp
+*     Mold64 UDP gap detection / refresh latency across a lossy relay
+*
+*  REVISION HISTORY:
+*     17 OCT 2026 jcs  Created.
+*     17 OCT 2026 jcs  -R : ioctl_udpRecvBatch
+*
+*  (c) 1994-2026, Gatea Ltd.
+******************************************************************************/
+#include <EDG_Internal.h>
+#include <algorithm>
+
+using namespace RTEDGE_PRIVATE;
+
+static const char *_svc = "UDPGAP";
+
+typedef std::vector<double> Latency;
+
+
+/////////////////////////////////////
+// Version
+/////////////////////////////////////
+const char *UdpGapID()
+{
+   static std::string s;
+   const char   *sccsid;
+
+   // Once
+
+   if ( !s.length() ) {
+      char bp[K], *cp;
+
+      cp  = bp;
+      cp += sprintf( cp, "@(#)UdpGap Build %s ", _MDD_LIB_BLD );
+      cp += sprintf( cp, "%s %s Gatea Ltd.\n", __DATE__, __TIME__ );
+      cp += sprintf( cp, "%s", ::rtEdge_Version() );
+      s   = bp;
+   }
+   sccsid = s.data();
+   return sccsid+4;
+}
+
+
+////////////////////////////////
+//
+//      c l a s s   R e l a y
+//
+////////////////////////////////
+class Relay
+{
+public:
+   int                _fd;
+   int                _dropEvery;
+   long               _nPkt;
+   long               _nDrop;
+   struct sockaddr_in _pub;
+   struct sockaddr_in _sub;
+   bool               _bPub;
+
+   // Constructor / Destructor
+public:
+   Relay( int port, int subPort, int dropEvery ) :
+      _fd( ::socket( AF_INET, SOCK_DGRAM, 0 ) ),
+      _dropEvery( dropEvery ),
+      _nPkt( 0 ),
+      _nDrop( 0 ),
+      _bPub( false )
+   {
+      struct sockaddr_in a;
+
+      ::memset( &a, 0, sizeof( a ) );
+      ::memset( &_pub, 0, sizeof( _pub ) );
+      ::memset( &_sub, 0, sizeof( _sub ) );
+      a.sin_family         = AF_INET;
+      a.sin_port           = htons( port );
+      a.sin_addr.s_addr    = htonl( INADDR_LOOPBACK );
+      _sub                 = a;
+      _sub.sin_port        = htons( subPort );
+      ::bind( _fd, (struct sockaddr *)&a, sizeof( a ) );
+   }
+
+   ~Relay()
+   {
+      CLOSE( _fd );
+   }
+
+   // Operations
+
+   /*
+    * Publisher -> Subscriber : Drop every Nth
+    * Anyone else -> Publisher : <GetCache/>
+    */
+   void Forward()
+   {
+      struct sockaddr_in src;
+      struct pollfd      pfd;
+      socklen_t          sl;
+      bool               bFromPub;
+      char               buf[_MTU];
+      int                nb;
+
+      pfd.fd     = _fd;
+      pfd.events = POLLIN;
+      if ( ::poll( &pfd, 1, 100 ) <= 0 )
+         return;
+      sl = sizeof( src );
+      if ( (nb=::recvfrom( _fd, buf, _MTU, 0, (struct sockaddr *)&src, &sl )) <= 0 )
+         return;
+      bFromPub = ( src.sin_port != _sub.sin_port );
+      if ( bFromPub && !_bPub ) {
+         _pub  = src;
+         _bPub = true;
+      }
+      if ( bFromPub ) {
+         _nPkt += 1;
+         if ( _dropEvery && !( _nPkt % _dropEvery ) ) {
+            _nDrop += 1;
+            return;
+         }
+         ::sendto( _fd, buf, nb, 0, (struct sockaddr *)&_sub, sizeof( _sub ) );
+      }
+      else if ( _bPub )
+         ::sendto( _fd, buf, nb, 0, (struct sockaddr *)&_pub, sizeof( _pub ) );
+   }
+
+}; // class Relay
+
+
+////////////////////////////////
+// Callbacks
+////////////////////////////////
+static Latency _lat;
+static double  _tGap  = 0.0;
+static long    _nRcv  = 0;
+
+static void _RelayThr( void *arg )
+{
+   Relay *r = (Relay *)arg;
+
+   r->Forward();
+}
+
+static void _OnData( rtEdge_Context cxt, rtEdgeData d )
+{
+   double now;
+
+   /*
+    * Gap : All streams edg_recovering; 1st image afterwards is recovery
+    */
+   now = ::rtEdge_TimeNs();
+   switch( d._ty ) {
+      case edg_recovering:
+         _tGap = _tGap ? _tGap : now;
+         break;
+      case edg_image:
+         if ( _tGap )
+            _lat.push_back( now - _tGap );
+         _tGap  = 0.0;
+         _nRcv += 1;
+         break;
+      case edg_update:
+         _nRcv += 1;
+         break;
+      default:
+         break;
+   }
+}
+
+static void _OnImgQry( rtEdge_Context cxt, const char *tkr, void *arg )
+{
+   rtEdgeData d;
+   rtFIELD    f;
+
+   ::memset( &d, 0, sizeof( d ) );
+   f._fid      = 6;
+   f._type     = rtFld_double;
+   f._val._r64 = 100.0;
+   d._pSvc     = _svc;
+   d._pTkr     = tkr;
+   d._arg      = arg;
+   d._flds     = &f;
+   d._nFld     = 1;
+   d._ty       = edg_image;
+   ::rtEdge_Publish( cxt, d );
+}
+
+static double _Pct( Latency &v, double pct )
+{
+   size_t ix;
+
+   if ( !v.size() )
+      return 0.0;
+   ix = (size_t)( pct * ( v.size() - 1 ) );
+   return 1000.0 * v[ix];
+}
+
+
+////////////////////////////////
+// Main Functions
+////////////////////////////////
+static void RunIt( int port, int nMsg, int nTkr, int dropEvery, int rate, int batch, int tRfh, int rxBatch )
+{
+   rtEdge_Context  pub, sub;
+   rtEdgePubAttr   pa;
+   rtEdgeAttr      sa;
+   rtEdgeChanStats st;
+   rtEdgeData      d;
+   rtFIELD         f;
+   Thread_Context  thr;
+   Relay           relay( port+1, port+2, dropEvery );
+   char            hPub[K], hSub[K], tkr[K];
+   double          d0, dt;
+   int             i, n;
+
+   // 1) Lossy relay
+
+   thr = ::OS_StartThread( _RelayThr, &relay );
+
+   // 2) Subscriber : Refresh on gap
+
+   ::memset( &sa, 0, sizeof( sa ) );
+   ::memset( &st, 0, sizeof( st ) );
+   sprintf( hSub, "localhost:%d", port+2 );
+   sa._pSvrHosts = hSub;
+   sa._pUsername = "UdpGap";
+   sa._dataCbk   = _OnData;
+   sub           = ::rtEdge_Initialize( sa );
+   ::rtEdge_SetStats( sub, &st );
+   ::rtEdge_ioctl( sub, ioctl_udpSubscribe, (void *)1 );
+   ::rtEdge_ioctl( sub, ioctl_udpGapRefresh, (void *)(size_t)tRfh );
+   ::rtEdge_ioctl( sub, ioctl_udpRecvBatch, (void *)(size_t)rxBatch );
+   ::rtEdge_Start( sub );
+   for ( i=0; i<nTkr; i++ ) {
+      sprintf( tkr, "TKR%04d", i );
+      ::rtEdge_Subscribe( sub, _svc, tkr, (void *)(size_t)(i+1) );
+   }
+
+   // 3) Publisher : Bound to port so relay may send <GetCache/> back
+
+   ::memset( &pa, 0, sizeof( pa ) );
+   sprintf( hPub, "localhost:%d", port+1 );
+   pa._pSvrHosts       = hPub;
+   pa._pPubName        = _svc;
+   pa._bConnectionless = 1;
+   pa._udpPort         = port;
+   pa._imgQryCbk       = _OnImgQry;
+   pub                 = ::rtEdge_PubInit( pa );
+   ::rtEdge_ioctl( pub, ioctl_udpBatch, (void *)(size_t)batch );
+   ::rtEdge_PubStart( pub );
+   ::rtEdge_Sleep( 0.25 );
+
+   // 4) Publish at rate
+
+   ::memset( &d, 0, sizeof( d ) );
+   f._fid  = 6;
+   f._type = rtFld_double;
+   d._pSvc = _svc;
+   d._flds = &f;
+   d._nFld = 1;
+   d._ty   = edg_update;
+   d0      = ::rtEdge_TimeNs();
+   for ( n=0; n<nMsg; n++ ) {
+      i           = n % nTkr;
+      sprintf( tkr, "TKR%04d", i );
+      f._val._r64 = 100.0 + ( 0.01 * n );
+      d._pTkr     = tkr;
+      d._arg      = (void *)(size_t)(i+1);
+      ::rtEdge_Publish( pub, d );
+      dt = ( d0 + ( (double)n / rate ) ) - ::rtEdge_TimeNs();
+      if ( dt > 0.001 )
+         ::rtEdge_Sleep( dt );
+   }
+   ::rtEdge_Sleep( 1.5 );
+
+   // 5) Dump : Batch,RxBatch,NumMsg,NumRcv,NumRdCall,NumDrop,NumOvfl,NumGap,NumLost,NumRefresh,p50-ms,p99-ms,max-ms
+
+   std::sort( _lat.begin(), _lat.end() );
+   printf( "%d,%d,%d,%ld,", batch, rxBatch, nMsg, _nRcv );
+   printf( "%ld,%ld,%ld,", st._nRdCall, relay._nDrop, st._nUdpDrop );
+   printf( "%ld,%ld,%ld,", st._nUdpGap, st._nUdpLost, (long)_lat.size() );
+   printf( "%.3f,", _Pct( _lat, 0.50 ) );
+   printf( "%.3f,", _Pct( _lat, 0.99 ) );
+   printf( "%.3f\n", _Pct( _lat, 1.0 ) );
+   ::rtEdge_PubDestroy( pub );
+   ::rtEdge_Destroy( sub );
+   ::OS_StopThread( thr );
+}
+
+
+//////////////////////////
+// main()
+//////////////////////////
+int main( int argc, char **argv )
+{
+   std::string s;
+   bool        aOK;
+   int         i, port, nMsg, nTkr, dropEvery, rate, batch, tRfh, rxBatch;
+
+   /////////////////////
+   // Quickie checks
+   /////////////////////
+   if ( argc > 1 && !::strcmp( argv[1], "--version" ) ) {
+      printf( "%s\n", UdpGapID() );
+      return 0;
+   }
+   port      = 21100;
+   nMsg      = 100000;
+   nTkr      = 100;
+   dropEvery = 5000;
+   rate      = 20000;
+   batch     = 0;
+   tRfh      = 100;
+   rxBatch   = 0;
+   if ( argc > 1 && !::strcmp( argv[1], "--config" ) ) {
+      s  = "Usage: %s \\ \n";
+      s += "       [ -p <Base UDP port : Pub, Relay, Sub> ] \\ \n";
+      s += "       [ -n <Num messages> ] \\ \n";
+      s += "       [ -t <Num tickers> ] \\ \n";
+      s += "       [ -d <Drop every Nth packet; 0 = none> ] \\ \n";
+      s += "       [ -r <Msgs / sec> ] \\ \n";
+      s += "       [ -b <ioctl_udpBatch> ] \\ \n";
+      s += "       [ -h <ioctl_udpGapRefresh millis; 0 = none> ] \\ \n";
+      s += "       [ -R <ioctl_udpRecvBatch; 0 = recvfrom()> ] \\ \n";
+      printf( s.data(), argv[0] );
+      printf( "   Defaults:\n" );
+      printf( "      -p : %d\n", port );
+      printf( "      -n : %d\n", nMsg );
+      printf( "      -t : %d\n", nTkr );
+      printf( "      -d : %d\n", dropEvery );
+      printf( "      -r : %d\n", rate );
+      printf( "      -b : %d\n", batch );
+      printf( "      -h : %d\n", tRfh );
+      printf( "      -R : %d\n", rxBatch );
+      return 0;
+   }
+
+   /////////////////////
+   // cmd-line args
+   /////////////////////
+   for ( i=1; i<argc; i++ ) {
+      aOK = ( i+1 < argc );
+      if ( !aOK )
+         break; // for-i
+      if ( !::strcmp( argv[i], "-p" ) )
+         port = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-n" ) )
+         nMsg = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-t" ) )
+         nTkr = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-d" ) )
+         dropEvery = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-r" ) )
+         rate = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-b" ) )
+         batch = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-h" ) )
+         tRfh = atoi( argv[++i] );
+      else if ( !::strcmp( argv[i], "-R" ) )
+         rxBatch = atoi( argv[++i] );
+   }
+   nTkr = WithinRange( 1, nTkr, 9999 );
+   rate = gmax( 1, rate );
+
+   /////////////////////
+   // Run
+   /////////////////////
+   printf( "Batch,RxBatch,NumMsg,NumRcv,NumRdCall,NumDrop,NumOvfl," );
+   printf( "NumGap,NumLost,NumRefresh,p50-ms,p99-ms,max-ms\n" );
+   RunIt( port, nMsg, nTkr, dropEvery, rate, batch, tRfh, rxBatch );
+   printf( "Done!!\n" );
+   return 0;
+}
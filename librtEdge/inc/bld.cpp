@@ -1,3 +1,3 @@
 #if !defined(_MDD_LIB_BLD)
-#define _MDD_LIB_BLD "79"
+#define _MDD_LIB_BLD "80"
 #endif // !defined(_MDD_LIB_BLD)
@@ -12,8 +12,10 @@
 *      8 MAR 2023 jcs  Build 62: Re-entrant SnanpAll( LVCAll * )
 *     14 AUG 2023 jcs  Build 65: _nameMap
 *     26 JUN 2024 jcs  Build 72: SetFilter( flds, svcs )
+*     17 OCT 2026 jcs  Build 80: SetSnapThreads(); SetArena(); LVCAll._pool; SnapDelta()
+*     17 OCT 2026 jcs  Build 80: SetLockFree()
 *
-*  (c) 1994-2024, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __RTEDGE_LVC_H
 #define __RTEDGE_LVC_H
@@ -54,6 +56,7 @@ public:
 	   _lvc( lvc ),
 	   _schema( schema ),
 	   _msgs(),
+	   _pool(),
 	   _nameMap()
 	{
 	   ::memset( &_all, 0, sizeof( _all ) );
@@ -61,7 +64,11 @@ public:
 
 	virtual ~LVCAll()
 	{
+	   int i;
+
 	   reset();
+	   for ( i=0; i<(int)_pool.size(); delete _pool[i++] );
+	   _pool.clear();
 	}
 
 
@@ -88,7 +95,7 @@ public:
 	 */
 	bool GetRecordIndex( const char *svc, const char *tkr, int &idx )
 	{
-	   NameMap           ndb = _nameMap;
+	   NameMap          &ndb = _nameMap;
 	   NameMap::iterator it;
 	   std::string       s( _Key( svc, tkr ) );
 
@@ -140,16 +147,27 @@ public:
 	   return _all._dSnap;
 	}
 
-	/** \brief Reset guts */
+	/**
+	 * \brief Return Unix time this result is current to
+	 *
+	 * \return Unix time this result is current to
+	 * \see LVC::SnapDelta()
+	 */
+	double tWatermark()
+	{
+	   return _all._tWatermark;
+	}
+
+	/** \brief Reset guts; Message's return to pool; Keep tWatermark() */
 	void reset()
 	{
-	   int i;
+	   double tWm = _all._tWatermark;
 
-	   for ( i=0; i<Size(); delete _msgs[i++] );
 	   _msgs.clear();
 	   _nameMap.clear();
 	   ::LVC_FreeAll( &_all );
 	   ::memset( &_all, 0, sizeof( _all ) );
+	   _all._tWatermark = tWm;
 	}
 
 	/** 
@@ -166,8 +184,15 @@ public:
 
 	   reset();
 	   _all = la;
+	   _msgs.reserve( la._nTkr );
 	   for ( i=0; i<la._nTkr; i++ ) {
-	      msg = new Message( cxt, true );
+	      if ( i == (int)_pool.size() )
+	         _pool.push_back( new Message( cxt, true ) );
+	      if ( _pool[i]->cxt() != cxt ) {
+	         delete _pool[i];
+	         _pool[i] = new Message( cxt, true );
+	      }
+	      msg = _pool[i];
 	      ld  = &la._tkrs[i];
 	      msg->Set( ld, _schema.Get() );
 	      _msgs.push_back( msg );
@@ -199,6 +224,7 @@ private:
 	LVC       &_lvc;
 	Schema    &_schema;
 	Messages   _msgs;
+	Messages   _pool;
 	LVCDataAll _all;
 	NameMap    _nameMap;
 
@@ -360,6 +386,38 @@ public:
 	   SetFilter( (const char *)0,  (const char **)0 );
 	}
 
+	/**
+	 * \brief Set number of worker threads used by SnapAll() / ViewAll()
+	 *
+	 * \param nThr - Number of threads; Default is 1 (calling thread only)
+	 */
+	void SetSnapThreads( int nThr )
+	{
+	   ::LVC_SetSnapThreads( _cxt, nThr );
+	}
+
+	/**
+	 * \brief Carve SnapAll() / ViewAll() results from a few large blocks
+	 *
+	 * \param bArena - true for large blocks; false for per-record (Default)
+	 * \see ::LVC_SetArena()
+	 */
+	void SetArena( bool bArena )
+	{
+	   ::LVC_SetArena( _cxt, bArena ? 1 : 0 );
+	}
+
+	/**
+	 * \brief Read records without serializing on the LVC mutex
+	 *
+	 * \param bLockFree - true for lock-free; false to lock (Default)
+	 * \see ::LVC_SetLockFree()
+	 */
+	void SetLockFree( bool bLockFree )
+	{
+	   ::LVC_SetLockFree( _cxt, bLockFree ? 1 : 0 );
+	}
+
 	////////////////////////////////////
 	// Query - Single Ticker
 	////////////////////////////////////
@@ -463,6 +521,38 @@ public:
 	   return SnapAll_safe( dst );
 	}
 
+	/**
+	 * \brief Query LVC for tickers updated since last SnapAll() or 
+	 * SnapDelta()
+	 *
+	 * This method is not re-entrant and unsafe
+	 *
+	 * \return Changed contents of LVC Cache in LVCAll struct
+	 * \see ::LVC_SnapSince()
+	 */
+	LVCAll &SnapDelta()
+	{
+	   Locker  lck( _qryMtx );
+
+	   return SnapDelta_safe( *_all );
+	}
+
+	/**
+	 * \brief Query LVC for tickers updated since dst.tWatermark()
+	 *
+	 * This method may be called simultaneously by multiple threads. 
+	 *
+	 * \param dst : User-supplied LVCAll instance to hold LVC Values
+	 * \return dst
+	 * \see ::LVC_SnapSince()
+	 */
+	LVCAll &SnapDelta_safe( LVCAll &dst )
+	{
+	   double tWm = dst.tWatermark();
+
+	   return dst.Set( _cxt, ::LVC_SnapSince( _cxt, tWm ) );
+	}
+
 	/**
 	 * \brief Release resources associated with the last call to SnapAll() 
 	 * or ViewAll().
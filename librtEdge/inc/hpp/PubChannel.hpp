@@ -24,8 +24,12 @@
 *     26 JUN 2024 jcs  Build 72: Default : binary / unpacked / circQ
 *     22 DEC 2024 jcs  Build 74: ioctl_setRawLog; Remove from _pubChans AFTER Stop()
 *      7 JAN 2025 jcs  Build 75: PreBuilt w/ Overflow : Clear out
+*     17 OCT 2026 jcs  Build 80: SetUdpBatch()
+*     17 OCT 2026 jcs  Build 80: SetGatherIO()
+*     17 OCT 2026 jcs  Build 80: PublishBatch()
+*     17 OCT 2026 jcs  Build 80: PublishBatch() : OnOverflow() iff queue rejected
 *
-*  (c) 1994-2025, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __RTEDGE_PubChannel_H
 #define __RTEDGE_PubChannel_H
@@ -91,7 +95,10 @@ public:
 	   _bRandom( false ),
 	   _bUnPacked( true ),
 	   _bCircularBuffer( true ),
+	   _bGatherIO( false ),
 	   _hopCnt( 0 ),
+	   _udpBatch( 0 ),
+	   _udpFlushUs( 1000 ),
 	   _upd( (Update *)0 )
 	{
 	   SetCache( true );
@@ -246,6 +253,8 @@ public:
 	   SetHeartbeat( _tHbeat );
 	   SetIdleCallback( _bIdleCbk );
 	   SetUnPacked( _bUnPacked );
+	   if ( _bGatherIO )
+	      ::rtEdge_ioctl( _cxt, ioctl_gatherIO, (void *)1 );
 	   if ( _rawLog.size() )
 	      SetRawLog( _rawLog.data() );
 	   return ::rtEdge_PubStart( _cxt );
@@ -301,6 +310,7 @@ public:
 	   ::rtEdge_ioctl( _cxt, ioctl_binary, (void *)_bBinary );
 	   SetIdleCallback( _bIdleCbk );
 	   SetUnPacked( _bUnPacked );
+	   SetUdpBatch( _udpBatch, _udpFlushUs );
 	   return ::rtEdge_PubStart( _cxt );
 	}
 
@@ -367,6 +377,20 @@ public:
 	      _bCircularBuffer = bCircularBuffer;
 	}
 
+	/**
+	 * \brief Queue published messages by reference; Flush via writev()
+	 *
+	 * Supersedes SetCircularBuffer().  The buffer type is set once in 
+	 * Start().  Therefore, this must be called BEFORE calling Start().
+	 *
+	 * \param bGatherIO - true for writev() from build buffer references
+	 */
+	void SetGatherIO( bool bGatherIO )
+	{
+	   if ( !IsValid() )
+	      _bGatherIO = bGatherIO;
+	}
+
 	/**
 	 * \brief Allow / Disallow user-supplied message type in Publish().
 	 *
@@ -381,6 +405,25 @@ public:
 	      ::rtEdge_ioctl( _cxt, ioctl_setUserPubMsgTy, (void *)_bUserMsgTy );
 	}
 
+	/**
+	 * \brief Batch connectionless UDP publications into MTU-sized packets
+	 *
+	 * Queued packets are sent via sendmmsg() when nPkt are queued or 
+	 * flushUs has elapsed since the 1st one was queued.
+	 *
+	 * \param nPkt - Max packets per sendmmsg(); 0 = 1 message per packet
+	 * \param flushUs - Max micros to hold a partial batch
+	 */
+	void SetUdpBatch( int nPkt, int flushUs=1000 )
+	{
+	   _udpBatch   = nPkt;
+	   _udpFlushUs = flushUs;
+	   if ( IsValid() ) {
+	      ::rtEdge_ioctl( _cxt, ioctl_udpFlushUs, (void *)(size_t)_udpFlushUs );
+	      ::rtEdge_ioctl( _cxt, ioctl_udpBatch, (void *)(size_t)_udpBatch );
+	   }
+	}
+
 	/**
 	 * \brief Requests channel be set in randomize connect mode
 	 *
@@ -501,6 +544,32 @@ public:
 	   return rtn;
 	}
 
+	/**
+	 * \brief Publish many updates with 1 lock and 1 flush
+	 *
+	 * OnOverflow() is called if the outbound queue rejected any of them, 
+	 * not for streams dropped since not opened on an interactive channel.
+	 *
+	 * \param d - Array of filled in rtEdgeData structs to publish
+	 * \param nd - Number of entries in d
+	 * \return  Number of messages published; < nd if overflow or not opened
+	 */
+	int PublishBatch( rtEdgeData *d, int nd )
+	{
+	   rtEdgeChanStats *st;
+	   long             n0;
+	   int              rtn;
+
+	   // Overflow = Queue rejected : rtEdgeChanStats._nOverflow / _nUdpDrop
+
+	   st  = GetStats();
+	   n0  = st ? st->_nOverflow + st->_nUdpDrop : 0;
+	   rtn = ::rtEdge_PublishBatch( _cxt, d, nd );
+	   if ( st && ( st->_nOverflow + st->_nUdpDrop > n0 ) )
+	      OnOverflow();
+	   return rtn;
+	}
+
 	/**
 	 * \brief Publish a Symbol List (BDS)
 	 *
@@ -932,7 +1001,10 @@ private:
 	bool          _bRandom;
 	bool          _bUnPacked;
 	bool          _bCircularBuffer;
+	bool          _bGatherIO;
 	size_t        _hopCnt;
+	int           _udpBatch;
+	int           _udpFlushUs;
 	Update       *_upd;
 
 	////////////////////////////////////
@@ -20,8 +20,16 @@
 *     22 SEP 2022 jcs  Build 56: Rename StartTape() to PumpTape()
 *     22 OCT 2022 jcs  Build 58: ByteStream.Service(); CxtMap
 *     20 JUL 2023 jcs  Build 64: dox : OnData() msg is volatile
+*     17 OCT 2026 jcs  Build 80: Conflate(); DispatchBatch(); OnDataBatch()
+*     17 OCT 2026 jcs  Build 80: PumpTape( nThr ); SetTapeThreads()
+*     17 OCT 2026 jcs  Build 80: SetUdpSubscribe()
+*     17 OCT 2026 jcs  Build 80: PumpTapeSliceSample( ..., bBar, pVolFld )
+*     17 OCT 2026 jcs  Build 80: TapeExport()
+*     17 OCT 2026 jcs  Build 80: SetTapePrefetch()
+*     17 OCT 2026 jcs  Build 80: _IsTape() : Merged tape list / glob
+*     17 OCT 2026 jcs  Build 80: BuildTapeTickerIndex()
 *
-*  (c) 1994-2023, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __RTEDGE_SubChannel_H
 #define __RTEDGE_SubChannel_H
@@ -64,6 +72,7 @@ typedef hash_set<int>               SymLists;
  * --- | --- | ---
  * host:port | rtEdgeCache3 | Streaming real-time data
  * filename | Tape File (64-bit only) | Recorded market data from tape
+ * file1,file2,... or glob | Merged Tape Files (64-bit only) | Recorded market data from all tapes in time order
  *
  * This class ensures that data from both sources - rtEdgeCache3 and Tape 
  * File - is streamed into your application in the exact same manner:
@@ -101,6 +110,10 @@ public:
 	   _bRandom( false ),
 	   _bUsrStreamID( false ),
 	   _bTapeDir( false ),
+	   _nTapeThr( 1 ),
+	   _tapePrefetch( 0 ),
+	   _bUdp( false ),
+	   _udpRfhMs( 0 ),
 	   _msg( (Message *)0 ),
 	   _msgQ( (Message *)0 ),
 	   _msgP( (Message *)0 ),
@@ -109,7 +122,8 @@ public:
 	   _bStrDb(),
 	   _bStrMtx(),
 	   _chainDb(),
-	   _symListDb()
+	   _symListDb(),
+	   _batch()
 	{
 	   SetCache( false );
 	   ::memset( &_attr, 0, sizeof( _attr ) );
@@ -245,6 +259,10 @@ public:
 	   SetUserStreamID( _bUsrStreamID );
 	   SetHeartbeat( _tHbeat );
 	   SetIdleCallback( _bIdleCbk );
+	   if ( _bUdp ) {
+	      ::rtEdge_ioctl( _cxt, ioctl_udpSubscribe, (void *)1 );
+	      ::rtEdge_ioctl( _cxt, ioctl_udpGapRefresh, (void *)(size_t)_udpRfhMs );
+	   }
 	   return ::rtEdge_Start( _cxt );
 	}
 
@@ -262,7 +280,16 @@ public:
 private:
 	bool _IsTape( const char *svr )
 	{
-	   return IsFile( svr );
+	   std::string s( svr );
+	   char       *cp;
+
+	   // Merged : CSV list and / or glob of tapes; Check 1st
+
+	   if ( (cp=(char *)::strchr( s.data(), ',' )) )
+	      *cp = '\0';
+	   if ( ::strpbrk( s.data(), "*?[" ) )
+	      return true;
+	   return IsFile( s.data() );
 	}
 
 	const char *_StartTape( const char *tape )
@@ -293,6 +320,8 @@ private:
 	   _subChans.Add( _cxt, this );
 	   SetIdleCallback( _bIdleCbk );
 	   SetTapeDirection( _bTapeDir );
+	   SetTapeThreads( _nTapeThr );
+	   SetTapePrefetch( _tapePrefetch );
 	   return ::rtEdge_Start( _cxt );
 	}
 #endif // DOXYGEN_OMIT
@@ -313,6 +342,22 @@ public:
 	      Subscribe( pSvrHosts(), _tape_all, (void *)0 );
 	}
 
+	/**
+	 * \brief Pump ALL tickers from the tape on nThr threads
+	 *
+	 * The tape is split into nThr contiguous ranges, each parsed on its own
+	 * thread.  Messages are delivered exactly as PumpTape(): In tape order 
+	 * via OnData() in the library thread for this channel.
+	 *
+	 * \param nThr - Number of parsing threads
+	 * \see SetTapeThreads()
+	 */
+	void PumpTape( int nThr )
+	{
+	   SetTapeThreads( nThr );
+	   PumpTape();
+	}
+
 	/**
 	 * \brief Pump data from the tape between the given start and end times.
 	 *
@@ -356,15 +401,27 @@ public:
 	 *
 	 * String-ified time format is either "YYYYMMDD HH:MM:SS" or "HH:MM:SS"
 	 *
+	 * If bBar is true, each ticker is sampled into OHLC / VWAP bars 
+	 * rather than the LVC:
+	 * + One message per ticker per tInterval in which it updated
+	 * + Delivered on ticker's 1st message in a later interval or end of tape
+	 * + Message time is start of the bar's interval
+	 * + Each field in pFlds as rtBarValue FIDs : ( fid * rtBar_MUL ) + v
+	 * + VWAP weighted by pVolFld from same message; Else by tick
+	 *
 	 * \param tStart - Start time
 	 * \param tEnd - End time
 	 * \param tInterval - Interval in seconds
 	 * \param pFlds - CSV list of Field IDs or Names of interest
+	 * \param bBar - true for OHLC / VWAP bars; false for LVC sample
+	 * \param pVolFld - Volume Field ID or Name for bars; NULL for none
 	 */
 	void PumpTapeSliceSample( const char *tStart,
 	                          const char *tEnd,
 	                          int         tInterval,
-	                          const char *pFlds )
+	                          const char *pFlds,
+	                          bool        bBar    = false,
+	                          const char *pVolFld = (const char *)0 )
 	{
 	   std::string tkr;
 	   char        buf[K];
@@ -384,6 +441,13 @@ public:
 	   tkr += buf;
 	   tkr += "|";
 	   tkr += pFlds ? pFlds : _dflt_fld;
+	   if ( bBar ) {
+	      tkr += "|BAR";
+	      if ( pVolFld ) {
+	         tkr += ":";
+	         tkr += pVolFld;
+	      }
+	   }
 	   if ( _attr._bTape )
 	      Subscribe( pSvrHosts(), tkr.data(), (void *)0 );
 	}
@@ -470,6 +534,59 @@ public:
 	      ::rtEdge_ioctl( _cxt, ioctl_tapeDirection, (void *)_bTapeDir );
 	}
 
+	/**
+	 * \brief Sets the number of threads to parse the tape with when 
+	 * pumping ALL tickers.
+	 *
+	 * Messages are always delivered in tape order via OnData() in the 
+	 * library thread for this channel.  Unordered, per-thread delivery is 
+	 * available from the C API via ioctl_tapeOrdered.
+	 *
+	 * \param nThr - Number of parsing threads; Default is 1
+	 */
+	void SetTapeThreads( int nThr )
+	{
+	   _nTapeThr = nThr;
+	   if ( _cxt ) {
+	      ::rtEdge_ioctl( _cxt, ioctl_tapeThreads, (void *)(size_t)_nTapeThr );
+	      ::rtEdge_ioctl( _cxt, ioctl_tapeOrdered, (void *)1 );
+	   }
+	}
+
+	/**
+	 * \brief Touch tape pages this many bytes ahead of the replay on a 
+	 * background thread when pumping ALL tickers.
+	 *
+	 * \param nByte - Bytes ahead of reader; Default is 0 (DISABLE)
+	 * \see ::ioctl_tapePrefetch
+	 */
+	void SetTapePrefetch( int nByte )
+	{
+	   _tapePrefetch = nByte;
+	   if ( _cxt )
+	      ::rtEdge_ioctl( _cxt, ioctl_tapePrefetch, (void *)(size_t)_tapePrefetch );
+	}
+
+	/**
+	 * \brief Consume Mold64 UDP from a connectionless PubChannel rather 
+	 * than connecting to rtEdgeCache3.
+	 *
+	 * The hosts passed to Start() is then the \<host\>:\<port\> to bind 
+	 * to.  On a sequence gap every open stream receives edg_recovering 
+	 * via OnData(); see rtEdgeChanStats._nUdpGap and _nUdpLost.
+	 *
+	 * CALL THIS BEFORE Start()
+	 *
+	 * \param bUdp - true to consume UDP
+	 * \param gapRefreshMs - Min millis between refresh requests to the 
+	 * publisher on gap; 0 for no refresh
+	 */
+	void SetUdpSubscribe( bool bUdp, int gapRefreshMs=0 )
+	{
+	   _bUdp     = bUdp;
+	   _udpRfhMs = gapRefreshMs;
+	}
+
 	/**
 	 * \brief Return Tape start time in Unix Time; 0 if not tape
 	 *
@@ -825,6 +942,56 @@ public:
 	}
 
 
+	////////////////////////////////////
+	// Conflation
+	////////////////////////////////////
+public:
+	/**
+	 * \brief Enable / Disable conflation in the library.
+	 *
+	 * If enabled, you drive conflated real-time data into your application
+	 * at your own pace via DispatchBatch().
+	 *
+	 * \param bConflate - true to enable; false to disable
+	 */
+	void Conflate( bool bConflate )
+	{
+	   if ( IsValid() )
+	      ::rtEdge_Conflate( _cxt, bConflate ? 1 : 0 );
+	}
+
+	/**
+	 * \brief Drain up to maxUpd conflated updates in a single call and 
+	 * deliver them into OnDataBatch().
+	 *
+	 * Only valid if conflation has been enabled via Conflate().
+	 *
+	 * \param maxUpd - Max num updates to drain
+	 * \param dWait - Max seconds to wait if no conflated updates are pending
+	 * \return Number of updates delivered into OnDataBatch()
+	 * \see OnDataBatch()
+	 */
+	int DispatchBatch( int maxUpd, double dWait )
+	{
+	   rtEdgeData *ddb;
+	   int         nu;
+
+	   // Pre-condition
+
+	   if ( !IsValid() || ( maxUpd <= 0 ) )
+	      return 0;
+
+	   // Drain; Deliver
+
+	   if ( (int)_batch.size() < maxUpd )
+	      _batch.resize( maxUpd );
+	   ddb = _batch.data();
+	   if ( (nu=::rtEdge_DispatchBatch( _cxt, ddb, maxUpd, dWait )) )
+	      OnDataBatch( ddb, nu );
+	   return nu;
+	}
+
+
 	////////////////////////////////////
 	// Parse Only
 	////////////////////////////////////
@@ -917,6 +1084,42 @@ public:
 	   return 0;
 	}
 
+	/**
+	 * \brief Export tape slice to memory-mappable columnar file
+	 *
+	 * Runs synchronously; See rtEdge_TapeExport() for file layout.
+	 *
+	 * \param pFile - Output filename
+	 * \param tStart - Start time; NULL for start of tape
+	 * \param tEnd - End time; NULL for end of tape
+	 * \param pTkrs - Comma-separated tickers; NULL for all
+	 * \param pFlds - Comma-separated Field IDs or Names
+	 * \return Number of rows exported; 0 if error or tape is busy
+	 */
+	u_int64_t TapeExport( const char *pFile,
+	                      const char *tStart,
+	                      const char *tEnd,
+	                      const char *pTkrs,
+	                      const char *pFlds )
+	{
+	   if ( IsValid() )
+	      return ::rtEdge_TapeExport( _cxt, pFile, tStart, tEnd, pTkrs, pFlds );
+	   return 0;
+	}
+
+	/**
+	 * \brief Build per-ticker index for tape, if missing or stale.
+	 *
+	 * Runs synchronously; Refused while tape is pumping or exporting.
+	 *
+	 * \see ::ioctl_tapeTickerIndex
+	 */
+	void BuildTapeTickerIndex()
+	{
+	   if ( IsValid() )
+	      ::rtEdge_ioctl( _cxt, ioctl_tapeTickerIndex, (void *)0 );
+	}
+
 
 	////////////////////////////////////
 	// Asynchronous Callbacks
@@ -964,6 +1167,24 @@ protected:
 	virtual void OnData( Message &msg )
 	{ ; }
 
+	/**
+	 * \brief Called from DispatchBatch() with a burst of conflated updates.
+	 *
+	 * Each rtEdgeData contains only those fields that have changed since 
+	 * the record was last dispatched.  The array is valid until your next 
+	 * call to DispatchBatch().
+	 *
+	 * Override this method to process the whole burst in one pass; The 
+	 * default implementation delivers each update into OnData().
+	 *
+	 * \param ddb - Array of conflated updates
+	 * \param nUpd - Number of updates in ddb
+	 */
+	virtual void OnDataBatch( rtEdgeData *ddb, int nUpd )
+	{
+	   for ( int i=0; i<nUpd; _OnData( ddb[i++] ) );
+	}
+
 	/**
 	 * \brief Called asynchronously when the real-time market data stream
 	 * is recovering
@@ -1136,6 +1357,10 @@ private:
 	bool         _bRandom;
 	bool         _bUsrStreamID;
 	bool         _bTapeDir;
+	int          _nTapeThr;
+	int          _tapePrefetch;
+	bool         _bUdp;
+	int          _udpRfhMs;
 	Message     *_msg;
 	Message     *_msgQ;     // QueryCache()
 	Message     *_msgP;     // Parse()
@@ -1148,6 +1373,7 @@ private:
 	Chains       _chainDb;
 	SymLists     _symListDb;
 	::MDDResult  _qryAll;
+	std::vector<rtEdgeData> _batch; // DispatchBatch()
 
 
 	////////////////////////////////////
@@ -33,8 +33,10 @@
 *      4 MAR 2024 jcs  Build 69: XxxBufferedIO()
 *     24 APR 2024 jcs  Build 71: unix2rtDateTime() crash : WIN64
 *     19 FEB 2025 jcs  Build 75: pDateTimeUs(); SetLowLatency(); ClockNs()
+*     17 OCT 2026 jcs  Build 80: SetNonBlockingIO(); SetBusyPoll()
+*     17 OCT 2026 jcs  Build 80: SetSharedPump()
 *
-*  (c) 1994-2025, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __RTEDGE_rtEdge_H
 #define __RTEDGE_rtEdge_H
@@ -241,6 +243,17 @@ public:
 	   ::rtEdge_Log( pLog, dbgLvl );
 	}
 
+	/**
+	 * \brief Run channels created from here on in one shared library thread.
+	 *
+	 * \param bShared - true to share one pump thread
+	 * \see ::rtEdge_SetSharedPump()
+	 */
+	static void SetSharedPump( bool bShared )
+	{
+	   ::rtEdge_SetSharedPump( bShared ? 1 : 0 );
+	}
+
 	/**
 	 * \brief Returns clock counter to mike granularity
 	 *
@@ -1184,6 +1197,45 @@ public:
 	   ::rtEdge_ioctl( _cxt, ioctl_lowLatency, (void *)arg );
 	}
 
+	/**
+	 * \brief Keeps channel socket non-blocking for its whole life
+	 *
+	 * Reads / writes use MSG_DONTWAIT rather than toggling O_NONBLOCK
+	 * around each one.  See rtEdgeChanStats._nFcntl.
+	 *
+	 * CALL THIS AFTER CHANNEL IS INITIALIZED
+	 *
+	 * \param bNonBlk - true to enable; default is false
+	 */
+	void SetNonBlockingIO( bool bNonBlk )
+	{
+	   ::int64_t arg;
+
+	   arg = bNonBlk ? 1 : 0;
+	   ::rtEdge_ioctl( _cxt, ioctl_nonBlockingIO, (void *)arg );
+	}
+
+	/**
+	 * \brief Sets / Clears busy-poll receive on channel thread
+	 *
+	 * Channel thread spins on non-blocking recv(); Burns 1 core.  Pin 
+	 * it via SetThreadProcessor().
+	 *
+	 * CALL THIS AFTER CHANNEL IS INITIALIZED
+	 *
+	 * \param bSpin - true to spin; default is false
+	 * \param busyPollUs - SO_BUSY_POLL microseconds; 0 = Not set
+	 */
+	void SetBusyPoll( bool bSpin, int busyPollUs=0 )
+	{
+	   ::int64_t arg;
+
+	   arg = busyPollUs;
+	   ::rtEdge_ioctl( _cxt, ioctl_busyPollUs, (void *)arg );
+	   arg = bSpin ? 1 : 0;
+	   ::rtEdge_ioctl( _cxt, ioctl_busyPoll, (void *)arg );
+	}
+
 
 	////////////////////////////////////
 	// Access / Operations - Worker Thread
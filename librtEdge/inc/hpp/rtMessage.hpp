@@ -17,6 +17,7 @@
 *     30 OCT 2022 jcs  Build 60: rtFld_vector
 *      6 DEC 2023 jcs  Build 67: volatile GetField()
 *      6 MAR 2026 jcs  Build 78: Dump() : flds / bytes
+*     17 OCT 2026 jcs  Build 80: GetField( int ) : Dense FidOffs; _offsSparse
 *
 *  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
@@ -26,9 +27,24 @@
 
 typedef hash_map<int, int> IntMap;
 
+#define _MSG_DENSE_FID 64*K
+
 namespace RTEDGE
 {
 
+#ifndef DOXYGEN_OMIT
+/**
+ * \struct FidOff
+ * \brief Field offset in Message : Valid if _gen == Message generation
+ */
+typedef struct {
+	u_int _gen;
+	int   _off;
+} FidOff;
+
+typedef std::vector<FidOff> FidOffs;
+#endif // DOXYGEN_OMIT
+
 // Forward Declarations
 
 class LVC;
@@ -72,10 +88,12 @@ protected:
 	   _itr( -1 ),
 	   _data( (rtEdgeData *)0 ),
 	   _dataLVC( (LVCData *)0 ),
-	   _offsLVC(),
+	   _fidOffs(),
+	   _offsSparse(),
+	   _fidGen( 0 ),
+	   _bFidMap( false ),
 	   _schema( (mddFieldList *)0 ),
-	   _dump(),
-	   _parseFids( (IntMap *)0 )
+	   _dump()
 	{
 	   rtFIELD _z;
 
@@ -85,7 +103,6 @@ protected:
 
 	virtual ~Message()
 	{
-	   _ClearFidMap();
 	}
 
 	/**
@@ -99,8 +116,7 @@ protected:
 	   _data    = data;
 	   _dataLVC = (LVCData *)0;
 	   _schema  = schema;
-	   _offsLVC.clear();
-	   _BuildFidMap();
+	   _bFidMap = false;
 	   reset();
 	   return *this;
 	}
@@ -116,7 +132,7 @@ protected:
 	   _data    = (rtEdgeData *)0;
 	   _dataLVC = data;
 	   _schema  = schema;
-	   _offsLVC.clear();
+	   _bFidMap = false;
 	   reset();
 	   return *this;
 	}
@@ -124,13 +140,12 @@ protected:
 	/**
 	 * \brief Called by Tape-based SubChannel.Parse() 
 	 *
-	 * \param bParseOnly - true to set; false to disable 
+	 * No-op : GetField() always searches this message's FID table.
+	 *
+	 * \param bParseOnly - Ignored
 	 */ 
 	void SetParseOnly( bool bParseOnly )
 	{
-	   if ( _parseFids )
-	      delete _parseFids;
-	   _parseFids = bParseOnly ? new IntMap() : (IntMap *)0;
 	}
 
 
@@ -685,54 +700,41 @@ public:
 	 */
 	Field *GetField( int fid )
 	{
-	   IntMap          &odb = _offsLVC;
 	   IntMap::iterator it;
-	   bool             bOK;
-	   rtFIELD         *fdb, f;
-	   size_t           no;
-	   int              i, nf, off, ix;
+	   rtFIELD          f;
+	   int              off;
+
+	   // Pre-condition
+
+	   if ( !_data && !_dataLVC )
+	      return (Field *)0;
 
-	   // Build _offsLVC once, then search
+	   // Build FID table once per message, then search
+
+	   if ( !_bFidMap )
+	      _BuildFidMap();
+	   off = -1;
+	   if ( InRange( 0, fid, (int)_fidOffs.size()-1 ) ) {
+	      FidOff &fo = _fidOffs[fid];
+
+	      off = ( fo._gen == _fidGen ) ? fo._off : -1;
+	   }
+	   else if ( (it=_offsSparse.find( fid )) != _offsSparse.end() )
+	      off = (*it).second;
+	   if ( off < 0 )
+	      return (Field *)0;
+
+	   // Found
 
-	   bOK = false;
 	   if ( _data ) {
-	      if ( _parseFids ) {
-	         IntMap &idb = *_parseFids;
-
-	         bOK = ( (it=idb.find( fid )) != idb.end() );
-	         if ( bOK ) {
-	            off = (*it).second;
-	            fdb = _data->_flds;
-	            nf  = _data->_nFld;
-	            f   = fdb[off];
-	            _fld.Set( *this, false, _cxt, f, f._type );
-	         }
-	      }
-	      else
-	         bOK = ( _fld.Get( fid ).Fid() != 0 );
+	      f = _data->_flds[off];
+	      _fld.Set( *this, false, _cxt, f, f._type );
 	   }
-	   else if ( _dataLVC ) {
-	      /*
-	       * Once per message
-	       */
-	      fdb = _dataLVC->_flds;
-	      nf  = _dataLVC->_nFld;
-	      no  = odb.size();
-	      for ( i=0; !no && i<nf; i++ ) {
-	         ix      = fdb[i]._fid;
-	         odb[ix] = i;
-	      }
-	      /*
-	       * Query
-	       */
-	      bOK = ( (it=odb.find( fid )) != odb.end() );
-	      if ( bOK ) {
-	         off = (*it).second;
-	         f   = fdb[off];
-	         _fld.Set( *this, true, f );
-	      }
+	   else {
+	      f = _dataLVC->_flds[off];
+	      _fld.Set( *this, true, f );
 	   }
-	   return bOK ? &_fld : (Field *)0;
+	   return &_fld;
 	}
 
 
@@ -742,29 +744,38 @@ public:
 private:
 	void _BuildFidMap()
 	{
-	   int i, fid;
-
-	   // Pre-condition
-
-	   if ( !_parseFids || !_data )
-	      return;
-
-	   // OK to continue
-
-	   IntMap     &idb = *_parseFids;
-	   rtEdgeData &d  = *_data;
-
-	   _ClearFidMap();
-	   for ( i=0; i<d._nFld; i++ ) {
-	      fid      = d._flds[i]._fid;
-	      idb[fid] = i;
+	   rtFIELD *fdb;
+	   FidOff   fo, fz;
+	   size_t   j;
+	   int      i, nf, fid;
+
+	   /*
+	    * Once per message : Dense by FID in [ 0, _MSG_DENSE_FID );
+	    * Negative and sparse FIDs into _offsSparse.  Bumping _fidGen 
+	    * invalidates all of _fidOffs[] from the previous message.
+	    */
+	   fdb = _data ? _data->_flds : _dataLVC->_flds;
+	   nf  = _data ? _data->_nFld : _dataLVC->_nFld;
+	   ::memset( &fz, 0, sizeof( fz ) );
+	   if ( !(++_fidGen) ) {
+	      for ( j=0; j<_fidOffs.size(); _fidOffs[j++] = fz );
+	      _fidGen = 1;
 	   }
-	}
-
-	void _ClearFidMap()
-	{
-	   if ( _parseFids )
-	      _parseFids->clear();
+	   if ( _offsSparse.size() )
+	      _offsSparse.clear();
+	   fo._gen = _fidGen;
+	   for ( i=0; i<nf; i++ ) {
+	      fid     = fdb[i]._fid;
+	      fo._off = i;
+	      if ( InRange( 0, fid, _MSG_DENSE_FID-1 ) ) {
+	         if ( fid >= (int)_fidOffs.size() )
+	            _fidOffs.resize( fid+1, fz );
+	         _fidOffs[fid] = fo;
+	      }
+	      else
+	         _offsSparse[fid] = i;
+	   }
+	   _bFidMap = true;
 	}
 
 
@@ -777,10 +788,12 @@ private:
 	int            _itr;
 	rtEdgeData    *_data;
 	LVCData       *_dataLVC;
-	IntMap         _offsLVC;
+	FidOffs        _fidOffs;
+	IntMap         _offsSparse;
+	u_int          _fidGen;
+	bool           _bFidMap;
 	mddFieldList  *_schema;
 	std::string    _dump;
-	IntMap        *_parseFids;
 
 };  // class Message
 
@@ -28,8 +28,25 @@
 *      9 SEP 2024 jcs  Build 73: LVCStatMon.hpp
 *      7 NOV 2024 jcs  Build 74: ioctl_setRawLog
 *     19 FEB 2025 jcs  Build 75: rtEdge_ClockNs()
+*     17 OCT 2026 jcs  Build 80: rtEdge_DispatchBatch(); LVC_SetSnapThreads(); LVC_SetArena(); LVC_SnapSince()
+*     17 OCT 2026 jcs  Build 80: LVC_SetLockFree()
+*     17 OCT 2026 jcs  Build 80: ioctl_tapeTickerIndex
+*     17 OCT 2026 jcs  Build 80: ioctl_tapeThreads; ioctl_tapeOrdered
+*     17 OCT 2026 jcs  Build 80: ioctl_nonBlockingIO; rtEdgeChanStats._nRdCall, et al
+*     17 OCT 2026 jcs  Build 80: ioctl_busyPoll; ioctl_busyPollUs
+*     17 OCT 2026 jcs  Build 80: ioctl_udpBatch; ioctl_udpFlushUs; _nUdpPkt / _nUdpMsg
+*     17 OCT 2026 jcs  Build 80: ioctl_udpSubscribe; ioctl_udpGapRefresh; _nUdpGap / _nUdpLost
+*     17 OCT 2026 jcs  Build 80: ioctl_udpRecvBatch; _nUdpDrop
+*     17 OCT 2026 jcs  Build 80: ioctl_gatherIO; _nOutCopy
+*     17 OCT 2026 jcs  Build 80: rtEdge_PublishBatch()
+*     17 OCT 2026 jcs  Build 80: rtBarValue
+*     17 OCT 2026 jcs  Build 80: rtEdge_TapeExport(); rtColumn, et al; COL_EXP_SIG
+*     17 OCT 2026 jcs  Build 80: ioctl_tapePrefetch; _nMinFlt / _nMajFlt; LVC_SetPopulate()
+*     17 OCT 2026 jcs  Build 80: rtEdge_SetSharedPump()
+*     17 OCT 2026 jcs  Build 80: rtEdgeAttr._pSvrHosts : Merged tapes; 1st tape only
+*     17 OCT 2026 jcs  Build 80: rtEdgeChanStats._nOverflow
 *
-*  (c) 1994-2025, Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 
 /**
@@ -512,6 +529,176 @@ typedef enum {
     * \param (void *)val - 1 to ENABLE; Default is 0 (DISABLE)
     */
    ioctl_lowLatency        = 40,
+   /**
+    * \brief Build per-ticker index for tape, if missing or stale.
+    *
+    * The index is stored alongside the tape as <tape>.tkr and holds the
+    * tape offsets of every message for every ticker, oldest first.  When 
+    * present, Subscribe() replays a ticker by scanning forward through 
+    * these offsets rather than following each message's back-pointer.  
+    * Messages written to a live tape after the index was built are found
+    * by walking back-pointers as far as the end of the index.
+    *
+    * Call after rtEdge_Start().  An existing, valid <tape>.tkr is always 
+    * used; this is only needed to create or refresh it.  Refused while 
+    * the tape is pumping or exporting; the reason is logged via 
+    * rtEdge_Log().  The TapeTkrIdx tool builds it from the command line.
+    *
+    * \param (void *)val - Ignored
+    */
+   ioctl_tapeTickerIndex   = 41,
+   /**
+    * \brief Number of threads to replay the whole tape with
+    *
+    * Applies when you pump ALL tickers - i.e., you did not Subscribe() to
+    * any.  The tape is split into contiguous byte ranges on the tape's 
+    * time index boundaries, and each range is parsed on its own thread.
+    * See ioctl_tapeOrdered for how the messages are delivered.
+    *
+    * \param (void *)val - Number of threads; Default is 1
+    */
+   ioctl_tapeThreads       = 42,
+   /**
+    * \brief Message delivery when ioctl_tapeThreads > 1
+    *
+    * Ordered | Delivered From | Order
+    * --- | --- | ---
+    * 1 | Library thread | Tape order, as single-threaded
+    * 0 | Each replay thread | Tape order within a range; Ranges concurrent
+    *
+    * Sampled tape slices - rtEdge_Subscribe() with tInterval - are always 
+    * ordered.  Your data callback must be thread-safe when unordered.
+    *
+    * \param (void *)val - 1 for ordered; 0 for unordered; Default is 1
+    */
+   ioctl_tapeOrdered       = 43,
+   /**
+    * \brief Keep channel socket non-blocking for its whole life
+    *
+    * Mode | Per Read / Write
+    * --- | ---
+    * DISABLE | fcntl( O_NONBLOCK ), read() / write(), fcntl( restore )
+    * ENABLE | recv( MSG_DONTWAIT ) / send( MSG_DONTWAIT | MSG_NOSIGNAL )
+    *
+    * connect() remains blocking; O_NONBLOCK is set once it completes.
+    * Use rtEdgeChanStats._nRdCall, _nWrCall and _nFcntl to see the 
+    * system calls saved.
+    *
+    * \param (void *)val - 1 to ENABLE; Default is 0 (DISABLE)
+    */
+   ioctl_nonBlockingIO     = 44,
+   /**
+    * \brief Busy-poll receive : Channel thread spins; Never sleeps
+    *
+    * The channel thread calls non-blocking recv() on the channel socket 
+    * in a tight loop; No poll() / epoll_wait().  Timers are driven from
+    * the loop via rtEdge_ClockNs().  Implies ioctl_nonBlockingIO.
+    *
+    * This burns 100% of a core : Pin it with ioctl_setThreadProcessor.
+    * Add ioctl_busyPollUs to have the kernel spin on the device queue too.
+    *
+    * \param (void *)val - 1 to ENABLE; Default is 0 (DISABLE)
+    */
+   ioctl_busyPoll          = 45,
+   /**
+    * \brief SO_BUSY_POLL microseconds on channel socket; Linux only
+    *
+    * Applied now, if connected, and on every (re-)connect.  Values above
+    * /proc/sys/net/core/busy_read may require CAP_NET_ADMIN.
+    *
+    * \param (void *)val - Microseconds; Default is 0 (Not set)
+    */
+   ioctl_busyPollUs        = 46,
+   /**
+    * \brief Connectionless publication : Mold64 packets per sendmmsg()
+    *
+    * Messages are packed into Mold64 packets up to the 1500 byte MTU, each
+    * prefixed by a 2-byte length.  Packets are sent in one sendmmsg() when
+    * val packets have filled or ioctl_udpFlushUs has elapsed.  A message 
+    * too big for 1 packet flushes the batch and is sent alone.
+    *
+    * \param (void *)val - Max packets per flush; Default is 0 (1 sendto() 
+    * per message)
+    */
+   ioctl_udpBatch          = 47,
+   /**
+    * \brief Connectionless publication : Max time a message is queued
+    *
+    * Checked on each publish and on the channel idle timer.
+    *
+    * \param (void *)val - Microseconds; Default is 1000
+    */
+   ioctl_udpFlushUs        = 48,
+   /**
+    * \brief Subscription channel consumes Mold64 UDP from a connectionless
+    * publisher rather than connecting to rtEdgeCache3
+    *
+    * rtEdgeAttr._pSvrHosts is \<host\>:\<port\>; The channel bind()'s
+    * to port and tracks Mold64 sequence numbers per session.  On a gap 
+    * every open stream receives edg_recovering and rtEdgeChanStats._nUdpGap
+    * and _nUdpLost are bumped.  Streams are mapped to the publisher by 
+    * ticker name via its stream ID announcements.
+    *
+    * Must be called BEFORE rtEdge_Start().
+    *
+    * \param (void *)val - 1 to ENABLE; Default is 0 (DISABLE)
+    */
+   ioctl_udpSubscribe      = 49,
+   /**
+    * \brief ioctl_udpSubscribe : Request refresh from publisher on gap
+    *
+    * The channel sends \<GetCache/\> to the publisher, which re-announces
+    * its stream IDs and calls rtEdgePubAttr._imgQryCbk for each stream.
+    * Each request refreshes every stream, so val throttles them.
+    *
+    * \param (void *)val - Min millis between requests; Default is 0 
+    * (DISABLE)
+    */
+   ioctl_udpGapRefresh     = 50,
+   /**
+    * \brief ioctl_udpSubscribe : Datagrams per recvmmsg()
+    *
+    * Up to val datagrams are pulled per system call into a pre-allocated
+    * packet ring and processed in place; The channel drains until the
+    * socket is empty.  Enables SO_RXQ_OVFL so datagrams dropped by the 
+    * kernel are reported in rtEdgeChanStats._nUdpDrop.  Linux only; 
+    * Other platforms loop on recvfrom().
+    *
+    * \param (void *)val - Max datagrams per call; Default is 0 (1 recv() 
+    * per wakeup)
+    */
+   ioctl_udpRecvBatch      = 51,
+   /**
+    * \brief Outbound queue of build buffer references flushed via writev()
+    *
+    * Each published message is queued by reference to the buffer it was
+    * built in - no copy into the outbound buffer - and the channel builds 
+    * the next one into a pooled buffer.  Up to 1024 queued messages go
+    * out per writev().  Partial writes advance an offset rather than 
+    * moving unsent bytes to the front of the buffer.  Compare 
+    * rtEdgeChanStats._nOutCopy to _nByte to see the bytes copied per 
+    * byte sent.
+    *
+    * Must be called BEFORE rtEdge_PubStart() and ioctl_setRawLog; 
+    * Supersedes rtEdgePubAttr._bCircularBuffer.
+    *
+    * \param (void *)val - 1 to ENABLE; Default is 0 (DISABLE)
+    */
+   ioctl_gatherIO          = 52,
+   /**
+    * \brief Background thread touches tape pages ahead of the replay
+    *
+    * Applies when you pump ALL tickers.  The thread faults in the tape val
+    * bytes ahead of the reader, so a cold replay does not stall on disk.
+    * With ioctl_tapeThreads, each replay thread prefetches its own range.
+    * The tape is always advised sequential when pumping all tickers and 
+    * random when following a ticker's back-pointers.  See 
+    * rtEdgeChanStats._nMinFlt and _nMajFlt for the replay's page faults.
+    *
+    * \param (void *)val - Bytes to stay ahead of reader; Default is 0 
+    * (DISABLE)
+    */
+   ioctl_tapePrefetch      = 53,
 } rtEdgeIoctl;
 
 /**
@@ -610,6 +797,118 @@ typedef struct {
    char        _vPrecision;
 } rtFIELD;
 
+/**
+ * \enum rtBarValue
+ * \brief Bar value from a tape slice pumped in bar mode
+ *
+ * Each interval, one message per ticker carries bar value v of each
+ * requested field fid as FID ( fid * rtBar_MUL ) + v.  Name is 
+ * <FieldName>_OPEN, <FieldName>_HIGH, etc.
+ */
+typedef enum {
+   /** \brief First value in interval */
+   rtBar_open   = 0,
+   /** \brief Highest value in interval */
+   rtBar_high   = 1,
+   /** \brief Lowest value in interval */
+   rtBar_low    = 2,
+   /** \brief Last value in interval */
+   rtBar_close  = 3,
+   /** \brief Sum of volume field from messages updating this field */
+   rtBar_volume = 4,
+   /** \brief Volume-weighted average; Tick-weighted if no volume field */
+   rtBar_VWAP   = 5,
+   /** \brief Number of updates in interval */
+   rtBar_count  = 6,
+   /** \brief FID multiplier : FID = ( fid * rtBar_MUL ) + rtBarValue */
+   rtBar_MUL    = 10
+} rtBarValue;
+
+/**
+ * \enum rtColType
+ * \brief Column type in file from rtEdge_TapeExport()
+ *
+ * Every column is rtColFooter._nRow 8-byte cells
+ */
+typedef enum {
+   /** \brief double : Message time in Unix seconds */
+   rtCol_time   = 0,
+   /** \brief int64_t : Index into rtColTicker table */
+   rtCol_tkrID  = 1,
+   /** \brief int64_t : From rtFld_int, rtFld_int64, et al */
+   rtCol_int64  = 2,
+   /** \brief double : From rtFld_double, rtFld_date, rtFld_time, et al */
+   rtCol_double = 3,
+   /** \brief int64_t : Offset of NULL-terminated string in column heap */
+   rtCol_string = 4
+} rtColType;
+
+/**
+ * \struct rtColumn
+ * \brief One column in file from rtEdge_TapeExport()
+ *
+ * Field values are forward-filled per ticker : Row holds the last value 
+ * of the field for that ticker as of the row time.  Bit r of the set 
+ * bitmap is on if row r carried the field.
+ */
+typedef struct {
+   /** \brief Column name : Field name, or Time / Ticker */
+   char      _name[32];
+   /** \brief Field ID; 0 for rtCol_time and rtCol_tkrID */
+   int       _fid;
+   /** \brief Column type */
+   rtColType _type;
+   /** \brief File offset of _nRow 8-byte cells */
+   u_int64_t _off;
+   /** \brief File offset of ( _nRow+7 ) / 8 byte set bitmap */
+   u_int64_t _setOff;
+   /** \brief File offset of string heap; 0 if not rtCol_string */
+   u_int64_t _heapOff;
+   /** \brief String heap length */
+   u_int64_t _heapLen;
+} rtColumn;
+
+/**
+ * \struct rtColTicker
+ * \brief One entry in ticker table in file from rtEdge_TapeExport()
+ */
+typedef struct {
+   /** \brief Tape StreamID */
+   int  _StreamID;
+   /** \brief Number of rows for this ticker */
+   int  _nRow;
+   /** \brief Service name */
+   char _svc[64];
+   /** \brief Ticker name */
+   char _tkr[248];
+} rtColTicker;
+
+/** \brief rtColFooter._signature */
+#define COL_EXP_SIG "001 COL-EXPORT"
+
+/**
+ * \struct rtColFooter
+ * \brief Footer : Last bytes of file from rtEdge_TapeExport()
+ */
+typedef struct {
+   /** \brief COL_EXP_SIG */
+   char      _signature[16];
+   /** \brief Number of rows */
+   u_int64_t _nRow;
+   /** \brief File offset of _nCol rtColumn's */
+   u_int64_t _colOff;
+   /** \brief File offset of _nTkr rtColTicker's */
+   u_int64_t _tkrOff;
+   /** \brief Number of columns : Time, Ticker, then 1 per field */
+   int       _nCol;
+   /** \brief Number of tickers */
+   int       _nTkr;
+   /** \brief Time of first row */
+   double    _t0;
+   /** \brief Time of last row */
+   double    _t1;
+} rtColFooter;
+
 /**
  * \enum rtEdgeType
  * \brief Type of message in rtEdgeData
@@ -735,7 +1034,34 @@ typedef struct {
    /** \brief Total number of connections since startup */
    int    _nConn;
    /** \brief Reserved for future use */
-   long   _iVal[20];
+   long   _iVal[9];
+   /** \brief Num read system calls on channel socket */
+   long   _nRdCall;
+   /** \brief Num write system calls on channel socket */
+   long   _nWrCall;
+   /** \brief Num fcntl() system calls toggling O_NONBLOCK */
+   long   _nFcntl;
+   /** \brief Num UDP packets sent (PUBLISH) or received (SUBSCRIBE) */
+   long   _nUdpPkt;
+   /** \brief Num messages in UDP packets sent or received */
+   long   _nUdpMsg;
+   /** \brief Num Mold64 sequence gaps (ioctl_udpSubscribe) */
+   long   _nUdpGap;
+   /** \brief Num messages lost in Mold64 sequence gaps */
+   long   _nUdpLost;
+   /** 
+    * \brief Num UDP packets not sent (PUBLISH) or dropped by kernel : 
+    * SO_RXQ_OVFL (SUBSCRIBE) 
+    */
+   long   _nUdpDrop;
+   /** \brief Num bytes copied or moved in the outbound buffer */
+   long   _nOutCopy;
+   /** \brief Minor page faults on replay thread during last tape replay */
+   long   _nMinFlt;
+   /** \brief Major page faults on replay thread during last tape replay */
+   long   _nMajFlt;
+   /** \brief Num messages rejected by full outbound queue (PUBLISH) */
+   long   _nOverflow;
    /** \brief Reserved for future use */
    double _dVal[20];
    /** \brief Channel name - SUBSCRIBE or PUBLISH */
@@ -880,6 +1206,8 @@ typedef struct {
    char       *_copy;
    /** \brief 1 if binary LVC file; 0 if MF (ASCII Field List) */
    char     _bBinary;
+   /** \brief 1 if _flds and _copy are carved from LVCDataAll._arena */
+   char     _bArena;
 } LVCData;
 
 /**
@@ -897,6 +1225,20 @@ typedef struct {
    double   _dSnap;
    /** \brief 1 if binary LVC file; 0 if MF (ASCII Field List) */
    char     _bBinary;
+   /** 
+    * \brief Chain of large blocks holding all _tkrs field lists and copies
+    *
+    * Set with LVC_SetArena(); NULL if not enabled.
+    */
+   char    *_arena;
+   /** 
+    * \brief Unix time (with microseconds) this result is current to.
+    *
+    * Newest record update or drop time in the LVC when snapped - not the
+    * reader's clock.  Pass to LVC_SnapSince() to get only records updated
+    * after this one.
+    */
+   double   _tWatermark;
 } LVCDataAll;
 
 
@@ -1188,7 +1530,7 @@ typedef struct {
      * _bTape | _pSvrHosts
      * --- | ---
      * 0 | Comma separated list of rtEdgeCache3 servers
-     * 1 | Filename of gateaRecorder tape
+     * 1 | Filename of gateaRecorder tape, or list of tapes to merge
      */
    char          _bTape;
    /** 
@@ -1197,7 +1539,13 @@ typedef struct {
      * _bTape | _pSvrHosts
      * --- | ---
      * 0 | Comma separated list of rtEdgeCache3 servers as host1:port1,host2:port2,...
-     * 1 | Filename of gateaRecorder tape
+     * 1 | Filename of gateaRecorder tape; Comma separated list and / or glob of tapes to merge by message time
+    *
+    * Merged tapes are replayed in message time order thru one channel.  
+    * StreamID's are common across tapes, keyed by service and ticker.  
+    * The field dictionary is from the 1st tape.  Message offsets are 
+    * per-tape, so rtEdge_StartPumpFullTape( off0, nMsg ) and 
+    * rtEdge_TapeExport() cover the 1st tape only.
     */
    const char   *_pSvrHosts;
    /** \brief rtEdgeCache3 Username */ 
@@ -1289,6 +1637,24 @@ typedef struct {
  * Initialization, etc *
  **********************/
 
+/**
+ * \brief Run channels created from here on in one shared library thread.
+ *
+ * By default each subscription, publication and Cockpit channel runs its
+ * own event pump thread.  When shared, all channels created after this 
+ * call are pumped by a single library thread; On Linux, this pump 
+ * switches from poll() to epoll() once it carries 8 or more channels.
+ *
+ * Caveats :
+ * -# A slow callback on one channel delays all other shared channels.
+ * -# ioctl_setThreadProcessor and ioctl_setThreadName apply to the 
+ * shared thread, and thus to every shared channel.
+ * -# Channels created before this call keep their own thread.
+ *
+ * \param bShared - 1 to share one pump thread; 0 for thread per channel
+ */
+void rtEdge_SetSharedPump( char bShared );
+
 /**
  * \brief Initialize the rtEdgeCache3 subscription channel connection
  *
@@ -1585,6 +1951,32 @@ void rtEdge_Conflate( rtEdge_Context cxt, char enable );
  */
 int rtEdge_Dispatch( rtEdge_Context cxt, int maxUpd, double dWait );
 
+/**
+ * \brief "Pull" up to maxUpd conflated updates into your application 
+ * in a single call.
+ *
+ * This only works if conflation has been enabled via rtEdge_Conflate().
+ *
+ * The conflated updates are drained from the library in bulk and returned 
+ * in the ddb array.  Each rtEdgeData contains only those fields that have 
+ * changed since the record was last dispatched to you.  Connection, service 
+ * and schema events are delivered inline into the callbacks you registered 
+ * in rtEdge_Initialize().
+ *
+ * The rtEdgeData._flds in ddb are valid until your next call to 
+ * rtEdge_DispatchBatch(), rtEdge_Dispatch() or rtEdge_Read().
+ *
+ * \param cxt - Subscription Channel Context from rtEdge_Initialize()
+ * \param ddb - Caller-supplied array of at least maxUpd rtEdgeData's
+ * \param maxUpd - Max num updates to return in ddb
+ * \param dWait - Max seconds to wait if no conflated updates are pending
+ * \return Number of updates returned in ddb
+ */
+int rtEdge_DispatchBatch( rtEdge_Context cxt, 
+                          rtEdgeData    *ddb, 
+                          int            maxUpd, 
+                          double         dWait );
+
 /**
  * \brief "Pull" 1 conflated update into your application.
  *
@@ -1664,6 +2056,33 @@ int rtEdge_StartPumpFullTape( rtEdge_Context cxt, u_int64_t off0, int nMsg );
  */
 int rtEdge_StopPumpFullTape( rtEdge_Context cxt, int pumpID );
 
+/**
+ * \brief Export tape slice to memory-mappable columnar file
+ *
+ * The file holds one column for message time, one for ticker ID and 
+ * one typed column per field, followed by the rtColTicker table, the 
+ * rtColumn directory and the rtColFooter.  Map the file via 
+ * rtEdge_MapFile(), find the rtColFooter at the end and scan columns 
+ * in place.
+ *
+ * Runs synchronously in the calling thread; Fails if tape is pumping.
+ *
+ * \param cxt - Subscription Channel Context from rtEdge_Initialize()
+ * \param pFile - Output filename
+ * \param tStart - Start time as YYYYMMDD HH:MM:SS or HH:MM:SS; NULL for start of tape
+ * \param tEnd - End time as YYYYMMDD HH:MM:SS or HH:MM:SS; NULL for end of tape
+ * \param pTkrs - Comma-separated tickers; NULL for all
+ * \param pFlds - Comma-separated Field IDs or Names
+ * \return Number of rows exported; 0 if none, error or tape is busy.  Errors
+ * are logged via rtEdge_Log().
+ */
+u_int64_t rtEdge_TapeExport( rtEdge_Context cxt,
+                             const char    *pFile,
+                             const char    *tStart,
+                             const char    *tEnd,
+                             const char    *pTkrs,
+                             const char    *pFlds );
+
 
 
 /****************
@@ -1715,6 +2134,22 @@ void rtEdge_PubDestroy( rtEdge_Context cxt );
  */
 int rtEdge_Publish( rtEdge_Context cxt, rtEdgeData data );
 
+/**
+ * \brief Publish many field lists in one call to rtEdgeCache3 server
+ *
+ * The channel is locked once, all messages are built back to back into 
+ * the outbound buffer, and the buffer is flushed once at the end.  Use
+ * this when publishing many tickers per cycle - e.g., a curve recalc.
+ *
+ * \param cxt - Publication Channel Context from rtEdge_PubInit()
+ * \param data - Array of data streams + field lists to publish
+ * \param nData - Number of entries in data
+ * \return Number of messages published; < nData if outbound queue 
+ * overflowed or stream not opened on interactive channel.  See 
+ * rtEdgeChanStats._nOverflow.
+ */
+int rtEdge_PublishBatch( rtEdge_Context cxt, rtEdgeData *data, int nData );
+
 /**
  * \brief Publish error on an opened stream to rtEdgeCache3 server
  *
@@ -1768,6 +2203,18 @@ rtBUF rtEdge_PubGetData( rtEdge_Context cxt );
  */
 void LVC_SetLock( char bLock, long dwWaitMillis );
 
+/**
+ * \brief Pre-fault the entire LVC file when mapped by LVC_Initialize().
+ *
+ * The LVC is mapped with MAP_POPULATE, so the first LVC_Snapshot() of 
+ * each record does not stall on a page fault.  Costs startup time and 
+ * resident memory equal to the LVC file size.  Linux only.  The LVC is
+ * always advised for random access.
+ *
+ * \param bPopulate - 1 to pre-fault; 0 to fault on demand (Default)
+ */
+void LVC_SetPopulate( char bPopulate );
+
 /**
  * \brief Initialize the view on the Last Value Cache (LVC)
  *
@@ -1824,6 +2271,54 @@ int LVC_SetFilter( LVC_Context cxt, const char *flds, const char **svcs );
  */
 void LVC_SetCopyType( LVC_Context cxt, char bFull );
 
+/**
+ * \brief Set number of worker threads used by LVC_SnapAll() and 
+ * LVC_ViewAll().
+ *
+ * The records are partitioned across nThr workers, each of which copies
+ * its slice straight from the memory-mapped LVC file.  Each worker 
+ * snaps at least 1024 records, so small databases use fewer threads.
+ *
+ * \param cxt - LVC Context from LVC_Initialize()
+ * \param nThr - Number of threads; Default is 1 (calling thread only)
+ */
+void LVC_SetSnapThreads( LVC_Context cxt, int nThr );
+
+/**
+ * \brief Enable / disable arena allocation in LVC_SnapAll() and 
+ * LVC_ViewAll().
+ *
+ * When enabled, all field lists, record copies and strings in the 
+ * returned LVCDataAll are carved from a few large (16 MB) blocks chained
+ * off LVCDataAll._arena rather than allocated per record.  LVC_FreeAll() 
+ * releases the whole result in one shot; LVC_Free() on an
+ * individual LVCData from the result is a no-op.
+ *
+ * \param cxt - LVC Context from LVC_Initialize()
+ * \param bArena - 1 to carve from one block; 0 for per-record (Default)
+ */
+void LVC_SetArena( LVC_Context cxt, char bArena );
+
+/**
+ * \brief Enable / disable lock-free reads in LVC_Snapshot(), LVC_View(),
+ * LVC_SnapAll(), LVC_ViewAll() and LVC_SnapSince().
+ *
+ * When enabled, readers do not serialize on the LVC mutex.  Each record 
+ * is copied out of the file, then validated against the live record 
+ * (update count, update time and contents); the copy is retried if the 
+ * LVC server was writing the record at the same time.  LVCData._pErr is 
+ * set if the record never settles.
+ *
+ * The shape of the LVC - the set of records and the file mapping - is 
+ * frozen when enabled : Records added to the LVC afterwards are not 
+ * visible until lock-free reads are disabled.  View-only (shallow) 
+ * queries return a deep copy when lock-free.
+ *
+ * \param cxt - LVC Context from LVC_Initialize()
+ * \param bLockFree - 1 for lock-free reads; 0 to lock (Default)
+ */
+void LVC_SetLockFree( LVC_Context cxt, char bLockFree );
+
 /**
  * \brief Query the LVC for current (volatile) values for a single 
  * ( svc,tkr ) record.
@@ -1885,6 +2380,28 @@ LVCDataAll LVC_SnapAll( LVC_Context cxt );
  */
 LVCDataAll LVC_ViewAll( LVC_Context cxt );
 
+/**
+ * \brief Query the LVC for current (volatile) values of only those records
+ * updated or dropped since tWatermark.
+ *
+ * Only the record headers are scanned - in file order - to find the changed
+ * records, so the cost of polling scales with the churn in the LVC, not the 
+ * size of the LVC.
+ *
+ * -# Pass LVCDataAll._tWatermark from the last LVC_SnapAll() or 
+ * LVC_SnapSince() into the next LVC_SnapSince()
+ * -# The new _tWatermark is the newest update or drop time seen in the
+ * LVC, so clock skew between the LVC writer and this reader can not 
+ * drop records.  Records updated while this call runs may be returned 
+ * again on the next call
+ * -# Call LVC_FreeAll() when done with the data
+ *
+ * \param cxt - LVC Context from LVC_Initialize()
+ * \param tWatermark - Unix time w/ microseconds; 0.0 for all records
+ * \return Changed records in LVCDataAll struct, with new _tWatermark
+ */
+LVCDataAll LVC_SnapSince( LVC_Context cxt, double tWatermark );
+
 /**
  * \brief Release resources associated with last call to LVC_ViewAll() or 
  * LVC_SnapAll().
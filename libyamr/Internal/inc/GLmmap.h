@@ -13,8 +13,9 @@
 *      3 JUL 2016 jcs  Build 33: GLasciiFile
 *     12 OCT 2017 jcs  Build 36: OFF_T siz(); _w32XxSz / _w32FileMapping()
 *      7 NOV 2017 jcs  Build 38: pFile()
+*     17 OCT 2026 jcs  Build  4: advise(); populate(); willNeed()
 *
-*  (c) 1994-2017 Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __YAMR_GLMMAP_H
 #define __YAMR_GLMMAP_H
@@ -76,6 +77,16 @@ extern int getpagesize();
 ///////////////////////////////////////////
 namespace YAMR_PRIVATE
 {
+
+/////////////////////////////////////////
+// Access pattern : madvise() on every map()
+/////////////////////////////////////////
+typedef enum {
+   mmap_normal     = 0,
+   mmap_sequential = 1,
+   mmap_random     = 2
+} GLmmapAdvice;
+
 class GLmmap
 {
 protected:
@@ -94,6 +105,8 @@ protected:
 	int     _errno;
 	DWORD   _w32LoSz;
 	DWORD   _w32HiSz;
+	GLmmapAdvice _advice;
+	Bool         _bPopulate;
 
 	// Constructor / Destructor
 public:
@@ -125,13 +138,18 @@ public:
 	OFF_T       siz();
 	OFF_T       offset();
 	int         error();
+	GLmmapAdvice advice();
 
 	// Operations
 
 	char *map( OFF_T off=0, OFF_T len=0, char *addr=0 );
 	void  unmap();
+	void  advise( GLmmapAdvice );
+	void  populate( Bool );
+	void  willNeed( OFF_T, OFF_T );
 private:
 	Bool  _w32FileMapping( OFF_T );
+	void  _madvise();
 
 	// Platform-Independent File Operations
 public:
@@ -146,6 +164,7 @@ public:
 	static OFF_T    Stat( FPHANDLE );
 	static void     Flush( FPHANDLE );
 	static int      GetPageSize();
+	static int      SysPageSize();
 };
 
 /////////////////////////////////////////
@@ -5,8 +5,9 @@
 *
 *  REVISION HISTORY:
 *     11 MAY 2019 jcs  Created
+*     17 OCT 2026 jcs  Build  4: mmap_sequential; willNeed()
 *
-*  (c) 1994-2019 Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #ifndef __YAMR_READER_H
 #define __YAMR_READER_H
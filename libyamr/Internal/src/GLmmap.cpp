@@ -12,8 +12,9 @@
 *      3 JUL 2016 jcs  Build 33: GLasciiFile
 *     12 OCT 2017 jcs  Build 36: OFF_T siz(); _w32XxSz / _w32FileMapping()
 *      7 NOV 2017 jcs  Build 38: pFile()
+*     17 OCT 2026 jcs  Build  4: advise(); populate(); willNeed()
 *
-*  (c) 1994-2017 Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <Internal.h>
 
@@ -73,7 +74,9 @@ GLmmap::GLmmap( MMAP_FD fd,
    _flags( flags ),
    _errno( 0 ),
    _w32LoSz( 0 ),
-   _w32HiSz( 0 )
+   _w32HiSz( 0 ),
+   _advice( mmap_normal ),
+   _bPopulate( False )
 {
    // Map to existing file, if non-zero len
 
@@ -102,7 +105,9 @@ GLmmap::GLmmap( char  *fname,
    _flags( flags ),
    _errno( 0 ),
    _w32LoSz( 0 ),
-   _w32HiSz( 0 )
+   _w32HiSz( 0 ),
+   _advice( mmap_normal ),
+   _bPopulate( False )
 {
    FPHANDLE    fp;
    const char *openFlags;
@@ -174,7 +179,9 @@ GLmmap::GLmmap( char *fname, char *addr, OFF_T off, OFF_T len ) :
    _flags( MAP_SHARED ),
    _errno( 0 ),
    _w32LoSz( 0 ),
-   _w32HiSz( 0 )
+   _w32HiSz( 0 ),
+   _advice( mmap_normal ),
+   _bPopulate( False )
 {
    FPHANDLE fp;
    OFF_T    stSz;
@@ -290,13 +297,18 @@ int GLmmap::error()
    return _errno;
 }
 
+GLmmapAdvice GLmmap::advice()
+{
+   return _advice;
+}
+
 
 ////////////////////////////////////////////
 // Operations
 ////////////////////////////////////////////
 char *GLmmap::map( OFF_T off, OFF_T len, char *addr )
 {
-   int nPad;
+   int nPad, flags;
    int pgSz = GetPageSize();
 
    // Unmap / Map
@@ -326,15 +338,22 @@ char *GLmmap::map( OFF_T off, OFF_T len, char *addr )
                                         addr );
    _base = !_base ? (char *)MAP_FAILED : _base;
 #else
+   flags = _flags;
+#if defined(MAP_POPULATE)
+   flags |= _bPopulate ? MAP_POPULATE : 0;
+#endif // defined(MAP_POPULATE)
 #if defined(_LARGEFILE64_SOURCE)
-   _base = (char *)::mmap64( addr, _mLen, _prot, _flags, _fd, _mOff );
+   _base = (char *)::mmap64( addr, _mLen, _prot, flags, _fd, _mOff );
 #else
-   _base = (char *)::mmap( addr, _mLen, _prot, _flags, _fd, _mOff );
+   _base = (char *)::mmap( addr, _mLen, _prot, flags, _fd, _mOff );
 #endif // defined(_LARGEFILE64_SOURCE)
 #endif // WIN32
    _pa   = _base;
-   if ( isValid() )
+   if ( isValid() ) {
       _pa += nPad;
+      if ( _advice != mmap_normal )
+         _madvise();
+   }
    else
 #ifdef WIN32
       _errno = ::GetLastError();
@@ -369,6 +388,59 @@ void GLmmap::unmap()
    _off  = 0;
 }
 
+void GLmmap::advise( GLmmapAdvice adv )
+{
+   _advice = adv;
+   _madvise();
+}
+
+void GLmmap::populate( Bool bPopulate )
+{
+   _bPopulate = bPopulate;
+}
+
+void GLmmap::willNeed( OFF_T off, OFF_T len )
+{
+#ifndef WIN32
+   char *cp;
+   OFF_T nPad;
+
+   // Pre-condition
+
+   if ( !isValid() || ( off >= _len ) )
+      return;
+
+   // Page-align; Kernel reads ahead asynchronously
+
+   len  = gmin( len, _len-off );
+   cp   = _pa + off;
+   nPad = (OFF_T)cp % SysPageSize();
+   ::madvise( cp-nPad, len+nPad, MADV_WILLNEED );
+#endif // WIN32
+}
+
+void GLmmap::_madvise()
+{
+#ifndef WIN32
+   int adv;
+
+   // Pre-condition
+
+   if ( !isValid() )
+      return;
+
+   // Whole mapping
+
+   switch( _advice ) {
+      case mmap_sequential: adv = MADV_SEQUENTIAL; break;
+      case mmap_random:     adv = MADV_RANDOM;     break;
+      default:              adv = MADV_NORMAL;     break;
+   }
+   if ( ::madvise( _base, _mLen, adv ) == -1 )
+      _errno = errno;
+#endif // WIN32
+}
+
 Bool GLmmap::_w32FileMapping( OFF_T len )
 {
 #ifdef WIN32
@@ -612,6 +684,24 @@ int GLmmap::GetPageSize()
    return _pageSiz;
 }
 
+int GLmmap::SysPageSize()
+{
+   static int _sysPgSz = -1;
+
+   if ( _sysPgSz == -1 )
+#ifdef WIN32
+   {
+      SYSTEM_INFO si;
+
+      ::GetSystemInfo( &si );
+      _sysPgSz = si.dwPageSize;
+   }
+#else
+      _sysPgSz = ::getpagesize();
+#endif // WIN32
+   return _sysPgSz;
+}
+
 
 
 
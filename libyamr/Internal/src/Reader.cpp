@@ -5,8 +5,9 @@
 *
 *  REVISION HISTORY:
 *     11 MAY 2019 jcs  Created
+*     17 OCT 2026 jcs  Build  4: mmap_sequential; willNeed()
 *
-*  (c) 1994-2019 Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 ******************************************************************************/
 #include <Internal.h>
 
@@ -35,8 +36,9 @@ Reader::Reader( const char     *file,
    _pos( 0 ),
    _bOK( true )
 {
-   // 'Snap' Header : Which fixes end of file at load time
+   // 'Snap' Header : Which fixes end of file at load time; Read front to back
 
+   advise( mmap_sequential );
    ::memset( &_hdr, 0, _hSz );
    if ( (_bOK=isValid()) )
       ::memcpy( &_hdr, data(), _hSz );
@@ -100,6 +102,7 @@ bool Reader::ReadWindow( u_int64_t winSz )
    if ( !winSz )
       return false;
    map( _pos, winSz );
+   willNeed( 0, winSz );
    return isValid();
 }
 
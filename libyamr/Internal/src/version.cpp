@@ -2,7 +2,7 @@
 *
 *  version.cpp
 *
-*  (c) 1994-2017 Gatea Ltd.
+*  (c) 1994-2026, Gatea Ltd.
 *******************************************************************************/
 #include <Internal.h>
 
@@ -17,7 +17,7 @@ char *libyamrID()
       char bp[K], *cp;
 
       cp     = bp;
-      cp    += sprintf( cp, "@(#)libyamr %s Build 3 ", GL64 );
+      cp    += sprintf( cp, "@(#)libyamr %s Build 4 ", GL64 );
       cp    += sprintf( cp, "%s %s Gatea Ltd.", __DATE__, __TIME__ );
       s      = bp;
       sccsid = (char *)s.data();